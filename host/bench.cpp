@@ -0,0 +1,238 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+
+// renders each scenario on host::device and prints one json object per line:
+//   bench [--frames n] [--scenario name] [--validate]
+// times are wall clock over the frames after a short warm up. --validate turns on the
+// device's range checks, which the timings otherwise leave out
+namespace
+{
+	struct options
+	{
+		std::size_t frames = 100u;
+		const char* scenario = nullptr;
+		bool validate = false;
+	};
+
+	struct result
+	{
+		const char* scenario;
+		std::size_t frames;
+		// primitives recorded per frame, or allocator operations for allocator_churn
+		std::size_t primitives;
+		double nanoseconds = 0.;
+		std::size_t draw_calls = 0u;
+		std::size_t maps = 0u;
+		std::size_t bytes_mapped = 0u;
+		std::size_t allocations = 0u;
+		std::size_t dropped = 0u;
+		std::size_t errors = 0u;
+	};
+
+	void print(const result& result)
+	{
+		const auto per_frame = [&](std::size_t total)
+		{
+			return static_cast<double>(total) / static_cast<double>(result.frames);
+		};
+		std::printf("{\"scenario\":\"%s\",\"frames\":%zu,\"primitives\":%zu,\"ns_per_frame\":%.1f,\"ns_per_primitive\":%.3f,"
+			"\"draw_calls\":%.1f,\"maps\":%.1f,\"bytes_mapped\":%.1f,\"allocations\":%.1f,\"dropped\":%.1f,\"device_errors\":%zu}\n",
+			result.scenario, result.frames, result.primitives, result.nanoseconds / static_cast<double>(result.frames),
+			result.nanoseconds / static_cast<double>(result.frames * result.primitives), per_frame(result.draw_calls),
+			per_frame(result.maps), per_frame(result.bytes_mapped), per_frame(result.allocations), per_frame(result.dropped), result.errors);
+	}
+
+	// the same primitives every frame, spread over a 1280x720 viewport
+	struct scene
+	{
+		struct primitive
+		{
+			rendering::vec2 a;
+			rendering::vec2 b;
+			rendering::colour colour;
+			bool line;
+		};
+
+		explicit scene(std::size_t count)
+		{
+			std::mt19937 random(count);
+			std::uniform_real_distribution<float> x(0.f, 1260.f), y(0.f, 700.f), size(2.f, 20.f), channel(0.f, 1.f);
+			primitives.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+			{
+				const rendering::vec2 pos{ x(random), y(random) };
+				primitives.push_back({ pos, { size(random), size(random) }, { channel(random), channel(random), channel(random), 1.f }, i % 4u == 3u });
+			}
+		}
+
+		std::vector<primitive> primitives;
+	};
+
+	template<typename Record>
+	result run(const char* name, const options& options, std::size_t primitives, Record&& record)
+	{
+		host::device::options device_options;
+		device_options.validate = options.validate;
+		host::device device(device_options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		const auto frame = [&]
+		{
+			renderer->begin();
+			record(*renderer);
+			renderer->end();
+		};
+
+		for (auto i = 0u; i < 2u; ++i)
+			frame();
+
+		device.stats() = { };
+		const auto allocations = memory::stats().alloc_calls;
+		result result{ name, options.frames, primitives };
+
+		const auto start = std::chrono::steady_clock::now();
+		for (auto i = 0u; i < options.frames; ++i)
+		{
+			frame();
+			result.bytes_mapped += renderer->stats().bytes_uploaded;
+			result.dropped += renderer->stats().dropped;
+		}
+		result.nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		result.draw_calls = device.stats().draws;
+		result.maps = device.stats().maps;
+		result.allocations = memory::stats().alloc_calls - allocations;
+		result.errors = device.stats().errors;
+		return result;
+	}
+
+	result primitives(const char* name, const options& options, std::size_t count)
+	{
+		const scene scene(count);
+		return run(name, options, count, [&](rendering::renderer& renderer)
+		{
+			for (const auto& primitive : scene.primitives)
+			{
+				if (primitive.line)
+					renderer.draw_line(primitive.a, primitive.a + primitive.b, primitive.colour);
+				else
+					renderer.draw_filled_box(primitive.a, primitive.b, primitive.colour);
+			}
+		});
+	}
+
+	// a scissored clip rect around every primitive, so each one is drawn on its own
+	result flush_storm(const options& options)
+	{
+		const scene scene(1000u);
+		return run("flush_storm", options, scene.primitives.size(), [&](rendering::renderer& renderer)
+		{
+			for (const auto& primitive : scene.primitives)
+			{
+				renderer.push_clip_rect(primitive.a, primitive.b, rendering::renderer::clip_mode::scissor);
+				renderer.draw_filled_box(primitive.a, primitive.b, primitive.colour);
+				renderer.pop_clip_rect();
+			}
+		});
+	}
+
+	// the static heap on its own, mixed sizes with a few hundred blocks alive at once
+	result allocator_churn(const options& options)
+	{
+		constexpr auto operations = 10000u;
+		constexpr auto live = 256u;
+
+		std::mt19937 random(operations);
+		std::uniform_int_distribution<std::size_t> size(8u, 512u), slot(0u, live - 1u);
+		std::vector<std::size_t> sizes(operations), slots(operations);
+		for (auto i = 0u; i < operations; ++i)
+		{
+			sizes[i] = size(random);
+			slots[i] = slot(random);
+		}
+
+		std::vector<void*> blocks(live, nullptr);
+		const auto before = memory::stats();
+		const auto start = std::chrono::steady_clock::now();
+		for (auto frame = 0u; frame < options.frames; ++frame)
+		{
+			for (auto i = 0u; i < operations; ++i)
+			{
+				auto*& block = blocks[slots[i]];
+				if (block)
+				{
+					memory::free(block);
+					block = nullptr;
+				}
+				else
+					block = memory::alloc(sizes[i]);
+			}
+		}
+		const auto nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		const auto after = memory::stats();
+
+		for (auto* block : blocks)
+			memory::free(block);
+
+		result result{ "allocator_churn", options.frames, operations, nanoseconds };
+		result.allocations = after.alloc_calls - before.alloc_calls;
+		result.dropped = after.failures - before.failures;
+		return result;
+	}
+
+	bool selected(const options& options, const char* name)
+	{
+		return !options.scenario || std::strcmp(options.scenario, name) == 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	options options;
+	for (auto i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			options.frames = std::strtoul(argv[++i], nullptr, 10);
+		else if (std::strcmp(argv[i], "--scenario") == 0 && i + 1 < argc)
+			options.scenario = argv[++i];
+		else if (std::strcmp(argv[i], "--validate") == 0)
+			options.validate = true;
+		else
+		{
+			std::fprintf(stderr, "usage: bench [--frames n] [--scenario name] [--validate]\n");
+			return 1;
+		}
+	}
+	if (!options.frames)
+		options.frames = 1u;
+
+	auto errors = 0u;
+	const auto report = [&](const result& result)
+	{
+		print(result);
+		errors += result.errors != 0u;
+	};
+
+	if (selected(options, "primitives_1k"))
+		report(primitives("primitives_1k", options, 1000u));
+	if (selected(options, "primitives_10k"))
+		report(primitives("primitives_10k", options, 10000u));
+	if (selected(options, "primitives_100k"))
+		report(primitives("primitives_100k", options, 100000u));
+	if (selected(options, "flush_storm"))
+		report(flush_storm(options));
+	if (selected(options, "allocator_churn"))
+		report(allocator_churn(options));
+	return errors ? 2 : 0;
+}
\ No newline at end of file
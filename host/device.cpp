@@ -0,0 +1,1147 @@
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include "device.hpp"
+
+namespace host
+{
+	// reference counted, but owned by the device so a use after release reads valid memory
+	// and shows up as a leak or an error instead of a crash
+	template<typename Interface>
+	class object : public Interface
+	{
+	public:
+		explicit object(device& owner)
+			: _owner(owner)
+			, _references(1u)
+		{
+			++_owner._live;
+			++_owner._stats.objects_created;
+		}
+
+		HRESULT QueryInterface(REFIID, void** object) override
+		{
+			*object = this;
+			AddRef();
+			return S_OK;
+		}
+
+		ULONG AddRef() override
+		{
+			if (!_references)
+				_owner.error("AddRef on a released object");
+			return ++_references;
+		}
+
+		ULONG Release() override
+		{
+			if (!_references)
+			{
+				_owner.error("Release on a released object");
+				return 0u;
+			}
+			if (--_references == 0u)
+			{
+				--_owner._live;
+				released();
+			}
+			return _references;
+		}
+
+		bool alive() const
+		{
+			return _references != 0u;
+		}
+	protected:
+		virtual void released() { }
+
+		device& _owner;
+	private:
+		ULONG _references;
+	};
+
+	class buffer final : public object<ID3D11Buffer>
+	{
+	public:
+		buffer(device& owner, const D3D11_BUFFER_DESC& desc)
+			: object(owner)
+			, desc(desc)
+			, data(desc.ByteWidth)
+			, mapped()
+		{ }
+
+		D3D11_BUFFER_DESC desc;
+		std::vector<std::uint8_t> data;
+		bool mapped;
+	};
+
+	class texture final : public object<ID3D11Texture2D>
+	{
+	public:
+		texture(device& owner, const D3D11_TEXTURE2D_DESC& desc)
+			: object(owner)
+			, desc(desc)
+			, data(std::size_t{ desc.Width } * desc.Height * texel_size(desc.Format))
+		{ }
+
+		static UINT texel_size(DXGI_FORMAT format)
+		{
+			switch (format)
+			{
+			case DXGI_FORMAT_R8_UNORM: return 1u;
+			case DXGI_FORMAT_R16_UINT: return 2u;
+			case DXGI_FORMAT_R8G8B8A8_UNORM:
+			case DXGI_FORMAT_R16G16_UNORM:
+			case DXGI_FORMAT_R32_FLOAT:
+			case DXGI_FORMAT_R32_UINT: return 4u;
+			case DXGI_FORMAT_R32G32_FLOAT: return 8u;
+			case DXGI_FORMAT_R32G32B32A32_FLOAT: return 16u;
+			default: return 0u;
+			}
+		}
+
+		UINT pitch() const
+		{
+			return desc.Width * texel_size(desc.Format);
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		std::vector<std::uint8_t> data;
+	};
+
+	// keeps its resource alive like a real view does
+	template<typename Interface>
+	class view final : public object<Interface>
+	{
+	public:
+		view(device& owner, ID3D11Resource* resource)
+			: object<Interface>(owner)
+			, resource(resource)
+		{
+			resource->AddRef();
+		}
+
+		ID3D11Resource* resource;
+	private:
+		void released() override
+		{
+			resource->Release();
+		}
+	};
+
+	template<typename Interface>
+	class shader final : public object<Interface>
+	{
+	public:
+		shader(device& owner, const void* bytecode, std::size_t size)
+			: object<Interface>(owner)
+			, bytecode(static_cast<const std::uint8_t*>(bytecode), static_cast<const std::uint8_t*>(bytecode) + size)
+		{ }
+
+		std::vector<std::uint8_t> bytecode;
+	};
+
+	template<typename Interface, typename Desc>
+	class state final : public object<Interface>
+	{
+	public:
+		state(device& owner, const Desc& desc)
+			: object<Interface>(owner)
+			, desc(desc)
+		{ }
+
+		Desc desc;
+	};
+
+	using input_layout = state<ID3D11InputLayout, std::vector<D3D11_INPUT_ELEMENT_DESC>>;
+	using blend_state = state<ID3D11BlendState, D3D11_BLEND_DESC>;
+	using rasterizer_state = state<ID3D11RasterizerState, D3D11_RASTERIZER_DESC>;
+	using sampler_state = state<ID3D11SamplerState, D3D11_SAMPLER_DESC>;
+
+	class query final : public object<ID3D11Query>
+	{
+	public:
+		query(device& owner, const D3D11_QUERY_DESC& desc)
+			: object(owner)
+			, desc(desc)
+			, timestamp()
+			, ended()
+		{ }
+
+		D3D11_QUERY_DESC desc;
+		std::uint64_t timestamp;
+		bool ended;
+	};
+
+	namespace
+	{
+		// md5 with the padding fxc uses, run over the container after its hash field
+		void md5_transform(std::uint32_t state[4], const std::uint8_t* block)
+		{
+			static constexpr std::uint32_t shifts[64] = {
+				7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+				5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+				4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+				6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21 };
+			static constexpr std::uint32_t constants[64] = {
+				0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+				0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+				0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+				0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+				0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+				0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+				0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+				0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391 };
+
+			std::uint32_t words[16];
+			std::memcpy(words, block, sizeof(words));
+
+			auto a = state[0], b = state[1], c = state[2], d = state[3];
+			for (auto i = 0u; i < 64u; ++i)
+			{
+				std::uint32_t f, g;
+				if (i < 16u) { f = (b & c) | (~b & d); g = i; }
+				else if (i < 32u) { f = (d & b) | (~d & c); g = (5u * i + 1u) % 16u; }
+				else if (i < 48u) { f = b ^ c ^ d; g = (3u * i + 5u) % 16u; }
+				else { f = c ^ (b | ~d); g = (7u * i) % 16u; }
+
+				f += a + constants[i] + words[g];
+				a = d;
+				d = c;
+				c = b;
+				b += (f << shifts[i]) | (f >> (32u - shifts[i]));
+			}
+			state[0] += a;
+			state[1] += b;
+			state[2] += c;
+			state[3] += d;
+		}
+
+		void dxbc_hash(const std::uint8_t* data, std::size_t size, std::uint32_t hash[4])
+		{
+			hash[0] = 0x67452301u;
+			hash[1] = 0xefcdab89u;
+			hash[2] = 0x98badcfeu;
+			hash[3] = 0x10325476u;
+
+			const auto full = size - size % 64u;
+			for (std::size_t offset = 0u; offset < full; offset += 64u)
+				md5_transform(hash, data + offset);
+
+			const auto rest = size - full;
+			const auto bits = static_cast<std::uint32_t>(size * 8u);
+			const auto tail = (bits >> 2) | 1u;
+			std::uint8_t block[64] = { };
+			if (rest >= 56u)
+			{
+				std::memcpy(block, data + full, rest);
+				block[rest] = 0x80u;
+				md5_transform(hash, block);
+
+				std::memset(block, 0, sizeof(block));
+				std::memcpy(block, &bits, 4u);
+				std::memcpy(block + 60, &tail, 4u);
+			}
+			else
+			{
+				std::memcpy(block, &bits, 4u);
+				std::memcpy(block + 4, data + full, rest);
+				block[4 + rest] = 0x80u;
+				std::memcpy(block + 60, &tail, 4u);
+			}
+			md5_transform(hash, block);
+		}
+
+		std::uint32_t read32(const std::uint8_t* data)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		// the chunk with fourcc, or nullptr. bytecode must have passed valid_bytecode
+		const std::uint8_t* find_chunk(const std::uint8_t* bytecode, const char* fourcc, std::uint32_t& size)
+		{
+			const auto count = read32(bytecode + 28);
+			for (auto i = 0u; i < count; ++i)
+			{
+				const auto* chunk = bytecode + read32(bytecode + 32 + i * 4u);
+				if (std::memcmp(chunk, fourcc, 4u) == 0)
+				{
+					size = read32(chunk + 4);
+					return chunk + 8;
+				}
+			}
+			return nullptr;
+		}
+
+		bool same_semantic(const char* a, const char* b)
+		{
+			for (; *a && *b; ++a, ++b)
+			{
+				if ((*a | 0x20) != (*b | 0x20))
+					return false;
+			}
+			return *a == *b;
+		}
+
+		template<typename T>
+		T* add_reference(T* object)
+		{
+			if (object)
+				object->AddRef();
+			return object;
+		}
+	}
+
+	bool valid_bytecode(const void* bytecode, std::size_t size)
+	{
+		const auto* data = static_cast<const std::uint8_t*>(bytecode);
+		if (!data || size < 32u || std::memcmp(data, "DXBC", 4u) != 0 || read32(data + 24) != size)
+			return false;
+
+		const auto count = read32(data + 28);
+		if (32u + std::size_t{ count } * 4u > size)
+			return false;
+		for (auto i = 0u; i < count; ++i)
+		{
+			const auto offset = std::size_t{ read32(data + 32 + i * 4u) };
+			if (offset + 8u > size || offset + 8u + read32(data + offset + 4) > size)
+				return false;
+		}
+
+		std::uint32_t hash[4];
+		dxbc_hash(data + 20, size - 20u, hash);
+		return std::memcmp(hash, data + 4, sizeof(hash)) == 0;
+	}
+
+	context::context(device& owner)
+		: _device(owner)
+		, _constant_buffer()
+		, _shader_resource()
+		, _sampler()
+		, _vertex_shader()
+		, _pixel_shader()
+		, _input_layout()
+		, _vertex_buffer()
+		, _stride()
+		, _offset()
+		, _index_buffer()
+		, _index_format()
+		, _index_offset()
+		, _topology()
+		, _render_targets()
+		, _blend_state()
+		, _blend_factor()
+		, _sample_mask(0xffffffffu)
+		, _rasterizer_state()
+		, _scissor_count()
+		, _scissor()
+		, _timestamp()
+	{ }
+
+	HRESULT context::QueryInterface(REFIID, void** object)
+	{
+		*object = this;
+		return S_OK;
+	}
+
+	ULONG context::AddRef()
+	{
+		return 1u;
+	}
+
+	ULONG context::Release()
+	{
+		return 1u;
+	}
+
+	void context::VSSetConstantBuffers(UINT start_slot, UINT count, ID3D11Buffer* const* buffers)
+	{
+		++_device._stats.state_sets;
+		if (start_slot == 0u && count)
+			_constant_buffer = buffers[0];
+	}
+
+	void context::PSSetShaderResources(UINT start_slot, UINT count, ID3D11ShaderResourceView* const* views)
+	{
+		++_device._stats.state_sets;
+		if (start_slot == 0u && count)
+			_shader_resource = views[0];
+	}
+
+	void context::PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const*, UINT)
+	{
+		++_device._stats.state_sets;
+		_pixel_shader = shader;
+	}
+
+	void context::PSSetSamplers(UINT start_slot, UINT count, ID3D11SamplerState* const* samplers)
+	{
+		++_device._stats.state_sets;
+		if (start_slot == 0u && count)
+			_sampler = samplers[0];
+	}
+
+	void context::VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const*, UINT)
+	{
+		++_device._stats.state_sets;
+		_vertex_shader = shader;
+	}
+
+	void context::DrawIndexed(UINT index_count, UINT start_index, INT base_vertex)
+	{
+		++_device._stats.draws;
+		_device._stats.indices += index_count;
+		draw(index_count, start_index, base_vertex, true);
+	}
+
+	void context::Draw(UINT vertex_count, UINT start_vertex)
+	{
+		++_device._stats.draws;
+		draw(vertex_count, 0u, static_cast<INT>(start_vertex), false);
+	}
+
+	void context::DrawInstanced(UINT vertex_count, UINT instance_count, UINT start_vertex, UINT start_instance)
+	{
+		++_device._stats.draws;
+		_device._stats.instances += instance_count;
+
+		auto* instances = static_cast<buffer*>(_vertex_buffer);
+		if (_device._options.validate)
+		{
+			if (!instances || !_input_layout || !_vertex_shader || !_pixel_shader)
+				return _device.error("DrawInstanced without an instance buffer, input layout or shaders bound");
+			if (instances->mapped)
+				return _device.error("DrawInstanced from a mapped buffer");
+			if (_offset + (std::size_t{ start_instance } + instance_count) * _stride > instances->data.size())
+				return _device.error("DrawInstanced past the end of the instance buffer");
+			// the vertex shader expands every instance into whole triangles from the vertex id
+			if (_topology != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST || vertex_count == 0u || (start_vertex + vertex_count) % 3u != 0u)
+				return _device.error("DrawInstanced without whole triangles from the vertex id");
+		}
+
+		if (_device._options.capture && instances)
+		{
+			const auto* first = instances->data.data() + _offset + std::size_t{ start_instance } * _stride;
+			_device._draws.push_back({ _topology, _stride, vertex_count, std::vector<std::uint8_t>(first, first + std::size_t{ instance_count } * _stride), _scissor });
+		}
+	}
+
+	void context::draw(UINT count, UINT start_index, INT base_vertex, bool indexed)
+	{
+		auto* vertices = static_cast<buffer*>(_vertex_buffer);
+		auto* indices = static_cast<buffer*>(_index_buffer);
+		const auto validate = _device._options.validate;
+
+		if (validate)
+		{
+			if (!vertices || !_stride || !_input_layout || !_vertex_shader || !_pixel_shader)
+				return _device.error("draw without a vertex buffer, input layout or shaders bound");
+			if (_topology == D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED)
+				return _device.error("draw without a topology");
+			if (vertices->mapped)
+				return _device.error("draw from a mapped vertex buffer");
+			if (_render_targets[0] == nullptr)
+				return _device.error("draw without a render target");
+		}
+		if (indexed && validate)
+		{
+			if (!indices || _index_format != DXGI_FORMAT_R16_UINT)
+				return _device.error("DrawIndexed without a 16 bit index buffer bound");
+			if (indices->mapped)
+				return _device.error("DrawIndexed from a mapped index buffer");
+			if (_index_offset + (std::size_t{ start_index } + count) * 2u > indices->data.size())
+				return _device.error("DrawIndexed past the end of the index buffer");
+		}
+
+		const auto capture = _device._options.capture && vertices && (!indexed || indices);
+		if (!validate && !capture)
+			return;
+
+		draw_record record{ _topology, _stride, 0u, { }, _scissor };
+		if (capture)
+			record.data.reserve(std::size_t{ count } * _stride);
+
+		for (auto i = 0u; i < count; ++i)
+		{
+			std::int64_t vertex;
+			if (indexed)
+			{
+				std::uint16_t index;
+				std::memcpy(&index, indices->data.data() + _index_offset + (std::size_t{ start_index } + i) * 2u, 2u);
+				vertex = std::int64_t{ index } + base_vertex;
+			}
+			else
+				vertex = std::int64_t{ base_vertex } + i;
+
+			const auto offset = _offset + vertex * _stride;
+			if (vertex < 0 || offset + _stride > static_cast<std::int64_t>(vertices->data.size()))
+			{
+				if (validate)
+					return _device.error("draw reads past the end of the vertex buffer");
+				return;
+			}
+			if (capture)
+				record.data.insert(record.data.end(), vertices->data.data() + offset, vertices->data.data() + offset + _stride);
+		}
+
+		if (capture)
+			_device._draws.push_back(std::move(record));
+	}
+
+	HRESULT context::Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP map_type, UINT, D3D11_MAPPED_SUBRESOURCE* mapped)
+	{
+		++_device._stats.maps;
+
+		auto* target = dynamic_cast<buffer*>(resource);
+		if (!target || subresource != 0u)
+		{
+			_device.error("Map of something other than a buffer");
+			return E_FAIL;
+		}
+		if (target->desc.Usage != D3D11_USAGE_DYNAMIC || !(target->desc.CPUAccessFlags & D3D11_CPU_ACCESS_WRITE))
+		{
+			_device.error("Map of a buffer that is not dynamic with cpu write access");
+			return E_FAIL;
+		}
+		if (map_type != D3D11_MAP_WRITE_DISCARD && map_type != D3D11_MAP_WRITE_NO_OVERWRITE)
+		{
+			_device.error("Map of a dynamic buffer without discard or no overwrite");
+			return E_FAIL;
+		}
+		if (map_type == D3D11_MAP_WRITE_NO_OVERWRITE && (target->desc.BindFlags & D3D11_BIND_CONSTANT_BUFFER))
+		{
+			_device.error("Map of a constant buffer with no overwrite");
+			return E_FAIL;
+		}
+		if (target->mapped)
+		{
+			_device.error("Map of a buffer that is already mapped");
+			return E_FAIL;
+		}
+
+		// a discard hands out fresh memory, anything that relied on the old contents reads garbage
+		if (map_type == D3D11_MAP_WRITE_DISCARD)
+		{
+			++_device._stats.discards;
+			if (_device._options.validate)
+				std::fill(target->data.begin(), target->data.end(), std::uint8_t{ 0xcd });
+		}
+
+		if (_device._options.capture)
+			_device._maps.push_back({ target, map_type });
+
+		target->mapped = true;
+		mapped->pData = target->data.data();
+		mapped->RowPitch = target->desc.ByteWidth;
+		mapped->DepthPitch = target->desc.ByteWidth;
+		return S_OK;
+	}
+
+	void context::Unmap(ID3D11Resource* resource, UINT)
+	{
+		auto* target = dynamic_cast<buffer*>(resource);
+		if (!target || !target->mapped)
+			return _device.error("Unmap of a resource that is not mapped");
+		target->mapped = false;
+	}
+
+	void context::IASetInputLayout(ID3D11InputLayout* input_layout)
+	{
+		++_device._stats.state_sets;
+		_input_layout = input_layout;
+	}
+
+	void context::IASetVertexBuffers(UINT start_slot, UINT count, ID3D11Buffer* const* buffers, const UINT* strides, const UINT* offsets)
+	{
+		++_device._stats.state_sets;
+		if (start_slot == 0u && count)
+		{
+			_vertex_buffer = buffers[0];
+			_stride = strides[0];
+			_offset = offsets[0];
+		}
+	}
+
+	void context::IASetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset)
+	{
+		++_device._stats.state_sets;
+		_index_buffer = buffer;
+		_index_format = format;
+		_index_offset = offset;
+	}
+
+	void context::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		++_device._stats.state_sets;
+		_topology = topology;
+	}
+
+	void context::Begin(ID3D11Asynchronous* async)
+	{
+		auto* target = static_cast<query*>(async);
+		if (target->desc.Query != D3D11_QUERY_TIMESTAMP_DISJOINT)
+			return _device.error("Begin on a query that only ends");
+		target->ended = false;
+	}
+
+	void context::End(ID3D11Asynchronous* async)
+	{
+		++_device._stats.queries;
+
+		// a gpu that takes a microsecond between timestamps, at a 1ghz clock
+		auto* target = static_cast<query*>(async);
+		target->timestamp = _timestamp += 1000u;
+		target->ended = true;
+	}
+
+	HRESULT context::GetData(ID3D11Asynchronous* async, void* data, UINT size, UINT)
+	{
+		auto* target = static_cast<query*>(async);
+		if (!target->ended)
+			return S_FALSE;
+		if (!data)
+			return S_OK;
+
+		switch (target->desc.Query)
+		{
+		case D3D11_QUERY_TIMESTAMP:
+			if (size != sizeof(UINT64))
+				break;
+			std::memcpy(data, &target->timestamp, sizeof(UINT64));
+			return S_OK;
+		case D3D11_QUERY_TIMESTAMP_DISJOINT:
+		{
+			if (size != sizeof(D3D11_QUERY_DATA_TIMESTAMP_DISJOINT))
+				break;
+			const D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint{ 1000000000u, FALSE };
+			std::memcpy(data, &disjoint, sizeof(disjoint));
+			return S_OK;
+		}
+		case D3D11_QUERY_EVENT:
+		{
+			if (size != sizeof(BOOL))
+				break;
+			const BOOL done = TRUE;
+			std::memcpy(data, &done, sizeof(done));
+			return S_OK;
+		}
+		}
+
+		_device.error("GetData with the wrong size");
+		return E_FAIL;
+	}
+
+	void context::OMSetRenderTargets(UINT count, ID3D11RenderTargetView* const* views, ID3D11DepthStencilView*)
+	{
+		++_device._stats.state_sets;
+		_render_targets = { };
+		for (auto i = 0u; i < count && i < _render_targets.size(); ++i)
+			_render_targets[i] = views[i];
+	}
+
+	void context::OMSetBlendState(ID3D11BlendState* state, const FLOAT factor[4], UINT sample_mask)
+	{
+		++_device._stats.state_sets;
+		_blend_state = state;
+		if (factor)
+			std::copy(factor, factor + 4, _blend_factor.begin());
+		else
+			_blend_factor = { 1.f, 1.f, 1.f, 1.f };
+		_sample_mask = sample_mask;
+	}
+
+	void context::RSSetState(ID3D11RasterizerState* state)
+	{
+		++_device._stats.state_sets;
+		_rasterizer_state = state;
+	}
+
+	void context::RSSetScissorRects(UINT count, const D3D11_RECT* rects)
+	{
+		++_device._stats.state_sets;
+		_scissor_count = count ? 1u : 0u;
+		_scissor = count ? rects[0] : D3D11_RECT{ };
+	}
+
+	void context::UpdateSubresource(ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, const void* data, UINT row_pitch, UINT)
+	{
+		++_device._stats.updates;
+
+		if (auto* target = dynamic_cast<buffer*>(resource))
+		{
+			const auto left = box ? box->left : 0u;
+			const auto right = box ? box->right : target->desc.ByteWidth;
+			if (target->desc.Usage != D3D11_USAGE_DEFAULT || subresource != 0u || left > right || right > target->data.size())
+				return _device.error("UpdateSubresource outside a default buffer");
+
+			std::memcpy(target->data.data() + left, data, right - left);
+			_device._stats.bytes_updated += right - left;
+			return;
+		}
+
+		auto* target = dynamic_cast<texture*>(resource);
+		if (!target || target->desc.Usage != D3D11_USAGE_DEFAULT || subresource != 0u)
+			return _device.error("UpdateSubresource of something other than a default resource");
+
+		const auto left = box ? box->left : 0u;
+		const auto top = box ? box->top : 0u;
+		const auto right = box ? box->right : target->desc.Width;
+		const auto bottom = box ? box->bottom : target->desc.Height;
+		if (left > right || top > bottom || right > target->desc.Width || bottom > target->desc.Height)
+			return _device.error("UpdateSubresource box outside the texture");
+
+		const auto texel = texture::texel_size(target->desc.Format);
+		const auto row = (right - left) * texel;
+		if (row > row_pitch && bottom - top > 1u)
+			return _device.error("UpdateSubresource row pitch smaller than a row");
+
+		for (auto y = top; y < bottom; ++y)
+			std::memcpy(target->data.data() + y * target->pitch() + left * texel, static_cast<const std::uint8_t*>(data) + std::size_t{ y - top } * row_pitch, row);
+		_device._stats.bytes_updated += std::size_t{ row } * (bottom - top);
+	}
+
+	void context::ClearRenderTargetView(ID3D11RenderTargetView* view, const FLOAT colour[4])
+	{
+		++_device._stats.clears;
+
+		auto* target = dynamic_cast<texture*>(static_cast<host::view<ID3D11RenderTargetView>*>(view)->resource);
+		if (!target)
+			return _device.error("ClearRenderTargetView of a view without a texture");
+
+		std::uint8_t texel[4];
+		for (auto i = 0u; i < 4u; ++i)
+			texel[i] = static_cast<std::uint8_t>(std::clamp(colour[i], 0.f, 1.f) * 255.f + .5f);
+
+		const auto size = texture::texel_size(target->desc.Format);
+		if (target->desc.Format != DXGI_FORMAT_R8_UNORM && target->desc.Format != DXGI_FORMAT_R8G8B8A8_UNORM)
+			return _device.error("ClearRenderTargetView of a format the device does not clear");
+		for (std::size_t offset = 0u; offset < target->data.size(); offset += size)
+			std::memcpy(target->data.data() + offset, texel, size);
+	}
+
+	void context::VSGetConstantBuffers(UINT, UINT count, ID3D11Buffer** buffers)
+	{
+		++_device._stats.state_gets;
+		for (auto i = 0u; i < count; ++i)
+			buffers[i] = i ? nullptr : add_reference(_constant_buffer);
+	}
+
+	void context::PSGetShaderResources(UINT, UINT count, ID3D11ShaderResourceView** views)
+	{
+		++_device._stats.state_gets;
+		for (auto i = 0u; i < count; ++i)
+			views[i] = i ? nullptr : add_reference(_shader_resource);
+	}
+
+	void context::PSGetShader(ID3D11PixelShader** shader, ID3D11ClassInstance**, UINT* instance_count)
+	{
+		++_device._stats.state_gets;
+		*shader = add_reference(_pixel_shader);
+		if (instance_count)
+			*instance_count = 0u;
+	}
+
+	void context::PSGetSamplers(UINT, UINT count, ID3D11SamplerState** samplers)
+	{
+		++_device._stats.state_gets;
+		for (auto i = 0u; i < count; ++i)
+			samplers[i] = i ? nullptr : add_reference(_sampler);
+	}
+
+	void context::VSGetShader(ID3D11VertexShader** shader, ID3D11ClassInstance**, UINT* instance_count)
+	{
+		++_device._stats.state_gets;
+		*shader = add_reference(_vertex_shader);
+		if (instance_count)
+			*instance_count = 0u;
+	}
+
+	void context::IAGetInputLayout(ID3D11InputLayout** input_layout)
+	{
+		++_device._stats.state_gets;
+		*input_layout = add_reference(_input_layout);
+	}
+
+	void context::IAGetVertexBuffers(UINT, UINT count, ID3D11Buffer** buffers, UINT* strides, UINT* offsets)
+	{
+		++_device._stats.state_gets;
+		for (auto i = 0u; i < count; ++i)
+		{
+			buffers[i] = i ? nullptr : add_reference(_vertex_buffer);
+			strides[i] = i ? 0u : _stride;
+			offsets[i] = i ? 0u : _offset;
+		}
+	}
+
+	void context::IAGetIndexBuffer(ID3D11Buffer** buffer, DXGI_FORMAT* format, UINT* offset)
+	{
+		++_device._stats.state_gets;
+		*buffer = add_reference(_index_buffer);
+		*format = _index_format;
+		*offset = _index_offset;
+	}
+
+	void context::IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* topology)
+	{
+		++_device._stats.state_gets;
+		*topology = _topology;
+	}
+
+	void context::OMGetRenderTargets(UINT count, ID3D11RenderTargetView** views, ID3D11DepthStencilView** depth_stencil)
+	{
+		++_device._stats.state_gets;
+		for (auto i = 0u; i < count; ++i)
+			views[i] = i < _render_targets.size() ? add_reference(_render_targets[i]) : nullptr;
+		if (depth_stencil)
+			*depth_stencil = nullptr;
+	}
+
+	void context::OMGetBlendState(ID3D11BlendState** state, FLOAT factor[4], UINT* sample_mask)
+	{
+		++_device._stats.state_gets;
+		*state = add_reference(_blend_state);
+		std::copy(_blend_factor.begin(), _blend_factor.end(), factor);
+		*sample_mask = _sample_mask;
+	}
+
+	void context::RSGetState(ID3D11RasterizerState** state)
+	{
+		++_device._stats.state_gets;
+		*state = add_reference(_rasterizer_state);
+	}
+
+	void context::RSGetViewports(UINT* count, D3D11_VIEWPORT* viewports)
+	{
+		++_device._stats.state_gets;
+		if (*count)
+		{
+			viewports[0] = _device._options.viewport;
+			*count = 1u;
+		}
+	}
+
+	void context::RSGetScissorRects(UINT* count, D3D11_RECT* rects)
+	{
+		++_device._stats.state_gets;
+		if (rects && *count && _scissor_count)
+			rects[0] = _scissor;
+		*count = _scissor_count;
+	}
+
+	const D3D11_RECT& context::scissor() const
+	{
+		return _scissor;
+	}
+
+	device::device()
+		: device(options{ })
+	{ }
+
+	device::device(const options& options)
+		: _options(options)
+		, _stats()
+		, _live()
+		, _context(*this)
+		, _back_buffer()
+	{
+		D3D11_TEXTURE2D_DESC desc = { };
+		desc.Width = static_cast<UINT>(_options.viewport.TopLeftX + _options.viewport.Width);
+		desc.Height = static_cast<UINT>(_options.viewport.TopLeftY + _options.viewport.Height);
+		desc.MipLevels = 1u;
+		desc.ArraySize = 1u;
+		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.SampleDesc.Count = 1u;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_RENDER_TARGET;
+		_back_buffer = make<texture>(desc);
+		_stats = { };
+	}
+
+	device::~device() = default;
+
+	HRESULT device::QueryInterface(REFIID, void** object)
+	{
+		*object = this;
+		return S_OK;
+	}
+
+	ULONG device::AddRef()
+	{
+		return 1u;
+	}
+
+	ULONG device::Release()
+	{
+		return 1u;
+	}
+
+	template<typename T, typename... Args>
+	T* device::make(Args&&... args)
+	{
+		auto object = std::make_unique<T>(*this, std::forward<Args>(args)...);
+		auto* result = object.get();
+		_objects.push_back(std::move(object));
+		return result;
+	}
+
+	void device::error(const char* what)
+	{
+		++_stats.errors;
+		_last_error = what;
+	}
+
+	HRESULT device::CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Buffer** result)
+	{
+		if (!desc->ByteWidth || (desc->Usage == D3D11_USAGE_IMMUTABLE && !data) || ((desc->BindFlags & D3D11_BIND_CONSTANT_BUFFER) && desc->ByteWidth % 16u))
+		{
+			error("CreateBuffer with an invalid description");
+			return E_FAIL;
+		}
+
+		auto* created = make<buffer>(*desc);
+		if (data)
+			std::memcpy(created->data.data(), data->pSysMem, desc->ByteWidth);
+		*result = created;
+		return S_OK;
+	}
+
+	HRESULT device::CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Texture2D** result)
+	{
+		if (!desc->Width || !desc->Height || desc->MipLevels != 1u || desc->ArraySize != 1u || !texture::texel_size(desc->Format) || (desc->Usage == D3D11_USAGE_IMMUTABLE && !data))
+		{
+			error("CreateTexture2D with an invalid description");
+			return E_FAIL;
+		}
+
+		auto* created = make<texture>(*desc);
+		if (data)
+		{
+			const auto row = created->pitch();
+			for (auto y = 0u; y < desc->Height; ++y)
+				std::memcpy(created->data.data() + y * row, static_cast<const std::uint8_t*>(data->pSysMem) + std::size_t{ y } * data->SysMemPitch, row);
+		}
+		*result = created;
+		return S_OK;
+	}
+
+	HRESULT device::CreateShaderResourceView(ID3D11Resource* resource, const void*, ID3D11ShaderResourceView** result)
+	{
+		const auto* desc = texture_desc(resource);
+		if (!desc || !(desc->BindFlags & D3D11_BIND_SHADER_RESOURCE))
+		{
+			error("CreateShaderResourceView of a texture not bound as a shader resource");
+			return E_FAIL;
+		}
+		*result = make<view<ID3D11ShaderResourceView>>(resource);
+		return S_OK;
+	}
+
+	HRESULT device::CreateRenderTargetView(ID3D11Resource* resource, const void*, ID3D11RenderTargetView** result)
+	{
+		const auto* desc = texture_desc(resource);
+		if (!desc || !(desc->BindFlags & D3D11_BIND_RENDER_TARGET))
+		{
+			error("CreateRenderTargetView of a texture not bound as a render target");
+			return E_FAIL;
+		}
+		*result = make<view<ID3D11RenderTargetView>>(resource);
+		return S_OK;
+	}
+
+	HRESULT device::CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* elements, UINT count, const void* bytecode, SIZE_T size, ID3D11InputLayout** result)
+	{
+		if (!valid_bytecode(bytecode, size))
+		{
+			error("CreateInputLayout with invalid bytecode");
+			return E_FAIL;
+		}
+
+		// every input the shader reads that the input assembler supplies needs an element
+		std::uint32_t chunk_size;
+		const auto* signature = find_chunk(static_cast<const std::uint8_t*>(bytecode), "ISGN", chunk_size);
+		if (!signature || chunk_size < 8u)
+		{
+			error("CreateInputLayout with bytecode that has no input signature");
+			return E_FAIL;
+		}
+
+		const auto inputs = read32(signature);
+		for (auto i = 0u; i < inputs; ++i)
+		{
+			const auto* input = signature + 8 + i * 24u;
+			if (input + 24 > signature + chunk_size)
+			{
+				error("CreateInputLayout with a truncated input signature");
+				return E_FAIL;
+			}
+
+			// system values such as SV_VertexID are generated, not read from a buffer
+			if (read32(input + 8) != 0u)
+				continue;
+
+			const auto* name = reinterpret_cast<const char*>(signature + read32(input));
+			const auto index = read32(input + 4);
+			const auto matches = [&](const D3D11_INPUT_ELEMENT_DESC& element)
+			{
+				return element.SemanticIndex == index && same_semantic(element.SemanticName, name);
+			};
+			if (std::none_of(elements, elements + count, matches))
+			{
+				error("CreateInputLayout without an element for a shader input");
+				return E_FAIL;
+			}
+		}
+
+		*result = make<input_layout>(std::vector<D3D11_INPUT_ELEMENT_DESC>(elements, elements + count));
+		return S_OK;
+	}
+
+	HRESULT device::CreateVertexShader(const void* bytecode, SIZE_T size, ID3D11ClassLinkage*, ID3D11VertexShader** result)
+	{
+		std::uint32_t signature_size;
+		if (!valid_bytecode(bytecode, size) || !find_chunk(static_cast<const std::uint8_t*>(bytecode), "ISGN", signature_size))
+		{
+			error("CreateVertexShader with invalid bytecode");
+			return E_FAIL;
+		}
+		*result = make<shader<ID3D11VertexShader>>(bytecode, size);
+		return S_OK;
+	}
+
+	HRESULT device::CreatePixelShader(const void* bytecode, SIZE_T size, ID3D11ClassLinkage*, ID3D11PixelShader** result)
+	{
+		if (!valid_bytecode(bytecode, size))
+		{
+			error("CreatePixelShader with invalid bytecode");
+			return E_FAIL;
+		}
+		*result = make<shader<ID3D11PixelShader>>(bytecode, size);
+		return S_OK;
+	}
+
+	HRESULT device::CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** result)
+	{
+		*result = make<blend_state>(*desc);
+		return S_OK;
+	}
+
+	HRESULT device::CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** result)
+	{
+		*result = make<rasterizer_state>(*desc);
+		return S_OK;
+	}
+
+	HRESULT device::CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** result)
+	{
+		*result = make<sampler_state>(*desc);
+		return S_OK;
+	}
+
+	HRESULT device::CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** result)
+	{
+		*result = make<query>(*desc);
+		return S_OK;
+	}
+
+	void device::GetImmediateContext(ID3D11DeviceContext** device_context)
+	{
+		*device_context = &_context;
+	}
+
+	context& device::immediate()
+	{
+		return _context;
+	}
+
+	device::options& device::settings()
+	{
+		return _options;
+	}
+
+	statistics& device::stats()
+	{
+		return _stats;
+	}
+
+	std::vector<draw_record>& device::draws()
+	{
+		return _draws;
+	}
+
+	std::vector<map_record>& device::maps()
+	{
+		return _maps;
+	}
+
+	const std::string& device::last_error() const
+	{
+		return _last_error;
+	}
+
+	std::size_t device::live_objects() const
+	{
+		return _live;
+	}
+
+	std::vector<std::uint8_t>& device::storage(ID3D11Resource* resource)
+	{
+		if (auto* target = dynamic_cast<buffer*>(resource))
+			return target->data;
+		return dynamic_cast<texture&>(*resource).data;
+	}
+
+	const D3D11_TEXTURE2D_DESC* device::texture_desc(ID3D11Resource* resource)
+	{
+		auto* target = dynamic_cast<texture*>(resource);
+		return target ? &target->desc : nullptr;
+	}
+
+	const D3D11_BUFFER_DESC* device::buffer_desc(ID3D11Resource* resource)
+	{
+		auto* target = dynamic_cast<buffer*>(resource);
+		return target ? &target->desc : nullptr;
+	}
+
+	ID3D11Texture2D* device::back_buffer()
+	{
+		return _back_buffer;
+	}
+
+	swapchain::swapchain(device& device)
+		: _device(device)
+	{ }
+
+	HRESULT swapchain::QueryInterface(REFIID, void** object)
+	{
+		*object = this;
+		return S_OK;
+	}
+
+	ULONG swapchain::AddRef()
+	{
+		return 1u;
+	}
+
+	ULONG swapchain::Release()
+	{
+		return 1u;
+	}
+
+	HRESULT swapchain::GetDevice(REFIID, void** device)
+	{
+		*device = static_cast<ID3D11Device*>(&_device);
+		return S_OK;
+	}
+
+	HRESULT swapchain::GetBuffer(UINT buffer, REFIID, void** surface)
+	{
+		if (buffer != 0u)
+			return E_FAIL;
+		auto* back_buffer = _device.back_buffer();
+		back_buffer->AddRef();
+		*surface = back_buffer;
+		return S_OK;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <d3d11.h>
+
+namespace host
+{
+	// everything the renderer asked the device and context for since the last reset
+	struct statistics
+	{
+		// Draw, DrawIndexed and DrawInstanced calls, and what they drew
+		std::size_t draws;
+		std::size_t indices;
+		std::size_t instances;
+		std::size_t maps;
+		std::size_t discards;
+		// UpdateSubresource calls and the bytes they copied
+		std::size_t updates;
+		std::size_t bytes_updated;
+		std::size_t clears;
+		// every Set call on the context, and every Get call
+		std::size_t state_sets;
+		std::size_t state_gets;
+		std::size_t queries;
+		std::size_t objects_created;
+		// calls the real runtime would have rejected, see device::last_error
+		std::size_t errors;
+	};
+
+	// one draw with its vertices resolved through the bound index buffer, in the order the
+	// gpu would assemble them. instanced draws keep the instance records instead
+	struct draw_record
+	{
+		D3D11_PRIMITIVE_TOPOLOGY topology;
+		UINT stride;
+		// vertices per instance for an instanced draw, 0 otherwise
+		UINT instance_vertices;
+		std::vector<std::uint8_t> data;
+		// bound when it was drawn, empty if none was
+		D3D11_RECT scissor;
+
+		std::size_t count() const
+		{
+			return stride ? data.size() / stride : 0u;
+		}
+	};
+
+	// one Map of a buffer and how it was mapped
+	struct map_record
+	{
+		ID3D11Buffer* buffer;
+		D3D11_MAP type;
+	};
+
+	class device;
+	template<typename Interface>
+	class object;
+
+	// records and validates everything the renderer does. bound state is kept so the Get
+	// calls return it, the way the renderer backs up and restores the game's state
+	class context final : public ID3D11DeviceContext
+	{
+	public:
+		explicit context(device& owner);
+
+		HRESULT QueryInterface(REFIID riid, void** object) override;
+		ULONG AddRef() override;
+		ULONG Release() override;
+
+		void VSSetConstantBuffers(UINT start_slot, UINT count, ID3D11Buffer* const* buffers) override;
+		void PSSetShaderResources(UINT start_slot, UINT count, ID3D11ShaderResourceView* const* views) override;
+		void PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* instances, UINT instance_count) override;
+		void PSSetSamplers(UINT start_slot, UINT count, ID3D11SamplerState* const* samplers) override;
+		void VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* instances, UINT instance_count) override;
+		void DrawIndexed(UINT index_count, UINT start_index, INT base_vertex) override;
+		void Draw(UINT vertex_count, UINT start_vertex) override;
+		HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP map_type, UINT flags, D3D11_MAPPED_SUBRESOURCE* mapped) override;
+		void Unmap(ID3D11Resource* resource, UINT subresource) override;
+		void IASetInputLayout(ID3D11InputLayout* input_layout) override;
+		void IASetVertexBuffers(UINT start_slot, UINT count, ID3D11Buffer* const* buffers, const UINT* strides, const UINT* offsets) override;
+		void IASetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset) override;
+		void DrawInstanced(UINT vertex_count, UINT instance_count, UINT start_vertex, UINT start_instance) override;
+		void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) override;
+		void Begin(ID3D11Asynchronous* async) override;
+		void End(ID3D11Asynchronous* async) override;
+		HRESULT GetData(ID3D11Asynchronous* async, void* data, UINT size, UINT flags) override;
+		void OMSetRenderTargets(UINT count, ID3D11RenderTargetView* const* views, ID3D11DepthStencilView* depth_stencil) override;
+		void OMSetBlendState(ID3D11BlendState* state, const FLOAT factor[4], UINT sample_mask) override;
+		void RSSetState(ID3D11RasterizerState* state) override;
+		void RSSetScissorRects(UINT count, const D3D11_RECT* rects) override;
+		void UpdateSubresource(ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, const void* data, UINT row_pitch, UINT depth_pitch) override;
+		void ClearRenderTargetView(ID3D11RenderTargetView* view, const FLOAT colour[4]) override;
+		void VSGetConstantBuffers(UINT start_slot, UINT count, ID3D11Buffer** buffers) override;
+		void PSGetShaderResources(UINT start_slot, UINT count, ID3D11ShaderResourceView** views) override;
+		void PSGetShader(ID3D11PixelShader** shader, ID3D11ClassInstance** instances, UINT* instance_count) override;
+		void PSGetSamplers(UINT start_slot, UINT count, ID3D11SamplerState** samplers) override;
+		void VSGetShader(ID3D11VertexShader** shader, ID3D11ClassInstance** instances, UINT* instance_count) override;
+		void IAGetInputLayout(ID3D11InputLayout** input_layout) override;
+		void IAGetVertexBuffers(UINT start_slot, UINT count, ID3D11Buffer** buffers, UINT* strides, UINT* offsets) override;
+		void IAGetIndexBuffer(ID3D11Buffer** buffer, DXGI_FORMAT* format, UINT* offset) override;
+		void IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* topology) override;
+		void OMGetRenderTargets(UINT count, ID3D11RenderTargetView** views, ID3D11DepthStencilView** depth_stencil) override;
+		void OMGetBlendState(ID3D11BlendState** state, FLOAT factor[4], UINT* sample_mask) override;
+		void RSGetState(ID3D11RasterizerState** state) override;
+		void RSGetViewports(UINT* count, D3D11_VIEWPORT* viewports) override;
+		void RSGetScissorRects(UINT* count, D3D11_RECT* rects) override;
+
+		// the scissor rect last set, and whether a draw was clipped to it
+		const D3D11_RECT& scissor() const;
+	private:
+		// checks a draw against the bound buffers and captures it if the device asks for that
+		void draw(UINT index_count, UINT start_index, INT base_vertex, bool indexed);
+
+		device& _device;
+		ID3D11Buffer* _constant_buffer;
+		ID3D11ShaderResourceView* _shader_resource;
+		ID3D11SamplerState* _sampler;
+		ID3D11VertexShader* _vertex_shader;
+		ID3D11PixelShader* _pixel_shader;
+		ID3D11InputLayout* _input_layout;
+		ID3D11Buffer* _vertex_buffer;
+		UINT _stride;
+		UINT _offset;
+		ID3D11Buffer* _index_buffer;
+		DXGI_FORMAT _index_format;
+		UINT _index_offset;
+		D3D11_PRIMITIVE_TOPOLOGY _topology;
+		std::array<ID3D11RenderTargetView*, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT> _render_targets;
+		ID3D11BlendState* _blend_state;
+		std::array<FLOAT, 4> _blend_factor;
+		UINT _sample_mask;
+		ID3D11RasterizerState* _rasterizer_state;
+		UINT _scissor_count;
+		D3D11_RECT _scissor;
+		std::uint64_t _timestamp;
+	};
+
+	// a device whose resources are plain memory, so buffers and textures can be read back
+	// after a frame. it owns everything it creates, objects are only marked released
+	class device final : public ID3D11Device
+	{
+		friend class context;
+		template<typename Interface>
+		friend class object;
+	public:
+		struct options
+		{
+			// range check draws, maps and updates, and fill discarded buffers with garbage
+			bool validate = true;
+			// keep a draw_record of every draw and a map_record of every map
+			bool capture = false;
+			// what RSGetViewports reports, and the size of the back buffer
+			D3D11_VIEWPORT viewport = { 0.f, 0.f, 1280.f, 720.f, 0.f, 1.f };
+		};
+
+		device();
+		explicit device(const options& options);
+		~device();
+
+		HRESULT QueryInterface(REFIID riid, void** object) override;
+		ULONG AddRef() override;
+		ULONG Release() override;
+
+		HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Buffer** buffer) override;
+		HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Texture2D** texture) override;
+		HRESULT CreateShaderResourceView(ID3D11Resource* resource, const void* desc, ID3D11ShaderResourceView** view) override;
+		HRESULT CreateRenderTargetView(ID3D11Resource* resource, const void* desc, ID3D11RenderTargetView** view) override;
+		HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* elements, UINT count, const void* bytecode, SIZE_T size, ID3D11InputLayout** input_layout) override;
+		HRESULT CreateVertexShader(const void* bytecode, SIZE_T size, ID3D11ClassLinkage* linkage, ID3D11VertexShader** shader) override;
+		HRESULT CreatePixelShader(const void* bytecode, SIZE_T size, ID3D11ClassLinkage* linkage, ID3D11PixelShader** shader) override;
+		HRESULT CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** state) override;
+		HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** state) override;
+		HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** state) override;
+		HRESULT CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** query) override;
+		void GetImmediateContext(ID3D11DeviceContext** device_context) override;
+
+		context& immediate();
+		options& settings();
+		statistics& stats();
+		std::vector<draw_record>& draws();
+		std::vector<map_record>& maps();
+		// the reason for the last error counted in statistics::errors
+		const std::string& last_error() const;
+		// objects created and not yet released down to no references
+		std::size_t live_objects() const;
+
+		// the memory behind a buffer or texture, rows of a texture are tightly packed
+		static std::vector<std::uint8_t>& storage(ID3D11Resource* resource);
+		static const D3D11_TEXTURE2D_DESC* texture_desc(ID3D11Resource* resource);
+		static const D3D11_BUFFER_DESC* buffer_desc(ID3D11Resource* resource);
+		// the swapchain's texture, sized to the viewport
+		ID3D11Texture2D* back_buffer();
+	private:
+		template<typename T, typename... Args>
+		T* make(Args&&... args);
+		void error(const char* what);
+
+		options _options;
+		statistics _stats;
+		std::vector<draw_record> _draws;
+		std::vector<map_record> _maps;
+		std::string _last_error;
+		std::vector<std::unique_ptr<IUnknown>> _objects;
+		std::size_t _live;
+		context _context;
+		ID3D11Texture2D* _back_buffer;
+	};
+
+	class swapchain final : public IDXGISwapChain
+	{
+	public:
+		explicit swapchain(device& device);
+
+		HRESULT QueryInterface(REFIID riid, void** object) override;
+		ULONG AddRef() override;
+		ULONG Release() override;
+		HRESULT GetDevice(REFIID riid, void** device) override;
+		HRESULT GetBuffer(UINT buffer, REFIID riid, void** surface) override;
+	private:
+		device& _device;
+	};
+
+	// whether bytecode is a dxbc container with the hash the runtime checks before creating
+	// a shader from it
+	bool valid_bytecode(const void* bytecode, std::size_t size);
+}
\ No newline at end of file
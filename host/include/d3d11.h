@@ -0,0 +1,394 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// the part of the windows and direct3d 11 headers the renderer uses, so it can be built and
+// driven by host::device on other platforms. only declarations, the values match the sdk
+using BYTE = std::uint8_t;
+using UINT8 = std::uint8_t;
+using UINT = std::uint32_t;
+using INT = std::int32_t;
+using LONG = std::int32_t;
+using ULONG = std::uint32_t;
+using UINT64 = std::uint64_t;
+using SIZE_T = std::size_t;
+using BOOL = int;
+using FLOAT = float;
+using HRESULT = std::int32_t;
+using LPCSTR = const char*;
+
+#define TRUE 1
+#define FALSE 0
+#define S_OK static_cast<HRESULT>(0)
+#define S_FALSE static_cast<HRESULT>(1)
+#define E_FAIL static_cast<HRESULT>(0x80004005)
+#define E_OUTOFMEMORY static_cast<HRESULT>(0x8007000E)
+#define SUCCEEDED(hr) (static_cast<HRESULT>(hr) >= 0)
+#define FAILED(hr) (static_cast<HRESULT>(hr) < 0)
+
+struct GUID
+{
+	std::uint32_t data1;
+	std::uint16_t data2;
+	std::uint16_t data3;
+	std::uint8_t data4[8];
+};
+using IID = GUID;
+using REFIID = const IID&;
+#define __uuidof(type) (::IID{ })
+
+struct RECT
+{
+	LONG left;
+	LONG top;
+	LONG right;
+	LONG bottom;
+};
+
+#define D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT 8
+#define D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE 16
+#define D3D11_APPEND_ALIGNED_ELEMENT 0xffffffffu
+#define D3D11_ASYNC_GETDATA_DONOTFLUSH 0x1u
+
+enum DXGI_FORMAT
+{
+	DXGI_FORMAT_UNKNOWN = 0,
+	DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+	DXGI_FORMAT_R32G32_FLOAT = 16,
+	DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+	DXGI_FORMAT_R16G16_UNORM = 35,
+	DXGI_FORMAT_R32_FLOAT = 41,
+	DXGI_FORMAT_R32_UINT = 42,
+	DXGI_FORMAT_R16_UINT = 57,
+	DXGI_FORMAT_R8_UNORM = 61
+};
+
+struct DXGI_SAMPLE_DESC
+{
+	UINT Count;
+	UINT Quality;
+};
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5
+};
+
+enum D3D11_USAGE
+{
+	D3D11_USAGE_DEFAULT = 0,
+	D3D11_USAGE_IMMUTABLE = 1,
+	D3D11_USAGE_DYNAMIC = 2,
+	D3D11_USAGE_STAGING = 3
+};
+
+enum D3D11_BIND_FLAG
+{
+	D3D11_BIND_VERTEX_BUFFER = 0x1,
+	D3D11_BIND_INDEX_BUFFER = 0x2,
+	D3D11_BIND_CONSTANT_BUFFER = 0x4,
+	D3D11_BIND_SHADER_RESOURCE = 0x8,
+	D3D11_BIND_RENDER_TARGET = 0x20
+};
+
+enum D3D11_CPU_ACCESS_FLAG
+{
+	D3D11_CPU_ACCESS_WRITE = 0x10000,
+	D3D11_CPU_ACCESS_READ = 0x20000
+};
+
+enum D3D11_MAP
+{
+	D3D11_MAP_READ = 1,
+	D3D11_MAP_WRITE = 2,
+	D3D11_MAP_READ_WRITE = 3,
+	D3D11_MAP_WRITE_DISCARD = 4,
+	D3D11_MAP_WRITE_NO_OVERWRITE = 5
+};
+
+enum D3D11_INPUT_CLASSIFICATION
+{
+	D3D11_INPUT_PER_VERTEX_DATA = 0,
+	D3D11_INPUT_PER_INSTANCE_DATA = 1
+};
+
+enum D3D11_BLEND
+{
+	D3D11_BLEND_ZERO = 1,
+	D3D11_BLEND_ONE = 2,
+	D3D11_BLEND_SRC_ALPHA = 5,
+	D3D11_BLEND_INV_SRC_ALPHA = 6
+};
+
+enum D3D11_BLEND_OP
+{
+	D3D11_BLEND_OP_ADD = 1
+};
+
+enum D3D11_COLOR_WRITE_ENABLE
+{
+	D3D11_COLOR_WRITE_ENABLE_ALL = 0xf
+};
+
+enum D3D11_FILTER
+{
+	D3D11_FILTER_MIN_MAG_MIP_POINT = 0,
+	D3D11_FILTER_MIN_MAG_MIP_LINEAR = 0x15
+};
+
+enum D3D11_TEXTURE_ADDRESS_MODE
+{
+	D3D11_TEXTURE_ADDRESS_WRAP = 1,
+	D3D11_TEXTURE_ADDRESS_CLAMP = 3
+};
+
+enum D3D11_COMPARISON_FUNC
+{
+	D3D11_COMPARISON_NEVER = 1
+};
+
+enum D3D11_FILL_MODE
+{
+	D3D11_FILL_WIREFRAME = 2,
+	D3D11_FILL_SOLID = 3
+};
+
+enum D3D11_CULL_MODE
+{
+	D3D11_CULL_NONE = 1,
+	D3D11_CULL_FRONT = 2,
+	D3D11_CULL_BACK = 3
+};
+
+enum D3D11_QUERY
+{
+	D3D11_QUERY_EVENT = 0,
+	D3D11_QUERY_TIMESTAMP = 2,
+	D3D11_QUERY_TIMESTAMP_DISJOINT = 3
+};
+
+struct D3D11_BUFFER_DESC
+{
+	UINT ByteWidth;
+	D3D11_USAGE Usage;
+	UINT BindFlags;
+	UINT CPUAccessFlags;
+	UINT MiscFlags;
+	UINT StructureByteStride;
+};
+
+struct D3D11_TEXTURE2D_DESC
+{
+	UINT Width;
+	UINT Height;
+	UINT MipLevels;
+	UINT ArraySize;
+	DXGI_FORMAT Format;
+	DXGI_SAMPLE_DESC SampleDesc;
+	D3D11_USAGE Usage;
+	UINT BindFlags;
+	UINT CPUAccessFlags;
+	UINT MiscFlags;
+};
+
+struct D3D11_SUBRESOURCE_DATA
+{
+	const void* pSysMem;
+	UINT SysMemPitch;
+	UINT SysMemSlicePitch;
+};
+
+struct D3D11_MAPPED_SUBRESOURCE
+{
+	void* pData;
+	UINT RowPitch;
+	UINT DepthPitch;
+};
+
+struct D3D11_BOX
+{
+	UINT left;
+	UINT top;
+	UINT front;
+	UINT right;
+	UINT bottom;
+	UINT back;
+};
+
+struct D3D11_VIEWPORT
+{
+	FLOAT TopLeftX;
+	FLOAT TopLeftY;
+	FLOAT Width;
+	FLOAT Height;
+	FLOAT MinDepth;
+	FLOAT MaxDepth;
+};
+
+using D3D11_RECT = RECT;
+
+struct D3D11_INPUT_ELEMENT_DESC
+{
+	LPCSTR SemanticName;
+	UINT SemanticIndex;
+	DXGI_FORMAT Format;
+	UINT InputSlot;
+	UINT AlignedByteOffset;
+	D3D11_INPUT_CLASSIFICATION InputSlotClass;
+	UINT InstanceDataStepRate;
+};
+
+struct D3D11_RENDER_TARGET_BLEND_DESC
+{
+	BOOL BlendEnable;
+	D3D11_BLEND SrcBlend;
+	D3D11_BLEND DestBlend;
+	D3D11_BLEND_OP BlendOp;
+	D3D11_BLEND SrcBlendAlpha;
+	D3D11_BLEND DestBlendAlpha;
+	D3D11_BLEND_OP BlendOpAlpha;
+	UINT8 RenderTargetWriteMask;
+};
+
+struct D3D11_BLEND_DESC
+{
+	BOOL AlphaToCoverageEnable;
+	BOOL IndependentBlendEnable;
+	D3D11_RENDER_TARGET_BLEND_DESC RenderTarget[8];
+};
+
+struct D3D11_SAMPLER_DESC
+{
+	D3D11_FILTER Filter;
+	D3D11_TEXTURE_ADDRESS_MODE AddressU;
+	D3D11_TEXTURE_ADDRESS_MODE AddressV;
+	D3D11_TEXTURE_ADDRESS_MODE AddressW;
+	FLOAT MipLODBias;
+	UINT MaxAnisotropy;
+	D3D11_COMPARISON_FUNC ComparisonFunc;
+	FLOAT BorderColor[4];
+	FLOAT MinLOD;
+	FLOAT MaxLOD;
+};
+
+struct D3D11_RASTERIZER_DESC
+{
+	D3D11_FILL_MODE FillMode;
+	D3D11_CULL_MODE CullMode;
+	BOOL FrontCounterClockwise;
+	INT DepthBias;
+	FLOAT DepthBiasClamp;
+	FLOAT SlopeScaledDepthBias;
+	BOOL DepthClipEnable;
+	BOOL ScissorEnable;
+	BOOL MultisampleEnable;
+	BOOL AntialiasedLineEnable;
+};
+
+struct D3D11_QUERY_DESC
+{
+	D3D11_QUERY Query;
+	UINT MiscFlags;
+};
+
+struct D3D11_QUERY_DATA_TIMESTAMP_DISJOINT
+{
+	UINT64 Frequency;
+	BOOL Disjoint;
+};
+
+struct IUnknown
+{
+	virtual HRESULT QueryInterface(REFIID riid, void** object) = 0;
+	virtual ULONG AddRef() = 0;
+	virtual ULONG Release() = 0;
+	virtual ~IUnknown() = default;
+};
+
+struct ID3D11DeviceChild : IUnknown { };
+struct ID3D11Resource : ID3D11DeviceChild { };
+struct ID3D11Buffer : ID3D11Resource { };
+struct ID3D11Texture2D : ID3D11Resource { };
+struct ID3D11View : ID3D11DeviceChild { };
+struct ID3D11ShaderResourceView : ID3D11View { };
+struct ID3D11RenderTargetView : ID3D11View { };
+struct ID3D11DepthStencilView : ID3D11View { };
+struct ID3D11VertexShader : ID3D11DeviceChild { };
+struct ID3D11PixelShader : ID3D11DeviceChild { };
+struct ID3D11ClassInstance : ID3D11DeviceChild { };
+struct ID3D11ClassLinkage : ID3D11DeviceChild { };
+struct ID3D11InputLayout : ID3D11DeviceChild { };
+struct ID3D11BlendState : ID3D11DeviceChild { };
+struct ID3D11SamplerState : ID3D11DeviceChild { };
+struct ID3D11RasterizerState : ID3D11DeviceChild { };
+struct ID3D11Asynchronous : ID3D11DeviceChild { };
+struct ID3D11Query : ID3D11Asynchronous { };
+
+struct ID3D11DeviceContext : ID3D11DeviceChild
+{
+	virtual void VSSetConstantBuffers(UINT start_slot, UINT count, ID3D11Buffer* const* buffers) = 0;
+	virtual void PSSetShaderResources(UINT start_slot, UINT count, ID3D11ShaderResourceView* const* views) = 0;
+	virtual void PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* instances, UINT instance_count) = 0;
+	virtual void PSSetSamplers(UINT start_slot, UINT count, ID3D11SamplerState* const* samplers) = 0;
+	virtual void VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* instances, UINT instance_count) = 0;
+	virtual void DrawIndexed(UINT index_count, UINT start_index, INT base_vertex) = 0;
+	virtual void Draw(UINT vertex_count, UINT start_vertex) = 0;
+	virtual HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP map_type, UINT flags, D3D11_MAPPED_SUBRESOURCE* mapped) = 0;
+	virtual void Unmap(ID3D11Resource* resource, UINT subresource) = 0;
+	virtual void IASetInputLayout(ID3D11InputLayout* input_layout) = 0;
+	virtual void IASetVertexBuffers(UINT start_slot, UINT count, ID3D11Buffer* const* buffers, const UINT* strides, const UINT* offsets) = 0;
+	virtual void IASetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset) = 0;
+	virtual void DrawInstanced(UINT vertex_count, UINT instance_count, UINT start_vertex, UINT start_instance) = 0;
+	virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) = 0;
+	virtual void Begin(ID3D11Asynchronous* async) = 0;
+	virtual void End(ID3D11Asynchronous* async) = 0;
+	virtual HRESULT GetData(ID3D11Asynchronous* async, void* data, UINT size, UINT flags) = 0;
+	virtual void OMSetRenderTargets(UINT count, ID3D11RenderTargetView* const* views, ID3D11DepthStencilView* depth_stencil) = 0;
+	virtual void OMSetBlendState(ID3D11BlendState* state, const FLOAT factor[4], UINT sample_mask) = 0;
+	virtual void RSSetState(ID3D11RasterizerState* state) = 0;
+	virtual void RSSetScissorRects(UINT count, const D3D11_RECT* rects) = 0;
+	virtual void UpdateSubresource(ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, const void* data, UINT row_pitch, UINT depth_pitch) = 0;
+	virtual void ClearRenderTargetView(ID3D11RenderTargetView* view, const FLOAT colour[4]) = 0;
+	virtual void VSGetConstantBuffers(UINT start_slot, UINT count, ID3D11Buffer** buffers) = 0;
+	virtual void PSGetShaderResources(UINT start_slot, UINT count, ID3D11ShaderResourceView** views) = 0;
+	virtual void PSGetShader(ID3D11PixelShader** shader, ID3D11ClassInstance** instances, UINT* instance_count) = 0;
+	virtual void PSGetSamplers(UINT start_slot, UINT count, ID3D11SamplerState** samplers) = 0;
+	virtual void VSGetShader(ID3D11VertexShader** shader, ID3D11ClassInstance** instances, UINT* instance_count) = 0;
+	virtual void IAGetInputLayout(ID3D11InputLayout** input_layout) = 0;
+	virtual void IAGetVertexBuffers(UINT start_slot, UINT count, ID3D11Buffer** buffers, UINT* strides, UINT* offsets) = 0;
+	virtual void IAGetIndexBuffer(ID3D11Buffer** buffer, DXGI_FORMAT* format, UINT* offset) = 0;
+	virtual void IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* topology) = 0;
+	virtual void OMGetRenderTargets(UINT count, ID3D11RenderTargetView** views, ID3D11DepthStencilView** depth_stencil) = 0;
+	virtual void OMGetBlendState(ID3D11BlendState** state, FLOAT factor[4], UINT* sample_mask) = 0;
+	virtual void RSGetState(ID3D11RasterizerState** state) = 0;
+	virtual void RSGetViewports(UINT* count, D3D11_VIEWPORT* viewports) = 0;
+	virtual void RSGetScissorRects(UINT* count, D3D11_RECT* rects) = 0;
+};
+
+struct ID3D11Device : IUnknown
+{
+	virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Buffer** buffer) = 0;
+	virtual HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* desc, const D3D11_SUBRESOURCE_DATA* data, ID3D11Texture2D** texture) = 0;
+	virtual HRESULT CreateShaderResourceView(ID3D11Resource* resource, const void* desc, ID3D11ShaderResourceView** view) = 0;
+	virtual HRESULT CreateRenderTargetView(ID3D11Resource* resource, const void* desc, ID3D11RenderTargetView** view) = 0;
+	virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* elements, UINT count, const void* bytecode, SIZE_T size, ID3D11InputLayout** input_layout) = 0;
+	virtual HRESULT CreateVertexShader(const void* bytecode, SIZE_T size, ID3D11ClassLinkage* linkage, ID3D11VertexShader** shader) = 0;
+	virtual HRESULT CreatePixelShader(const void* bytecode, SIZE_T size, ID3D11ClassLinkage* linkage, ID3D11PixelShader** shader) = 0;
+	virtual HRESULT CreateBlendState(const D3D11_BLEND_DESC* desc, ID3D11BlendState** state) = 0;
+	virtual HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC* desc, ID3D11RasterizerState** state) = 0;
+	virtual HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* desc, ID3D11SamplerState** state) = 0;
+	virtual HRESULT CreateQuery(const D3D11_QUERY_DESC* desc, ID3D11Query** query) = 0;
+	virtual void GetImmediateContext(ID3D11DeviceContext** device_context) = 0;
+};
+
+struct IDXGISwapChain : IUnknown
+{
+	virtual HRESULT GetDevice(REFIID riid, void** device) = 0;
+	virtual HRESULT GetBuffer(UINT buffer, REFIID riid, void** surface) = 0;
+};
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+#include <cpuid.h>
+#include <x86intrin.h>
+
+// cpuid.h names a macro __cpuid, msvc a function
+#undef __cpuid
+
+// cpuid.h already has the msvc __cpuidex
+inline void __cpuid(int info[4], int leaf)
+{
+	__cpuidex(info, leaf, 0);
+}
+
+// msvc ends the process without unwinding, like abort without handlers
+[[noreturn]] inline void __fastfail(unsigned int)
+{
+	__builtin_trap();
+}
\ No newline at end of file
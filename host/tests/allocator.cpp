@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "memory_manager.hpp"
+#include "check.hpp"
+
+// replays a recorded-style trace of renderer allocations against memory::alloc and
+// memory::free, checking every block against a shadow copy of the live set
+namespace
+{
+	struct operation
+	{
+		// index into the live set, freed if occupied and allocated otherwise
+		std::size_t slot;
+		std::size_t size;
+	};
+
+	struct live_block
+	{
+		std::uint8_t* data;
+		std::size_t size;
+		std::uint8_t tag;
+	};
+
+	// mostly small vectors and strings with a few large frame buffers, the mix the renderer
+	// and a game's overlay code make
+	std::vector<operation> make_trace(std::size_t count, std::size_t slots)
+	{
+		std::mt19937 random(0x7f4au);
+		std::uniform_int_distribution<std::size_t> slot(0u, slots - 1u), small(1u, 256u), large(1024u, 12288u), kind(0u, 31u);
+
+		std::vector<operation> trace(count);
+		for (auto& operation : trace)
+			operation = { slot(random), kind(random) == 0u ? large(random) : small(random) };
+		return trace;
+	}
+
+	bool intact(const live_block& block)
+	{
+		for (auto i = 0u; i < block.size; ++i)
+		{
+			if (block.data[i] != block.tag)
+				return false;
+		}
+		return true;
+	}
+
+	void replay()
+	{
+		const auto initial = memory::stats();
+		CHECK(initial.used == 0u && initial.allocations == 0u && initial.largest_free == initial.free);
+
+		constexpr auto slots = 192u;
+		const auto trace = make_trace(200000u, slots);
+		std::vector<live_block> live(slots);
+
+		auto live_count = 0u;
+		auto live_bytes = std::size_t{ };
+		auto expected_failures = std::size_t{ };
+		auto tag = std::uint8_t{ };
+		auto corrupted = 0u;
+
+		for (const auto& operation : trace)
+		{
+			auto& block = live[operation.slot];
+			if (block.data)
+			{
+				corrupted += !intact(block);
+				memory::free(block.data);
+				live_bytes -= block.size;
+				--live_count;
+				block = { };
+				continue;
+			}
+
+			// alloc has to agree with can_alloc, a failure is only allowed when nothing fits
+			const auto fits = memory::can_alloc(operation.size);
+			auto* data = static_cast<std::uint8_t*>(memory::alloc(operation.size));
+			CHECK((data != nullptr) == fits);
+			if (!data)
+			{
+				++expected_failures;
+				continue;
+			}
+
+			CHECK(reinterpret_cast<std::uintptr_t>(data) % 16u == 0u);
+			block = { data, operation.size, ++tag };
+			std::fill(data, data + operation.size, block.tag);
+			live_bytes += operation.size;
+			++live_count;
+
+			const auto stats = memory::stats();
+			CHECK(stats.allocations == live_count);
+			CHECK(stats.used >= live_bytes && stats.used + stats.free <= stats.capacity);
+		}
+		CHECK(corrupted == 0u);
+		CHECK(memory::stats().failures == expected_failures);
+
+		const auto stats = memory::stats();
+		std::printf("live %u blocks, %zu bytes used, %zu free in %zu blocks, fragmentation %.3f, %zu failed allocs\n",
+			live_count, stats.used, stats.free, stats.free_blocks, stats.fragmentation(), stats.failures);
+
+		for (auto& block : live)
+		{
+			if (block.data)
+			{
+				corrupted += !intact(block);
+				memory::free(block.data);
+			}
+		}
+		CHECK(corrupted == 0u);
+
+		// every neighbour coalesced again, so the heap is back to the single block it started as
+		const auto empty = memory::stats();
+		CHECK(empty.used == 0u && empty.allocations == 0u);
+		CHECK(empty.free == initial.free && empty.largest_free == initial.largest_free && empty.free_blocks == 1u);
+	}
+
+	void oversized()
+	{
+		// requests past the largest size class find nothing instead of reading past the lists
+		const auto before = memory::stats();
+		for (const auto size : { std::size_t{ memory::buffer_size }, std::size_t{ memory::buffer_size } * 4u, std::size_t{ 1u } << 40u })
+			CHECK(!memory::can_alloc(size) && memory::alloc(size) == nullptr);
+		CHECK(memory::stats().failures == before.failures + 3u && memory::stats().free == before.free);
+	}
+
+	// the first-fit walk the heap used before, kept as the reference the timing compares
+	// against. it never merges neighbours, so a freed block only takes what fits its old gap.
+	// two of its faults are patched so the trace can run: a gap is only split when the rest
+	// holds a header, and the buffer has room for the header written past the last block
+	namespace first_fit
+	{
+		struct block
+		{
+			std::size_t size;
+			block* next;
+		};
+
+		std::uint8_t buffer[memory::buffer_size + sizeof(block)];
+
+		void* alloc(std::size_t size)
+		{
+			if (size == 0)
+				return nullptr;
+
+			auto current = reinterpret_cast<block*>(buffer);
+
+			while (true)
+			{
+				const auto gap = current->next ? (uint64_t)current->next - ((uint64_t)current + sizeof(block)) : 0ull;
+				if (current->size == 0ull && (!current->next || gap == size || gap >= size + sizeof(block)))
+					break;
+				current = current->next;
+			}
+
+			if ((uint64_t)current + sizeof(block) + size > (uint64_t)buffer + memory::buffer_size)
+				return nullptr;
+
+			current->size = size;
+
+			auto next = current->next;
+			current->next = reinterpret_cast<block*>((uint64_t)current + sizeof(block) + size);
+			if (!current->next->next)
+				current->next->next = next;
+
+			return reinterpret_cast<void*>((uint64_t)current + sizeof(block));
+		}
+
+		void free(void* data)
+		{
+			auto current = reinterpret_cast<block*>((uint64_t)data - sizeof(block));
+			memset(data, 0, current->size);
+			current->size = 0;
+		}
+	}
+
+	// the same trace without the shadow checks, for the time per operation, and the number
+	// of allocations that found no block
+	template<typename Alloc, typename Free>
+	std::pair<double, std::size_t> run(const std::vector<operation>& trace, std::size_t slots, Alloc&& alloc, Free&& free)
+	{
+		std::vector<void*> live(slots);
+		auto failures = std::size_t{ };
+
+		const auto start = std::chrono::steady_clock::now();
+		for (const auto& operation : trace)
+		{
+			auto*& block = live[operation.slot];
+			if (block)
+			{
+				free(block);
+				block = nullptr;
+			}
+			else
+			{
+				block = alloc(operation.size);
+				failures += !block;
+			}
+		}
+		const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		for (auto* block : live)
+		{
+			if (block)
+				free(block);
+		}
+		return { elapsed / static_cast<double>(trace.size()), failures };
+	}
+
+	void timing()
+	{
+		constexpr auto slots = 128u;
+		const auto trace = make_trace(1000000u, slots);
+
+		const auto [segregated, segregated_failures] = run(trace, slots, memory::alloc, memory::free);
+		CHECK(memory::stats().used == 0u);
+		const auto [walk, walk_failures] = run(trace, slots, first_fit::alloc, first_fit::free);
+
+		std::printf("segregated fit: %.1f ns per alloc or free, %zu failed allocs\n", segregated, segregated_failures);
+		std::printf("first fit:      %.1f ns per alloc or free, %zu failed allocs\n", walk, walk_failures);
+		CHECK(segregated_failures <= walk_failures);
+	}
+}
+
+int main()
+{
+	replay();
+	oversized();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
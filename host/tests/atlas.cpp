@@ -0,0 +1,220 @@
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "atlas.hpp"
+#include "check.hpp"
+
+// the skyline packer placing rectangles without overlap and how much of a page it fills,
+// which pages the sprite atlas clears when it runs out of room, and the uploads and draws
+// sprites cost the renderer on the recording device
+namespace
+{
+	constexpr auto size = static_cast<std::uint16_t>(rendering::atlas_size);
+
+	// marks a rectangle on a page, false if any of it was already taken or lies outside
+	bool take(std::vector<bool>& page, std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height)
+	{
+		if (x + width > size || y + height > size)
+			return false;
+
+		auto free = true;
+		for (auto row = y; row < y + height; ++row)
+		{
+			for (auto column = x; column < x + width; ++column)
+			{
+				free = free && !page[row * size + column];
+				page[row * size + column] = true;
+			}
+		}
+		return free;
+	}
+
+	// inserts until a hundred in a row fail, and returns the share of the page covered
+	template<typename Size>
+	float fill(Size&& next)
+	{
+		rendering::skyline skyline;
+		skyline.reset(size, size);
+		std::vector<bool> page(size * size);
+		auto area = std::size_t{ };
+		auto overlaps = 0u;
+		for (auto misses = 0u; misses < 100u;)
+		{
+			const auto [width, height] = next();
+			std::uint16_t x, y;
+			if (!skyline.insert(width, height, x, y))
+			{
+				++misses;
+				continue;
+			}
+
+			misses = 0u;
+			overlaps += !take(page, x, y, width, height);
+			area += static_cast<std::size_t>(width) * height;
+		}
+		CHECK(overlaps == 0u && skyline.used_area() == area);
+		return static_cast<float>(area) / (size * size);
+	}
+
+	void skyline()
+	{
+		// icons of one size tile the page in rows
+		const auto icons = fill([] { return std::pair<std::uint16_t, std::uint16_t>{ 33u, 33u }; });
+		CHECK(icons * size * size == (size / 33u) * (size / 33u) * 33.f * 33.f);
+
+		std::mt19937 random(22u);
+		std::uniform_int_distribution<std::uint32_t> side(4u, 64u);
+		const auto mixed = fill([&] { return std::pair{ static_cast<std::uint16_t>(side(random)), static_cast<std::uint16_t>(side(random)) }; });
+		CHECK(mixed > .8f);
+		std::printf("page used: %.1f%% by 33 px icons, %.1f%% by random 4-64 px rectangles\n", icons * 100.f, mixed * 100.f);
+
+		rendering::skyline empty;
+		empty.reset(size, size);
+		std::uint16_t x, y;
+		CHECK(!empty.insert(0u, 10u, x, y) && !empty.insert(size + 1u, 10u, x, y) && empty.insert(size, size, x, y) && !empty.insert(1u, 1u, x, y));
+	}
+
+	rendering::image square(std::uint64_t id, std::uint16_t side)
+	{
+		return { id, nullptr, side, side };
+	}
+
+	void eviction()
+	{
+		// four 200 px images a page with their padding, sixteen fill the atlas
+		static_assert(rendering::atlas_pages == 4 && rendering::atlas_size == 512);
+		static rendering::sprite_atlas atlas;
+		bool placed;
+		std::vector<const rendering::sprite_atlas::region*> regions;
+		for (auto id = 0u; id < 16u; ++id)
+		{
+			regions.push_back(atlas.acquire(square(id, 200u), placed));
+			CHECK(regions.back() && placed && regions.back()->page == id / 4u);
+		}
+		CHECK(atlas.take_cleared() == 0xfu && atlas.take_cleared() == 0u);
+		CHECK(atlas.occupancy() == 16.f * 201.f * 201.f / (4.f * size * size));
+
+		// a cached image is found where it was put
+		CHECK(atlas.acquire(square(5u, 200u), placed) == regions[5] && !placed && atlas.stats().hits == 1u);
+
+		// the next frame uses three of the pages, so the one left over is cleared
+		atlas.advance();
+		for (const auto id : { 0u, 8u, 12u })
+			atlas.acquire(square(id, 200u), placed);
+		const auto* moved = atlas.acquire(square(16u, 200u), placed);
+		CHECK(moved && placed && moved->page == 1u && atlas.stats().evictions == 1u && atlas.take_cleared() == 0x2u);
+
+		// its images are packed again when next drawn, and once every page is in use by the
+		// frame nothing can be evicted
+		CHECK(atlas.acquire(square(4u, 200u), placed) && placed);
+		for (const auto id : { 17u, 18u })
+			CHECK(atlas.acquire(square(id, 200u), placed) && placed);
+		CHECK(!atlas.acquire(square(19u, 200u), placed) && atlas.stats().failures == 1u && atlas.stats().evictions == 1u);
+
+		// neither can what no page holds
+		CHECK(!atlas.acquire(square(20u, 0u), placed) && !atlas.acquire(square(21u, size + 1u), placed) && atlas.stats().failures == 3u);
+	}
+
+	void table()
+	{
+		// small images run out of entries before pages, the oldest page goes to make room
+		static rendering::sprite_atlas atlas;
+		bool placed;
+		for (auto id = 0u; id < rendering::max_atlas_images; ++id)
+			atlas.acquire(square(id, 8u), placed);
+		CHECK(atlas.stats().insertions == rendering::max_atlas_images && atlas.stats().evictions == 0u);
+
+		atlas.advance();
+		const auto* region = atlas.acquire(square(1000u, 8u), placed);
+		CHECK(region && placed && region->page == 0u && atlas.stats().evictions == 1u);
+		CHECK(atlas.acquire(square(0u, 8u), placed) && placed);
+	}
+
+	void sprites()
+	{
+		host::device device;
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// 500 sprites from 60 icons small enough to share one page
+		std::vector<std::uint32_t> pixels(48u * 48u, 0xff8040ffu);
+		std::vector<rendering::image> images;
+		for (auto i = 0u; i < 60u; ++i)
+			images.push_back({ 100u + i, pixels.data(), static_cast<std::uint16_t>(16u + i % 33u), static_cast<std::uint16_t>(48u - i % 33u) });
+
+		for (auto frame = 0u; frame < 3u; ++frame)
+		{
+			const auto before = device.stats();
+			renderer->begin();
+			for (auto i = 0u; i < 500u; ++i)
+				renderer->draw_sprite({ static_cast<float>(i % 25u) * 50.f, static_cast<float>(i / 25u) * 30.f }, { 40.f, 24.f }, images[i % images.size()], { 1.f, 1.f, 1.f, 1.f });
+			renderer->end();
+
+			// every icon is uploaded once, then drawn from the page max_sprites at a time
+			const auto uploads = device.stats().updates - before.updates, draws = device.stats().draws - before.draws;
+			CHECK(uploads == (frame == 0u ? images.size() : 0u));
+			CHECK(draws == (500u + rendering::default_config::max_sprites - 1u) / rendering::default_config::max_sprites && renderer->stats().sprites == 500u);
+			if (frame == 0u)
+				std::printf("500 sprites from %zu images: %zu draws, %zu uploads in the first frame\n", images.size(), draws, uploads);
+		}
+
+		// an image no page can hold is counted as dropped like any other sprite left out
+		renderer->begin();
+		renderer->draw_sprite({ 0.f, 0.f }, { 40.f, 24.f }, { 1u, pixels.data(), static_cast<std::uint16_t>(size + 1u), 4u }, { 1.f, 1.f, 1.f, 1.f });
+		renderer->draw_sprite({ 0.f, 0.f }, { 40.f, 24.f }, images[0], { 1.f, 1.f, 1.f, 1.f });
+		CHECK(renderer->stats().dropped == 1u && renderer->stats().sprites == 1u);
+		renderer->end();
+		CHECK(device.stats().errors == 0u);
+	}
+
+	void timing()
+	{
+		// churn through far more images than fit, then look up ones that stay cached. sixteen
+		// new images a frame land on whichever page has a gap, so now and then every page is in
+		// use by the frame and an image has to wait for the next one
+		static rendering::sprite_atlas atlas;
+		std::mt19937 random(220u);
+		std::uniform_int_distribution<std::uint32_t> side(8u, 64u);
+		std::vector<rendering::image> images;
+		for (auto i = 0u; i < 100000u; ++i)
+			images.push_back({ i, nullptr, static_cast<std::uint16_t>(side(random)), static_cast<std::uint16_t>(side(random)) });
+
+		bool placed;
+		auto start = std::chrono::steady_clock::now();
+		for (auto i = 0u; i < images.size(); ++i)
+		{
+			if (i % 16u == 0u)
+				atlas.advance();
+			atlas.acquire(images[i], placed);
+		}
+		const auto inserts = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		CHECK(atlas.stats().insertions + atlas.stats().failures == images.size());
+
+		constexpr auto lookups = 1000000u;
+		start = std::chrono::steady_clock::now();
+		auto found = 0u;
+		for (auto i = 0u; i < lookups; ++i)
+			found += atlas.acquire(images[images.size() - 1u - i % 32u], placed) != nullptr;
+		const auto hits = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		CHECK(found == lookups);
+		std::printf("random 8-64 px images: %.2f M inserts/s, %zu left for a later frame, %.1f M cached lookups/s, %.1f%% of the pages used\n",
+			images.size() / inserts / 1e6, atlas.stats().failures, lookups / hits / 1e6, atlas.occupancy() * 100.f);
+	}
+}
+
+int main()
+{
+	skyline();
+	eviction();
+	table();
+	sprites();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
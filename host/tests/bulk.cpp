@@ -0,0 +1,237 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "draw_list.hpp"
+#include "check.hpp"
+
+// every span call against the same primitives drawn one call at a time. both are recorded
+// into draw lists under the same viewport and clip rect, and the vertices their indices
+// resolve to have to match one for one
+namespace
+{
+	rendering::draw_list single, spans;
+
+	constexpr rendering::colour colour = { .25f, .5f, .75f, 1.f };
+	constexpr rendering::vec2 viewport = { 1280.f, 720.f };
+
+	// the vertices each list draws, in order and with the indices resolved
+	std::vector<rendering::vertex> resolve(const rendering::draw_list& list, D3D11_PRIMITIVE_TOPOLOGY& topology)
+	{
+		std::vector<rendering::vertex> result;
+		for (auto block = 0u; block < list.block_count(); ++block)
+		{
+			for (auto i = 0u; i < list.index_count(block); ++i)
+				result.push_back(list.vertices(block)[list.indices(block)[i]]);
+			for (auto i = 0u; i < list.batch_count(block); ++i)
+				topology = list.batches(block)[i].topology;
+		}
+		return result;
+	}
+
+	// begins both lists under the same clip rect, runs each side and compares what they drew
+	template<typename Single, typename Spans>
+	bool same(Single&& draw_single, Spans&& draw_spans)
+	{
+		for (auto* list : { &single, &spans })
+		{
+			list->set_viewport({ 0.f, 0.f }, viewport);
+			list->begin();
+			list->push_clip_rect({ 100.f, 50.f }, { 900.f, 500.f });
+		}
+		draw_single(single);
+		draw_spans(spans);
+
+		auto topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED, span_topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		const auto expected = resolve(single, topology), actual = resolve(spans, span_topology);
+		auto matches = expected.size() == actual.size() && topology == span_topology && single.culled() == spans.culled();
+		CHECK(single.stats().dropped == 0u && spans.stats().dropped == 0u);
+		for (auto i = 0u; matches && i < expected.size(); ++i)
+		{
+			// lines are clipped in a different order of operations, the rest is exact
+			matches = std::fabs(expected[i].pos.x - actual[i].pos.x) < 1e-3f && std::fabs(expected[i].pos.y - actual[i].pos.y) < 1e-3f
+				&& expected[i].colour == actual[i].colour;
+		}
+
+		for (auto* list : { &single, &spans })
+		{
+			list->pop_clip_rect();
+			list->submit();
+			list->release();
+		}
+		return matches && !expected.empty();
+	}
+
+	// spread over twice the viewport, so some are inside, some cut and some culled
+	std::vector<rendering::bulk::box> random_boxes(std::size_t count)
+	{
+		std::mt19937 random(18u);
+		std::uniform_real_distribution<float> x(-600.f, 1800.f), y(-300.f, 1000.f), size(0.f, 200.f);
+		std::vector<rendering::bulk::box> boxes(count);
+		for (auto& box : boxes)
+			box = { { x(random), y(random) }, { size(random), size(random) } };
+		return boxes;
+	}
+
+	std::vector<rendering::bulk::line> random_lines(std::size_t count)
+	{
+		std::mt19937 random(81u);
+		std::uniform_real_distribution<float> x(-600.f, 1800.f), y(-300.f, 1000.f);
+		std::vector<rendering::bulk::line> lines(count);
+		for (auto& line : lines)
+			line = { { x(random), y(random) }, { x(random), y(random) } };
+		return lines;
+	}
+
+	void boxes()
+	{
+		// more than one block holds, so the spans are split into chunks
+		const auto boxes = random_boxes(1500u);
+		std::vector<float> xs, ys, widths, heights;
+		for (const auto& box : boxes)
+		{
+			xs.push_back(box.pos.x), ys.push_back(box.pos.y);
+			widths.push_back(box.dimensions.x), heights.push_back(box.dimensions.y);
+		}
+
+		auto one_by_one = [&](rendering::draw_list& list)
+		{
+			for (const auto& box : boxes)
+				list.draw_filled_box(box.pos, box.dimensions, colour);
+		};
+		CHECK(same(one_by_one, [&](rendering::draw_list& list) { list.draw_filled_boxes(boxes, colour); }));
+		CHECK(same(one_by_one, [&](rendering::draw_list& list) { list.draw_filled_boxes({ xs.data(), ys.data(), widths.data(), heights.data() }, boxes.size(), colour); }));
+
+		// odd counts leave a remainder past the last full sse group, the first box is cut by
+		// the clip rect
+		for (const auto count : { 1u, 3u, 5u, 7u })
+		{
+			std::vector<rendering::bulk::box> some;
+			for (auto i = 0u; i < count; ++i)
+				some.push_back({ { 90.f + static_cast<float>(i) * 100.f, 40.f + static_cast<float>(i) * 60.f }, { 150.5f, 80.25f } });
+			CHECK(same([&](rendering::draw_list& list) { for (const auto& box : some) list.draw_filled_box(box.pos, box.dimensions, colour); },
+				[&](rendering::draw_list& list) { list.draw_filled_boxes(some, colour); }));
+		}
+	}
+
+	void lines()
+	{
+		const auto lines = random_lines(2000u);
+		std::vector<float> start_x, start_y, end_x, end_y;
+		for (const auto& line : lines)
+		{
+			start_x.push_back(line.start.x), start_y.push_back(line.start.y);
+			end_x.push_back(line.end.x), end_y.push_back(line.end.y);
+		}
+
+		auto one_by_one = [&](rendering::draw_list& list)
+		{
+			for (const auto& line : lines)
+				list.draw_line(line.start, line.end, colour);
+		};
+		CHECK(same(one_by_one, [&](rendering::draw_list& list) { list.draw_lines(lines, colour); }));
+		CHECK(same(one_by_one, [&](rendering::draw_list& list) { list.draw_lines({ start_x.data(), start_y.data(), end_x.data(), end_y.data() }, lines.size(), colour); }));
+	}
+
+	void polylines()
+	{
+		// inside the clip rect the segments share their vertices, across it they are clipped
+		// one by one, and either way they draw the same segments as separate lines
+		for (const auto radius : { 200.f, 500.f })
+		{
+			std::vector<rendering::vec2> points;
+			for (auto i = 0u; i < 3000u; ++i)
+			{
+				const auto angle = static_cast<float>(i) * .01f;
+				points.push_back({ 550.f + std::cos(angle) * radius * (1.f + i / 6000.f), 300.f + std::sin(angle) * radius * .5f });
+			}
+
+			CHECK(same([&](rendering::draw_list& list) { for (auto i = 0u; i + 1u < points.size(); ++i) list.draw_line(points[i], points[i + 1u], colour); },
+				[&](rendering::draw_list& list) { list.draw_polyline(points, colour); }));
+		}
+	}
+
+	// ns per primitive recording count of them, in lists of chunk at a time since a list holds
+	// at most a few thousand, and nothing may be dropped. smaller counts are repeated so every count records as many
+	template<typename Draw>
+	double time(std::size_t count, Draw&& draw)
+	{
+		constexpr std::size_t total = 1000000u, chunk = 2000u;
+		const auto start = std::chrono::steady_clock::now();
+		for (auto round = 0u; round < total / count; ++round)
+		{
+			for (std::size_t first = 0u; first < count; first += chunk)
+			{
+				single.begin();
+				draw(single, first, first + chunk < count ? first + chunk : count);
+				CHECK(single.stats().dropped == 0u);
+				single.submit();
+				single.release();
+			}
+		}
+		return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / total;
+	}
+
+	void timing()
+	{
+		constexpr std::size_t most = 1000000u;
+		const auto boxes = random_boxes(most);
+		const auto lines = random_lines(most);
+
+		// a random walk, so the polyline is cut and culled about as often as the lines are
+		std::mt19937 random(27u);
+		std::uniform_real_distribution<float> step(-150.f, 150.f);
+		std::vector<rendering::vec2> points(most + 1u, { 640.f, 360.f });
+		for (auto i = 1u; i < points.size(); ++i)
+		{
+			points[i] = { points[i - 1u].x + step(random), points[i - 1u].y + step(random) };
+			if (points[i].x < -600.f || points[i].x > 1800.f || points[i].y < -300.f || points[i].y > 1000.f)
+				points[i] = { 640.f, 360.f };
+		}
+
+		for (const auto count : { 10000u, 100000u, 1000000u })
+		{
+			const auto box = time(count, [&](rendering::draw_list& list, std::size_t first, std::size_t last)
+			{
+				for (auto i = first; i < last; ++i)
+					list.draw_filled_box(boxes[i].pos, boxes[i].dimensions, colour);
+			});
+			const auto box_span = time(count, [&](rendering::draw_list& list, std::size_t first, std::size_t last)
+			{
+				list.draw_filled_boxes({ boxes.data() + first, last - first }, colour);
+			});
+			const auto line = time(count, [&](rendering::draw_list& list, std::size_t first, std::size_t last)
+			{
+				for (auto i = first; i < last; ++i)
+					list.draw_line(lines[i].start, lines[i].end, colour);
+			});
+			const auto line_span = time(count, [&](rendering::draw_list& list, std::size_t first, std::size_t last)
+			{
+				list.draw_lines({ lines.data() + first, last - first }, colour);
+			});
+
+			// a polyline of count segments against its segments drawn one line at a time
+			const auto segment = time(count, [&](rendering::draw_list& list, std::size_t first, std::size_t last)
+			{
+				for (auto i = first; i < last; ++i)
+					list.draw_line(points[i], points[i + 1u], colour);
+			});
+			const auto polyline = time(count, [&](rendering::draw_list& list, std::size_t first, std::size_t last)
+			{
+				list.draw_polyline({ points.data() + first, last - first + 1u }, colour);
+			});
+			std::printf("%7u: boxes %.2f/%.2f ns, lines %.2f/%.2f ns, polyline segments %.2f/%.2f ns (one call each/span)\n",
+				count, box, box_span, line, line_span, segment, polyline);
+		}
+	}
+}
+
+int main()
+{
+	boxes();
+	lines();
+	polylines();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdio>
+
+namespace host
+{
+	// failed checks so far, a test's main returns this
+	inline int failures = 0;
+
+	inline bool check(bool condition, const char* what, const char* file, int line)
+	{
+		if (!condition)
+		{
+			++failures;
+			std::fprintf(stderr, "%s:%d: failed %s\n", file, line, what);
+		}
+		return condition;
+	}
+}
+
+#define CHECK(condition) host::check((condition), #condition, __FILE__, __LINE__)
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+// the clip rect stack on the recording device: nested cpu clip rects cutting lines to their
+// intersection, culled() counting what falls outside, and the scissor rect each draw is made
+// with, text and sprites included
+namespace
+{
+	using clip_mode = rendering::renderer::clip_mode;
+	constexpr rendering::colour white = { 1.f, 1.f, 1.f, 1.f };
+
+	bool same(const D3D11_RECT& a, const D3D11_RECT& b)
+	{
+		return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+	}
+
+	// the x range of every line drawn, in order
+	std::vector<std::pair<float, float>> lines(host::device& device)
+	{
+		std::vector<std::pair<float, float>> result;
+		for (const auto& draw : device.draws())
+		{
+			if (draw.topology != D3D11_PRIMITIVE_TOPOLOGY_LINELIST)
+				continue;
+
+			for (auto i = 0u; i + 1u < draw.count(); i += 2u)
+			{
+				rendering::vertex a, b;
+				std::memcpy(&a, draw.data.data() + i * draw.stride, sizeof(a));
+				std::memcpy(&b, draw.data.data() + (i + 1u) * draw.stride, sizeof(b));
+				result.emplace_back(a.pos.x < b.pos.x ? a.pos.x : b.pos.x, a.pos.x < b.pos.x ? b.pos.x : a.pos.x);
+			}
+		}
+		device.draws().clear();
+		return result;
+	}
+
+	void nested()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// the same line across the screen under each clip rect in turn. the inner rect is
+		// intersected with the outer one, and popping gives the outer one back
+		auto across = [&] { renderer->draw_line({ -50.f, 300.f }, { 1500.f, 300.f }, white); };
+		renderer->begin();
+		across();
+		renderer->push_clip_rect({ 100.f, 100.f }, { 400.f, 300.f });
+		across();
+		renderer->push_clip_rect({ 300.f, 200.f }, { 400.f, 400.f });
+		across();
+
+		// wholly outside the inner rect but inside the outer one, then outside both
+		renderer->draw_filled_box({ 150.f, 150.f }, { 20.f, 20.f }, white);
+		renderer->draw_line({ 0.f, 10.f }, { 50.f, 10.f }, white);
+		CHECK(renderer->culled() == 2u);
+		renderer->pop_clip_rect();
+		across();
+		renderer->draw_filled_box({ 150.f, 150.f }, { 20.f, 20.f }, white);
+		CHECK(renderer->culled() == 2u);
+		renderer->pop_clip_rect();
+		across();
+
+		// an extra pop is ignored, and the viewport still culls
+		renderer->pop_clip_rect();
+		renderer->draw_filled_box({ -100.f, -100.f }, { 20.f, 20.f }, white);
+		CHECK(renderer->culled() == 3u);
+		renderer->end();
+
+		const auto drawn = lines(device);
+		const std::vector<std::pair<float, float>> expected = { { 0.f, 1280.f }, { 100.f, 500.f }, { 300.f, 500.f }, { 100.f, 500.f }, { 0.f, 1280.f } };
+		CHECK(drawn == expected);
+
+		// past max_clip_rects pushes are counted but not applied, and pop in balance
+		renderer->begin();
+		CHECK(renderer->culled() == 0u);
+		renderer->push_clip_rect({ 100.f, 0.f }, { 1000.f, 720.f });
+		for (auto i = 1u; i < rendering::max_clip_rects + 3u; ++i)
+			renderer->push_clip_rect({ 100.f + static_cast<float>(i), 0.f }, { 1000.f, 720.f });
+		across();
+		for (auto i = 0u; i < rendering::max_clip_rects + 2u; ++i)
+			renderer->pop_clip_rect();
+		across();
+		renderer->pop_clip_rect();
+		across();
+		renderer->end();
+
+		const auto deep = lines(device);
+		const auto last = 100.f + static_cast<float>(rendering::max_clip_rects - 1u);
+		const std::vector<std::pair<float, float>> expected_deep = { { last, 1100.f }, { 100.f, 1100.f }, { 0.f, 1280.f } };
+		CHECK(deep == expected_deep);
+		CHECK(device.stats().errors == 0u);
+	}
+
+	void scissor()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		std::vector<std::uint32_t> pixels(16u * 16u, 0xffffffffu);
+		const rendering::image image = { 1u, pixels.data(), 16u, 16u };
+		auto box = [&] { renderer->draw_filled_box({ 0.f, 0.f }, { 1280.f, 720.f }, white); };
+
+		// every push and pop draws what came before under the scissor it was recorded with.
+		// fractional rects cover every pixel they touch
+		const auto before = device.stats();
+		renderer->begin();
+		box();
+		renderer->push_clip_rect({ 100.5f, 50.25f }, { 200.f, 100.f }, clip_mode::scissor);
+		box();
+		renderer->draw_text({ 110.f, 60.f }, "clipped", white);
+		renderer->draw_sprite({ 120.f, 70.f }, { 16.f, 16.f }, image, white);
+		renderer->push_clip_rect({ 150.f, 80.f }, { 400.f, 400.f }, clip_mode::scissor);
+		box();
+		renderer->pop_clip_rect();
+		box();
+		renderer->pop_clip_rect();
+		box();
+		renderer->draw_text({ 10.f, 10.f }, "whole", white);
+		renderer->end();
+
+		const D3D11_RECT viewport = { 0, 0, 1280, 720 }, outer = { 100, 50, 301, 151 }, inner = { 150, 80, 301, 151 };
+		const auto& draws = device.draws();
+		CHECK(draws.size() == 8u);
+		if (draws.size() == 8u)
+		{
+			// geometry, then the sprite and text recorded under the outer rect with it
+			CHECK(same(draws[0].scissor, viewport) && same(draws[1].scissor, outer));
+			CHECK(draws[2].stride == sizeof(rendering::textured_vertex) && same(draws[2].scissor, outer));
+			CHECK(draws[3].stride == sizeof(rendering::textured_vertex) && same(draws[3].scissor, outer));
+			CHECK(same(draws[4].scissor, inner) && same(draws[5].scissor, outer) && same(draws[6].scissor, viewport));
+			CHECK(draws[7].stride == sizeof(rendering::textured_vertex) && same(draws[7].scissor, viewport));
+		}
+		CHECK(device.stats().errors == 0u);
+		std::printf("2 nested scissor rects: %zu draws, %zu state calls\n", device.stats().draws - before.draws, device.stats().state_sets - before.state_sets);
+	}
+}
+
+int main()
+{
+	nested();
+	scissor();
+	return host::failures;
+}
\ No newline at end of file
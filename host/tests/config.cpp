@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+// the default and compact configs drawing the same frames on the recording device. they
+// flush at different points but have to draw the same vertices in the same order for each
+// topology, and what the compact config leaves out must neither compile nor be created
+namespace
+{
+	using compact = rendering::basic_renderer<rendering::compact_config>;
+
+	template<typename Renderer>
+	constexpr bool has_curves = requires(Renderer& renderer) { renderer.draw_circle({ }, 1.f, { }); };
+	template<typename Renderer>
+	constexpr bool has_sprites = requires(Renderer& renderer, const rendering::image& image) { renderer.draw_sprite({ }, { }, image, { }); };
+	template<typename Renderer>
+	constexpr bool has_text = requires(Renderer& renderer) { renderer.draw_text({ }, "", { }); };
+
+	static_assert(has_curves<rendering::renderer> && has_sprites<rendering::renderer> && has_text<rendering::renderer>);
+	static_assert(!has_curves<compact> && !has_sprites<compact> && has_text<compact>);
+	static_assert(sizeof(compact) < sizeof(rendering::renderer));
+
+	// boxes and lines spread over the screen and a line of text, what both configs can draw
+	template<typename Renderer>
+	void scene(Renderer& renderer, std::size_t count)
+	{
+		for (auto i = 0u; i < count; ++i)
+		{
+			const auto x = static_cast<float>(i * 37u % 1200u), y = static_cast<float>(i * 53u % 700u);
+			const rendering::colour colour = { static_cast<float>(i % 256u) / 255.f, .5f, 1.f, 1.f };
+			renderer.draw_filled_box({ x, y }, { 12.f, 8.f }, colour);
+			renderer.draw_line({ x, y }, { x + 30.f, y + 20.f }, colour);
+		}
+		renderer.draw_text({ 10.f, 10.f }, "compact and default", { 1.f, 1.f, 1.f, 1.f });
+	}
+
+	struct drawn
+	{
+		std::vector<std::pair<D3D11_PRIMITIVE_TOPOLOGY, std::vector<std::uint8_t>>> vertices;
+		std::size_t flushes;
+		std::size_t objects;
+		double microseconds;
+	};
+
+	// every vertex drawn with its topology, flattened across draws so flush points don't
+	// matter. state sorting groups each flush by topology and the configs flush at different
+	// points, so only the order within one topology is the same for both
+	template<typename Renderer>
+	drawn draw(std::size_t count)
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<Renderer> renderer;
+		renderer.emplace(&swapchain);
+		drawn result = { { }, 0u, device.stats().objects_created, 0. };
+
+		device.draws().clear();
+		renderer->begin();
+		scene(*renderer, count);
+		renderer->end();
+		for (const auto& draw : device.draws())
+			for (auto i = 0u; i < draw.count(); ++i)
+				result.vertices.push_back({ draw.topology, { draw.data.begin() + i * draw.stride, draw.data.begin() + (i + 1u) * draw.stride } });
+		std::stable_sort(result.vertices.begin(), result.vertices.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		result.flushes = renderer->stats().flushes;
+		CHECK(renderer->stats().dropped == 0u && device.stats().errors == 0u);
+
+		// timed without capturing, which would dominate
+		device.draws().clear();
+		constexpr auto frames = 50u;
+		const auto start = std::chrono::steady_clock::now();
+		for (auto frame = 0u; frame < frames; ++frame)
+		{
+			renderer->begin();
+			scene(*renderer, count);
+			renderer->end();
+			device.draws().clear();
+		}
+		result.microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+		return result;
+	}
+
+	void compare()
+	{
+		for (const auto count : { 20u, 200u, 2000u })
+		{
+			const auto full = draw<rendering::renderer>(count);
+			const auto small = draw<compact>(count);
+			CHECK(!full.vertices.empty() && full.vertices == small.vertices);
+
+			// a quarter of the flush size means more flushes once a frame outgrows it, and
+			// fewer gpu objects since the extras are never created
+			CHECK(small.flushes >= full.flushes && small.objects < full.objects);
+			std::printf("%u boxes and lines: default %.1f us, %zu flushes; compact %.1f us, %zu flushes\n",
+				count, full.microseconds, full.flushes, small.microseconds, small.flushes);
+		}
+	}
+}
+
+int main()
+{
+	compare();
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+namespace shader
+{
+	// defined in shaders.hpp, which only renderer.cpp may include. the size is in the container
+	extern unsigned char vertex[], pixel[], instanced_vertex[], text_vertex[], text_pixel[], sprite_pixel[], sdf_vertex[], sdf_pixel[];
+}
+
+namespace
+{
+	std::size_t container_size(const unsigned char* bytecode)
+	{
+		return bytecode[24] | bytecode[25] << 8 | bytecode[26] << 16 | bytecode[27] << 24;
+	}
+
+	void checked_in_bytecode()
+	{
+		for (const auto* bytecode : { shader::vertex, shader::pixel, shader::instanced_vertex, shader::text_vertex, shader::text_pixel,
+			shader::sprite_pixel, shader::sdf_vertex, shader::sdf_pixel })
+		{
+			const auto size = container_size(bytecode);
+			CHECK(host::valid_bytecode(bytecode, size));
+
+			// the runtime refuses a container whose hash does not match, whatever byte changed
+			std::vector<unsigned char> corrupted(bytecode, bytecode + size);
+			corrupted[size / 2u] ^= 1u;
+			CHECK(!host::valid_bytecode(corrupted.data(), size));
+		}
+	}
+
+	void map_and_draw_checks()
+	{
+		host::device device;
+		auto& context = device.immediate();
+
+		D3D11_BUFFER_DESC desc = { };
+		desc.ByteWidth = 64u;
+		desc.Usage = D3D11_USAGE_DYNAMIC;
+		desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		ID3D11Buffer* buffer;
+		CHECK(SUCCEEDED(device.CreateBuffer(&desc, nullptr, &buffer)));
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		CHECK(SUCCEEDED(context.Map(buffer, 0u, D3D11_MAP_WRITE_DISCARD, 0u, &mapped)));
+		CHECK(FAILED(context.Map(buffer, 0u, D3D11_MAP_WRITE_NO_OVERWRITE, 0u, &mapped)));
+		context.Unmap(buffer, 0u);
+		context.Unmap(buffer, 0u);
+		CHECK(device.stats().errors == 2u);
+
+		// a draw without shaders is an error before it reads anything
+		const UINT stride = 16u, offset = 0u;
+		context.IASetVertexBuffers(0u, 1u, &buffer, &stride, &offset);
+		context.Draw(8u, 0u);
+		CHECK(device.stats().errors == 3u);
+
+		const auto live = device.live_objects();
+		buffer->Release();
+		CHECK(device.live_objects() == live - 1u);
+		buffer->Release();
+		CHECK(device.stats().errors == 4u);
+	}
+
+	void renderer_frame()
+	{
+		host::device device;
+		host::swapchain swapchain(device);
+		auto& context = device.immediate();
+
+		// state the game had bound, which the renderer has to put back
+		D3D11_BUFFER_DESC desc = { };
+		desc.ByteWidth = 256u;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		ID3D11Buffer* game_buffer;
+		device.CreateBuffer(&desc, nullptr, &game_buffer);
+		const UINT game_stride = 32u, game_offset = 16u;
+		context.IASetVertexBuffers(0u, 1u, &game_buffer, &game_stride, &game_offset);
+		context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+		CHECK(device.stats().errors == 0u);
+
+		renderer->begin();
+		renderer->draw_filled_box({ 10.f, 10.f }, { 100.f, 50.f }, { 1.f, 0.f, 0.f, 1.f });
+		renderer->draw_line({ 0.f, 0.f }, { 200.f, 300.f }, { 0.f, 1.f, 0.f, 1.f });
+		renderer->draw_circle({ 300.f, 300.f }, 40.f, { 0.f, 0.f, 1.f, 1.f });
+		renderer->draw_text({ 20.f, 400.f }, "host device", { 1.f, 1.f, 1.f, 1.f });
+		renderer->draw_filled_rounded_box({ 500.f, 100.f }, { 80.f, 40.f }, 8.f, { 1.f, 1.f, 0.f, 1.f });
+		const std::uint32_t pixels[4] = { 0xffffffffu, 0xff0000ffu, 0xff00ff00u, 0xffff0000u };
+		renderer->draw_sprite({ 600.f, 400.f }, { 32.f, 32.f }, { 1u, pixels, 2u, 2u }, { 1.f, 1.f, 1.f, 1.f });
+		renderer->end();
+
+		if (!CHECK(device.stats().errors == 0u))
+			std::fprintf(stderr, "last device error: %s\n", device.last_error().c_str());
+		CHECK(device.stats().draws >= 4u);
+		CHECK(renderer->stats().draw_calls == device.stats().draws);
+
+		ID3D11Buffer* bound;
+		UINT stride, offset;
+		context.IAGetVertexBuffers(0u, 1u, &bound, &stride, &offset);
+		CHECK(bound == game_buffer && stride == game_stride && offset == game_offset);
+		bound->Release();
+		D3D11_PRIMITIVE_TOPOLOGY topology;
+		context.IAGetPrimitiveTopology(&topology);
+		CHECK(topology == D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+
+		renderer.reset();
+		CHECK(device.stats().errors == 0u);
+		game_buffer->Release();
+	}
+}
+
+int main()
+{
+	checked_in_bytecode();
+	map_and_draw_checks();
+	renderer_frame();
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+// threads record into their own draw lists while the renderer gathers whatever was submitted,
+// frame after frame, from 1 to 16 of them. every box carries its thread and frame in its
+// colour, so a list read while it was being recorded shows up as a mix of frames, and lost
+// boxes as a short count. a single thread runs the shared pool dry first, to the box
+namespace
+{
+	constexpr auto max_threads = 16u;
+	constexpr auto frames = 120u;
+	// four blocks each, more than the shared pool holds for all lists at once past two threads
+	constexpr auto boxes = 800u;
+	// a filled box is 4 vertices and 6 indices
+	constexpr auto boxes_per_block = std::min(rendering::max_vertices / 4u, rendering::max_indices / 6u);
+	constexpr auto blocks_per_list = (boxes + boxes_per_block - 1u) / boxes_per_block;
+
+	std::array<rendering::draw_list, max_threads> lists;
+	// time each thread spent recording, apart from waiting for its list to come back
+	std::array<double, max_threads> recording;
+
+	rendering::colour tag(std::uint32_t thread, std::uint32_t frame)
+	{
+		return { static_cast<float>(thread + 1u) / 255.f, static_cast<float>(frame & 0xffu) / 255.f, static_cast<float>(frame >> 8) / 255.f, 1.f };
+	}
+
+	void record_boxes(rendering::draw_list& list, std::size_t count, rendering::colour colour, float offset)
+	{
+		for (auto i = 0u; i < count; ++i)
+			list.draw_filled_box({ static_cast<float>(i % 40u) * 30.f, static_cast<float>(i / 40u % 24u) * 30.f + offset }, { 20.f, 20.f }, colour);
+	}
+
+	void record(std::uint32_t thread)
+	{
+		auto& list = lists[thread];
+		list.set_viewport({ 0.f, 0.f }, { 1280.f, 720.f });
+		recording[thread] = 0.0;
+		for (auto frame = 0u; frame < frames; ++frame)
+		{
+			while (!list.begin())
+				std::this_thread::yield();
+
+			const auto start = std::chrono::steady_clock::now();
+			record_boxes(list, boxes, tag(thread, frame), static_cast<float>(thread));
+			list.submit();
+			recording[thread] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+	}
+
+	// one list takes every block of the pool, so what the next records past its own block is
+	// dropped to the box. runs first, while no list holds a block
+	void pool()
+	{
+		host::device device;
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		auto& first = lists[0];
+		auto& second = lists[1];
+		CHECK(renderer->add_draw_list(&first) && renderer->add_draw_list(&second));
+		for (auto* list : { &first, &second })
+		{
+			list->set_viewport({ 0.f, 0.f }, { 1280.f, 720.f });
+			CHECK(list->begin());
+		}
+
+		constexpr auto held = boxes_per_block * (1u + rendering::draw_list_blocks);
+		record_boxes(first, held + 100u, tag(0u, 0u), 0.f);
+		record_boxes(second, boxes_per_block + 50u, tag(1u, 0u), 1.f);
+		CHECK(first.stats().chained == rendering::draw_list_blocks && first.stats().dropped == 100u);
+		CHECK(second.stats().chained == 0u && second.stats().dropped == 50u);
+		first.submit();
+		second.submit();
+
+		const auto before = device.stats();
+		renderer->begin();
+		renderer->end();
+		CHECK(renderer->stats().dropped == 150u && renderer->stats().draw_lists == 2u);
+		CHECK(device.stats().draws - before.draws >= 2u + rendering::draw_list_blocks && device.stats().errors == 0u);
+	}
+
+	// records frames from threads lists at once while the renderer gathers and reads back
+	// every frame, which bounds the frame rate and not the recording
+	void stress(std::uint32_t threads)
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// lists stay added, each is gathered in every frame it was submitted for
+		for (auto thread = 0u; thread < threads; ++thread)
+			CHECK(renderer->add_draw_list(&lists[thread]));
+
+		std::vector<std::thread> recorders;
+		for (auto thread = 0u; thread < threads; ++thread)
+			recorders.emplace_back(record, thread);
+
+		// what each thread's boxes should add up to over the whole run
+		std::array<std::size_t, max_threads> drawn = { }, frames_seen = { };
+		auto torn = 0u;
+		auto dropped = std::size_t{ };
+		for (auto done = false; !done; )
+		{
+			done = true;
+			for (auto thread = 0u; thread < threads; ++thread)
+				done &= frames_seen[thread] == frames;
+
+			device.draws().clear();
+			renderer->begin();
+			renderer->end();
+			dropped += renderer->stats().dropped;
+
+			// vertices per thread and frame, in the order the gpu would assemble them
+			std::map<std::uint32_t, std::size_t> vertices;
+			for (const auto& draw : device.draws())
+			{
+				for (auto i = 0u; i < draw.count(); ++i)
+				{
+					rendering::vertex vertex;
+					std::memcpy(&vertex, draw.data.data() + i * draw.stride, sizeof(vertex));
+					++vertices[vertex.colour & 0xffffffu];
+				}
+			}
+
+			std::array<std::size_t, max_threads> tags = { };
+			for (const auto& [colour, count] : vertices)
+			{
+				const auto thread = (colour & 0xffu) - 1u;
+				if (!CHECK(thread < threads))
+					continue;
+				++tags[thread];
+				drawn[thread] += count / 6u;
+			}
+			for (auto thread = 0u; thread < threads; ++thread)
+			{
+				torn += tags[thread] > 1u;
+				frames_seen[thread] += tags[thread];
+			}
+		}
+
+		for (auto& recorder : recorders)
+			recorder.join();
+
+		CHECK(torn == 0u);
+		CHECK(device.stats().errors == 0u);
+		// a box is either drawn or counted as dropped because the pool was empty, and while
+		// the pool holds every list's chained blocks at once nothing is dropped
+		auto total = std::size_t{ };
+		for (const auto count : drawn)
+			total += count;
+		CHECK(total + dropped == std::size_t{ threads } * frames * boxes);
+		if (threads * (blocks_per_list - 1u) <= rendering::draw_list_blocks)
+			CHECK(dropped == 0u);
+
+		// boxes a second while recording, for the slowest thread
+		auto slowest = 0.0;
+		for (auto thread = 0u; thread < threads; ++thread)
+			slowest = std::max(slowest, recording[thread]);
+		std::printf("%2u threads: %5.1f M boxes/s recorded by the slowest, %4.1f%% dropped\n",
+			threads, static_cast<double>(frames) * boxes / slowest / 1e6, 100.0 * dropped / (total + dropped));
+	}
+}
+
+int main()
+{
+	pool();
+	std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+	for (auto threads = 1u; threads <= max_threads; ++threads)
+		stress(threads);
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "memory_manager.hpp"
+#include "check.hpp"
+
+// the frame arena handing out memory until reset, falling back to the static heap past its
+// end, and failing without allocating once both are full. the renderer then drops what it
+// cannot store instead of stopping, and starts the next frame from an empty arena
+namespace
+{
+	void arena()
+	{
+		namespace frame = memory::frame;
+		frame::reset();
+
+		// blocks follow each other 16 byte aligned until reset takes them all back
+		auto* first = static_cast<std::uint8_t*>(frame::alloc(1u));
+		auto* second = static_cast<std::uint8_t*>(frame::alloc(100u));
+		CHECK(first && second == first + 16u && frame::stats().used == 16u + 112u);
+		CHECK(frame::alloc(0u) == nullptr && !frame::can_alloc(0u));
+		frame::reset();
+		CHECK(frame::stats().used == 0u && frame::alloc(1u) == first);
+
+		// past the arena requests go to the heap, and are freed there
+		const auto before = frame::stats();
+		CHECK(frame::alloc(memory::frame_buffer_size - 32u) && frame::stats().used == memory::frame_buffer_size - 16u);
+		CHECK(frame::can_alloc(4096u));
+		auto* spill = frame::alloc(4096u);
+		CHECK(spill && frame::stats().overflows == before.overflows + 1u && memory::stats().allocations == 1u);
+		frame::free(spill);
+		CHECK(memory::stats().allocations == 0u);
+
+		// with the heap full as well, nothing is allocated and both say so up front
+		std::vector<void*> blocks;
+		while (auto* block = memory::alloc(256u))
+			blocks.push_back(block);
+		CHECK(!memory::can_alloc(256u) && !frame::can_alloc(256u));
+		CHECK(frame::alloc(256u) == nullptr && frame::stats().failures == before.failures + 1u);
+
+		// a container that cannot grow is left as it was
+		std::vector<std::uint32_t, memory::frame_allocator<std::uint32_t>> vector;
+		CHECK(memory::reserve(vector, 2u) && vector.capacity() >= 2u);
+		CHECK(!memory::reserve(vector, 64u) && vector.capacity() < 64u);
+		for (auto* block : blocks)
+			memory::free(block);
+		frame::reset();
+	}
+
+	void frames()
+	{
+		host::device device;
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		std::vector<std::uint32_t> pixels(16u * 16u, 0xffffffffu);
+		const rendering::image image = { 1u, pixels.data(), 16u, 16u };
+		auto frame = [&](std::size_t sprites)
+		{
+			renderer->begin();
+			for (auto i = 0u; i < 300u; ++i)
+				renderer->draw_filled_box({ static_cast<float>(i), 10.f }, { 5.f, 5.f }, { 1.f, 0.f, 0.f, 1.f });
+			for (auto i = 0u; i < sprites; ++i)
+				renderer->draw_sprite({ static_cast<float>(i % 1000u), 100.f }, { 16.f, 16.f }, image, { 1.f, 1.f, 1.f, 1.f });
+			const auto stats = renderer->stats();
+			renderer->end();
+			CHECK(memory::frame::stats().used == 0u);
+			return stats;
+		};
+
+		// every frame starts from an empty arena, so the same frame never needs more
+		frame(100u);
+		const auto high_water = memory::frame::stats().high_water;
+		for (auto i = 0u; i < 20u; ++i)
+			CHECK(frame(100u).dropped == 0u);
+		CHECK(memory::frame::stats().high_water == high_water);
+
+		// sprites wait for end(), so enough of them outgrow the arena and the heap. those
+		// are dropped and counted, the rest are drawn
+		const auto overflowing = frame(200000u);
+		CHECK(overflowing.dropped > 0u && overflowing.sprites + overflowing.dropped == 200000u);
+		CHECK(frame(100u).dropped == 0u);
+		CHECK(memory::stats().failures > 0u && device.stats().errors == 0u);
+	}
+}
+
+int main()
+{
+	arena();
+	frames();
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <thread>
+#include "device.hpp"
+#include "frame_pipeline.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+// a producer thread publishes frames while the present hook draws whatever is newest. the
+// box count and colour of every box follow from the frame number, so each drawn frame can
+// be checked for being whole, and the frames the hook saw for only ever moving forward
+namespace
+{
+	constexpr auto frames = 2000u;
+
+	rendering::frame_pipeline pipeline;
+
+	// up to a little over two blocks, so frames chain from the pool
+	std::uint32_t boxes(std::uint32_t frame)
+	{
+		return 1u + frame * 7u % 600u;
+	}
+
+	rendering::colour tag(std::uint32_t frame)
+	{
+		return { 1.f / 255.f, static_cast<float>(frame & 0xffu) / 255.f, static_cast<float>(frame >> 8) / 255.f, 1.f };
+	}
+
+	void produce()
+	{
+		for (auto frame = 0u; frame < frames; ++frame)
+		{
+			auto& list = pipeline.record();
+			list.set_viewport({ 0.f, 0.f }, { 1280.f, 720.f });
+			for (auto i = 0u; i < boxes(frame); ++i)
+				list.draw_filled_box({ static_cast<float>(i % 40u) * 30.f, static_cast<float>(i / 40u) * 30.f }, { 20.f, 20.f }, tag(frame));
+			pipeline.publish();
+
+			// now and then let the hook run dry, so it has to draw a frame again
+			if (frame % 8u == 0u)
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+	}
+
+	void hand_off()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		std::atomic<bool> finished { };
+		std::thread producer([&] { produce(); finished.store(true, std::memory_order_release); });
+
+		auto calls = std::size_t{ }, torn = std::size_t{ }, backwards = std::size_t{ };
+		auto last = -1ll;
+		for (auto done = false; !done; )
+		{
+			// one more call after the producer stopped picks up its last frame
+			done = finished.load(std::memory_order_acquire);
+
+			device.draws().clear();
+			renderer->begin();
+			renderer->draw(pipeline.latest());
+			renderer->end();
+			++calls;
+
+			std::map<std::uint32_t, std::size_t> vertices;
+			for (const auto& draw : device.draws())
+			{
+				for (auto i = 0u; i < draw.count(); ++i)
+				{
+					rendering::vertex vertex;
+					std::memcpy(&vertex, draw.data.data() + i * draw.stride, sizeof(vertex));
+					++vertices[(vertex.colour >> 8) & 0xffffu];
+				}
+			}
+
+			// nothing was published yet, the hook draws the empty list it starts with
+			if (vertices.empty())
+			{
+				CHECK(last == -1ll);
+				continue;
+			}
+
+			const auto frame = vertices.begin()->first;
+			torn += vertices.size() != 1u || vertices.begin()->second != boxes(frame) * 6u;
+			backwards += static_cast<long long>(frame) < last;
+			last = frame;
+		}
+		producer.join();
+
+		CHECK(torn == 0u);
+		CHECK(backwards == 0u);
+		CHECK(last == frames - 1u);
+		CHECK(device.stats().errors == 0u);
+
+		// every published frame was either presented or replaced, every call did one or the other
+		const auto stats = pipeline.stats();
+		CHECK(stats.published == frames);
+		CHECK(stats.presented + stats.dropped == stats.published);
+		CHECK(stats.presented + stats.reused == calls);
+		CHECK(stats.overflowed == 0u);
+		std::printf("%zu presented, %zu dropped, %zu reused\n", stats.presented, stats.dropped, stats.reused);
+	}
+
+	void overflow()
+	{
+		// empty frames through every buffer, so none of them holds pool blocks any more
+		for (auto i = 0u; i < 3u; ++i)
+		{
+			pipeline.record();
+			pipeline.publish();
+			pipeline.latest();
+		}
+
+		// a frame past the list's own block and the whole pool, the rest is reported
+		const auto before = pipeline.stats();
+		auto& list = pipeline.record();
+		constexpr auto fits = rendering::draw_list::max_blocks * (rendering::max_vertices / 4u);
+		for (auto i = 0u; i < fits + 10u; ++i)
+			list.draw_filled_box({ 0.f, 0.f }, { 1.f, 1.f }, tag(0u));
+		pipeline.publish();
+
+		const auto after = pipeline.stats();
+		CHECK(after.overflowed - before.overflowed == 10u);
+		CHECK(after.published - before.published == 1u);
+	}
+}
+
+int main()
+{
+	hand_off();
+	overflow();
+	return host::failures;
+}
\ No newline at end of file
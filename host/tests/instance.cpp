@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "instance.hpp"
+#include "software_renderer.hpp"
+#include "check.hpp"
+
+// instance records as the instanced input layout reads them, and their expansion. the
+// expected triangles come from a port of instanced_vertex.hlsl, which the software renderer's
+// own expansion has to cover pixel for pixel. the instanced renderer is then run on the
+// recording device for the draws it makes
+namespace
+{
+	constexpr auto size = 256u;
+
+	rendering::software_renderer renderer;
+	std::vector<std::uint32_t> expected(size * size), actual(size * size);
+
+	// instanced_vertex.hlsl for one vertex id
+	rendering::vec2 expand(const rendering::instance& instance, std::uint32_t id)
+	{
+		constexpr rendering::vec2 corners[6] = { { 0.f, 0.f }, { 1.f, 0.f }, { 0.f, 1.f }, { 0.f, 1.f }, { 1.f, 0.f }, { 1.f, 1.f } };
+		const auto corner = corners[id % 6u];
+		const auto part = id / 6u;
+		const auto a = instance.a, b = instance.b;
+		const auto t = instance.thickness;
+
+		switch (instance.type)
+		{
+		case rendering::shape_type::filled_box:
+			return { a.x + corner.x * b.x, a.y + corner.y * b.y };
+		case rendering::shape_type::box:
+		{
+			rendering::vec2 origin, extent;
+			if (part == 0u)
+				origin = a, extent = { b.x, t };
+			else if (part == 1u)
+				origin = { a.x, a.y + b.y - t }, extent = { b.x, t };
+			else if (part == 2u)
+				origin = { a.x, a.y + t }, extent = { t, b.y - 2.f * t };
+			else
+				origin = { a.x + b.x - t, a.y + t }, extent = { t, b.y - 2.f * t };
+			return { origin.x + corner.x * extent.x, origin.y + corner.y * extent.y };
+		}
+		case rendering::shape_type::line:
+		{
+			const rendering::vec2 delta = { b.x - a.x, b.y - a.y };
+			const auto length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+			const rendering::vec2 direction = length > 0.f ? rendering::vec2{ delta.x / length, delta.y / length } : rendering::vec2{ 1.f, 0.f };
+			const rendering::vec2 normal = { -direction.y * t * .5f, direction.x * t * .5f };
+			const auto side = corner.y * 2.f - 1.f;
+			return { a.x + delta.x * corner.x + normal.x * side, a.y + delta.y * corner.x + normal.y * side };
+		}
+		default:
+		{
+			const auto inner = t > 0.f ? std::fmax(b.x - t, 0.f) : 0.f;
+			const auto angle = (static_cast<float>(part) + corner.x) * 2.f * rendering::pi<float> / rendering::circle_segments;
+			const auto radius = b.x + (inner - b.x) * corner.y;
+			return { a.x + std::cos(angle) * radius, a.y + std::sin(angle) * radius };
+		}
+		}
+	}
+
+	void render(std::vector<std::uint32_t>& target, auto&& record)
+	{
+		renderer.set_target(target.data(), size, size, size);
+		renderer.clear({ 0.f, 0.f, 0.f, 1.f });
+		renderer.begin();
+		record();
+		renderer.end();
+	}
+
+	std::size_t differences()
+	{
+		auto count = std::size_t{ };
+		for (auto i = 0u; i < expected.size(); ++i)
+			count += expected[i] != actual[i];
+		return count;
+	}
+
+	std::size_t coverage(const std::vector<std::uint32_t>& target)
+	{
+		auto count = std::size_t{ };
+		for (const auto pixel : target)
+			count += (pixel & 0xffffffu) != 0u;
+		return count;
+	}
+
+	// what the gpu would draw for the instance against what the software renderer does
+	std::size_t compare(const rendering::instance& instance)
+	{
+		std::vector<rendering::vertex> vertices(rendering::vertices_per_instance(instance.type));
+		for (auto id = 0u; id < vertices.size(); ++id)
+			vertices[id] = { expand(instance, id), instance.colour };
+
+		render(expected, [&] { renderer.add_vertices(vertices.data(), vertices.size(), D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST); });
+		render(actual, [&] { renderer.add_instance(instance); });
+		return differences();
+	}
+
+	void layout()
+	{
+		// the offsets the instanced input layout gives each element, in instanced_vertex.hlsl order
+		CHECK(offsetof(rendering::instance, a) == 0u);
+		CHECK(offsetof(rendering::instance, b) == 8u);
+		CHECK(offsetof(rendering::instance, thickness) == 16u);
+		CHECK(offsetof(rendering::instance, colour) == 20u);
+		CHECK(offsetof(rendering::instance, type) == 24u);
+
+		// r in the lowest byte, clamped, rounded to nearest
+		CHECK(rendering::pack({ 1.f, 0.f, 0.f, 0.f }) == 0x000000ffu);
+		CHECK(rendering::pack({ 0.f, 0.f, 0.f, 1.f }) == 0xff000000u);
+		CHECK(rendering::pack({ 2.f, -1.f, .5f, 1.f / 255.f }) == 0x018000ffu);
+
+		const auto box = rendering::make_box({ 1.f, 2.f }, { 3.f, 4.f }, 2.f, { 0.f, 1.f, 0.f, 1.f });
+		CHECK(box.a.x == 1.f && box.a.y == 2.f && box.b.x == 3.f && box.b.y == 4.f && box.thickness == 2.f);
+		CHECK(box.colour == 0xff00ff00u && box.type == rendering::shape_type::box);
+		const auto circle = rendering::make_circle({ 5.f, 6.f }, 7.f, 0.f, { 1.f, 1.f, 1.f, 1.f });
+		CHECK(circle.b.x == 7.f && circle.b.y == 0.f && circle.thickness == 0.f);
+
+		CHECK(rendering::vertices_per_instance(rendering::shape_type::filled_box) == 6u);
+		CHECK(rendering::vertices_per_instance(rendering::shape_type::box) == 24u);
+		CHECK(rendering::vertices_per_instance(rendering::shape_type::line) == 6u);
+		CHECK(rendering::vertices_per_instance(rendering::shape_type::circle) == 6u * rendering::circle_segments);
+		CHECK(rendering::vertices_per_instance(rendering::shape_type::none) == 0u);
+	}
+
+	// one channel as R8G8B8A8_UNORM stores it, nan as 0
+	std::uint32_t unorm(float value)
+	{
+		if (std::isnan(value))
+			return 0u;
+		return static_cast<std::uint32_t>(std::lrint(std::clamp(value, 0.f, 1.f) * 255.f));
+	}
+
+	void packing()
+	{
+		// every channel is clamped to [0, 1] and rounded to nearest, halves to even
+		constexpr auto infinity = std::numeric_limits<float>::infinity();
+		std::vector<float> values = { -infinity, -1e30f, -1.f, -0.f, 0.f, .5f, 1.f, 1.0001f, 1e30f, infinity, std::numeric_limits<float>::quiet_NaN() };
+		for (auto step = 0u; step <= 255u; ++step)
+		{
+			values.push_back(static_cast<float>(step) / 255.f);
+			values.push_back((static_cast<float>(step) + .5f) / 255.f);
+			values.push_back(std::nextafter((static_cast<float>(step) + .5f) / 255.f, 0.f));
+		}
+
+		auto wrong = 0u;
+		for (auto i = 0u; i < values.size(); ++i)
+		{
+			const rendering::colour colour = { values[i], values[(i + 1u) % values.size()], values[(i + 7u) % values.size()], values[(i + 13u) % values.size()] };
+			const auto expected = unorm(colour.r) | unorm(colour.g) << 8u | unorm(colour.b) << 16u | unorm(colour.a) << 24u;
+			wrong += rendering::pack(colour) != expected;
+		}
+		CHECK(wrong == 0u);
+		CHECK(rendering::pack({ .5f, 1.5f / 255.f, 2.5f / 255.f, 0.f }) == 0x00020280u);
+	}
+
+	// the instances and vertices per instance of every instanced draw, in order
+	std::vector<std::pair<std::size_t, UINT>> instanced_draws(host::device& device)
+	{
+		std::vector<std::pair<std::size_t, UINT>> result;
+		for (const auto& draw : device.draws())
+		{
+			if (draw.instance_vertices != 0u)
+				result.emplace_back(draw.count(), draw.instance_vertices);
+		}
+		device.draws().clear();
+		return result;
+	}
+
+	void draws()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		using instanced = rendering::basic_renderer<rendering::instanced_config>;
+		std::optional<instanced> renderer;
+		renderer.emplace(&swapchain);
+
+		// a run of one shape is one draw until max_instances forces a flush
+		constexpr auto max = rendering::instanced_config::max_instances;
+		const rendering::colour red = { 1.f, 0.f, 0.f, 1.f };
+		for (const auto count : { std::size_t{ 1u }, max, max + 1u, max * 3u + 5u })
+		{
+			renderer->begin();
+			for (auto i = 0u; i < count; ++i)
+				renderer->draw_filled_box({ static_cast<float>(i % 1000u), static_cast<float>(i % 700u) }, { 4.f, 4.f }, red);
+			const auto stats = renderer->stats();
+			renderer->end();
+
+			const auto draws = instanced_draws(device);
+			auto instances = std::size_t{ };
+			for (const auto& [drawn, vertices] : draws)
+			{
+				CHECK(drawn <= max && vertices == 6u);
+				instances += drawn;
+			}
+			CHECK(draws.size() == (count + max - 1u) / max && instances == count);
+			CHECK(stats.overflow_flushes == (count - 1u) / max && stats.dropped == 0u);
+		}
+
+		// shapes alternating cost a draw each, with the vertices their shape expands to
+		renderer->begin();
+		renderer->draw_filled_box({ 10.f, 10.f }, { 20.f, 20.f }, red);
+		renderer->draw_box({ 40.f, 10.f }, { 20.f, 20.f }, red);
+		renderer->draw_box({ 70.f, 10.f }, { 20.f, 20.f }, red);
+		renderer->draw_line({ 10.f, 50.f }, { 90.f, 60.f }, red);
+		renderer->draw_filled_circle({ 200.f, 200.f }, 30.f, red);
+		renderer->end();
+		const auto mixed = instanced_draws(device);
+		CHECK(mixed.size() == 4u && mixed[1].first == 2u && mixed[1].second == 24u);
+		std::size_t instances = 0u, vertices = 0u;
+		for (const auto& [drawn, per_instance] : mixed)
+		{
+			instances += drawn;
+			vertices += drawn * per_instance;
+		}
+		CHECK(instances == 5u && vertices == 6u + 2u * 24u + 6u + 6u * rendering::circle_segments);
+		CHECK(device.stats().errors == 0u);
+		std::printf("%zu instanced draws for 5 shapes of 4 kinds, %zu vertices expanded\n", mixed.size(), vertices);
+	}
+
+	void expansion()
+	{
+		const rendering::colour red = { 1.f, 0.f, 0.f, 1.f };
+		CHECK(compare(rendering::make_filled_box({ 10.5f, 20.25f }, { 100.f, 37.f }, red)) == 0u && coverage(expected) == 100u * 37u);
+		CHECK(compare(rendering::make_box({ 30.f, 40.f }, { 150.f, 90.f }, 3.f, red)) == 0u && coverage(expected) > 0u);
+		CHECK(compare(rendering::make_line({ 12.f, 200.f }, { 230.f, 31.f }, 5.f, red)) == 0u && coverage(expected) > 0u);
+
+		// a line without length has no area either way
+		CHECK(compare(rendering::make_line({ 40.f, 40.f }, { 40.f, 40.f }, 4.f, red)) == 0u && coverage(expected) == 0u);
+
+		// the software renderer tessellates circles adaptively instead of in circle_segments,
+		// so only the edge pixels may differ
+		const auto circle = rendering::make_circle({ 128.f, 128.f }, 90.f, 0.f, red);
+		const auto different = compare(circle);
+		CHECK(different < coverage(expected) / 50u);
+	}
+}
+
+int main()
+{
+	layout();
+	packing();
+	expansion();
+	draws();
+	return host::failures;
+}
\ No newline at end of file
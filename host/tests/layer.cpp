@@ -0,0 +1,108 @@
+#include <cstdio>
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+// a layer drawn frame after frame on the recording device: uploaded when first drawn, after
+// invalidate() and when its content changed, and drawn from its own buffers without a map
+// when re-recorded the same
+namespace
+{
+	// more than one block holds, so the layer chains one from the pool
+	constexpr auto boxes = 300u;
+	constexpr auto bytes = boxes * (4u * sizeof(rendering::vertex) + 6u * sizeof(std::uint16_t));
+
+	rendering::layer layer;
+
+	// a layer is recorded on the renderer thread and never submitted
+	void record(std::size_t count, rendering::colour colour)
+	{
+		auto& list = layer.record();
+		list.set_viewport({ 0.f, 0.f }, { 1280.f, 720.f });
+		for (auto i = 0u; i < count; ++i)
+			list.draw_filled_box({ static_cast<float>(i % 40u) * 30.f, static_cast<float>(i / 40u) * 30.f }, { 20.f, 20.f }, colour);
+	}
+
+	struct frame_result
+	{
+		std::size_t uploaded;
+		std::size_t retained;
+		std::size_t maps;
+		// the vertices drawn, in the order the gpu would assemble them
+		std::vector<std::uint8_t> drawn;
+	};
+
+	frame_result frame(host::device& device, rendering::renderer& renderer, bool draw_layer)
+	{
+		device.draws().clear();
+		const auto before = device.stats();
+		renderer.begin();
+		if (draw_layer)
+			renderer.draw(layer);
+		const auto stats = renderer.stats();
+		renderer.end();
+
+		frame_result result = { stats.bytes_uploaded, stats.bytes_retained, device.stats().maps - before.maps, { } };
+		for (const auto& draw : device.draws())
+			result.drawn.insert(result.drawn.end(), draw.data.begin(), draw.data.end());
+		return result;
+	}
+
+	void retained()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// what a frame maps without the layer
+		const auto empty = frame(device, *renderer, false);
+		CHECK(empty.uploaded == 0u && empty.drawn.empty());
+
+		// the first draw uploads it, one map per block and stream
+		const rendering::colour red = { 1.f, 0.f, 0.f, 1.f };
+		record(boxes, red);
+		const auto first = frame(device, *renderer, true);
+		CHECK(first.uploaded == bytes && first.retained == 0u && first.maps == empty.maps + 4u);
+		CHECK(first.drawn.size() == boxes * 6u * sizeof(rendering::vertex));
+
+		// recorded again the same, the hash matches and nothing is mapped
+		record(boxes, red);
+		const auto same = frame(device, *renderer, true);
+		CHECK(same.uploaded == 0u && same.retained == bytes && same.maps == empty.maps && same.drawn == first.drawn);
+
+		// and without recording at all
+		const auto untouched = frame(device, *renderer, true);
+		CHECK(untouched.uploaded == 0u && untouched.retained == bytes && untouched.drawn == first.drawn);
+
+		// invalidate() uploads the same content once more
+		layer.invalidate();
+		const auto invalidated = frame(device, *renderer, true);
+		CHECK(invalidated.uploaded == bytes && invalidated.retained == 0u && invalidated.maps == first.maps && invalidated.drawn == first.drawn);
+		CHECK(frame(device, *renderer, true).uploaded == 0u);
+
+		// a colour or a count that changed is uploaded and drawn
+		record(boxes, { 0.f, 1.f, 0.f, 1.f });
+		const auto recoloured = frame(device, *renderer, true);
+		CHECK(recoloured.uploaded == bytes && recoloured.drawn.size() == first.drawn.size() && recoloured.drawn != first.drawn);
+		record(boxes - 1u, { 0.f, 1.f, 0.f, 1.f });
+		const auto shorter = frame(device, *renderer, true);
+		CHECK(shorter.uploaded == bytes - bytes / boxes && shorter.drawn.size() == (boxes - 1u) * 6u * sizeof(rendering::vertex));
+
+		CHECK(device.stats().errors == 0u);
+		std::printf("%u boxes: %zu bytes and %zu maps to upload, %zu maps when retained\n", boxes, first.uploaded, first.maps - empty.maps, same.maps - empty.maps);
+		layer.release();
+	}
+}
+
+int main()
+{
+	retained();
+	return host::failures;
+}
\ No newline at end of file
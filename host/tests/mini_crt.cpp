@@ -0,0 +1,173 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "mini_crt.hpp"
+#include "check.hpp"
+
+// the host build keeps libc's memset, memcpy and memmove and gives mini_crt's their crt_ names
+extern "C" void* crt_memset(void* dest, int ch, std::size_t count);
+extern "C" void* crt_memcpy(void* dest, const void* src, std::size_t count);
+extern "C" void* crt_memmove(void* dest, const void* src, std::size_t count);
+
+namespace crt
+{
+	// the cached cpu check in mini_crt.cpp, set here to run the sse2 path on an avx2 machine
+	enum class isa : std::uint8_t
+	{
+		unknown,
+		sse2,
+		avx2
+	};
+
+	extern isa detected;
+}
+
+// compares mini_crt against libc for every size up to a few hundred bytes at every alignment
+// of source and destination, and for sizes around the non-temporal threshold. each buffer
+// has guard bytes on both sides that neither may touch
+namespace
+{
+	constexpr std::size_t guard = 64u;
+
+	struct buffers
+	{
+		explicit buffers(std::size_t size)
+			: expected(size + 2u * guard)
+			, actual(size + 2u * guard)
+		{ }
+
+		void fill(std::mt19937& random)
+		{
+			for (auto& byte : expected)
+				byte = static_cast<std::uint8_t>(random());
+			actual = expected;
+		}
+
+		bool same() const
+		{
+			return expected == actual;
+		}
+
+		std::vector<std::uint8_t> expected;
+		std::vector<std::uint8_t> actual;
+	};
+
+	std::vector<std::size_t> fuzz_sizes()
+	{
+		std::vector<std::size_t> sizes;
+		for (auto size = 0u; size <= 300u; ++size)
+			sizes.push_back(size);
+		for (const auto size : { 511u, 512u, 513u, 1000u, 4095u, 4096u, 65537u, 0x3ffffu, 0x40000u, 0x40001u, 0x40000u + 97u })
+			sizes.push_back(size);
+		return sizes;
+	}
+
+	// every size, offsets 0 to 63 apart for the small ones and a sample of them past that
+	template<typename Test>
+	void for_each_case(Test&& test)
+	{
+		std::mt19937 random(0x3u);
+		for (const auto size : fuzz_sizes())
+		{
+			const auto alignments = size <= 300u ? 64u : 8u;
+			for (auto i = 0u; i < alignments; ++i)
+			{
+				const auto dest = size <= 300u ? i : random() % 64u;
+				const auto src = size <= 300u ? (i * 37u) % 64u : random() % 64u;
+				test(size, dest, src, random);
+			}
+		}
+	}
+
+	void copies()
+	{
+		auto failures = 0u;
+		for_each_case([&](std::size_t size, std::size_t dest, std::size_t src, std::mt19937& random)
+		{
+			buffers to(size + guard), from(size + guard);
+			to.fill(random);
+			from.fill(random);
+
+			std::memcpy(to.expected.data() + guard + dest, from.expected.data() + guard + src, size);
+			const auto* result = crt_memcpy(to.actual.data() + guard + dest, from.actual.data() + guard + src, size);
+			failures += !to.same() || !from.same() || result != to.actual.data() + guard + dest;
+
+			crt::stream_copy(to.actual.data() + guard + dest, from.actual.data() + guard + src, size);
+			failures += !to.same();
+		});
+		CHECK(failures == 0u);
+	}
+
+	void sets()
+	{
+		auto failures = 0u;
+		for_each_case([&](std::size_t size, std::size_t dest, std::size_t, std::mt19937& random)
+		{
+			buffers to(size + guard);
+			to.fill(random);
+
+			const auto value = static_cast<int>(random() % 256u);
+			std::memset(to.expected.data() + guard + dest, value, size);
+			const auto* result = crt_memset(to.actual.data() + guard + dest, value, size);
+			failures += !to.same() || result != to.actual.data() + guard + dest;
+		});
+		CHECK(failures == 0u);
+	}
+
+	// source and destination inside one buffer, overlapping in either direction
+	void moves()
+	{
+		auto failures = 0u;
+		for_each_case([&](std::size_t size, std::size_t dest, std::size_t src, std::mt19937& random)
+		{
+			buffers both(size + guard);
+			both.fill(random);
+
+			std::memmove(both.expected.data() + guard + dest, both.expected.data() + guard + src, size);
+			const auto* result = crt_memmove(both.actual.data() + guard + dest, both.actual.data() + guard + src, size);
+			failures += !both.same() || result != both.actual.data() + guard + dest;
+		});
+		CHECK(failures == 0u);
+	}
+
+	double bytes_per_nanosecond(void* (*copy)(void*, const void*, std::size_t), std::size_t size)
+	{
+		std::vector<std::uint8_t> to(size + 64u), from(size + 64u, 1u);
+		const auto rounds = (std::size_t{ 1u } << 28) / (size + 64u) + 1u;
+
+		const auto start = std::chrono::steady_clock::now();
+		for (auto i = 0u; i < rounds; ++i)
+			copy(to.data() + 3, from.data() + i % 16u, size);
+		const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		return static_cast<double>(rounds * size) / elapsed;
+	}
+
+	void timing()
+	{
+		for (const auto size : { 16u, 64u, 256u, 4096u, 65536u, 0x100000u })
+		{
+			std::printf("memcpy %7u bytes: crt %6.2f GB/s, libc %6.2f GB/s\n", size,
+				bytes_per_nanosecond(crt_memcpy, size), bytes_per_nanosecond(std::memcpy, size));
+		}
+	}
+}
+
+int main()
+{
+	const auto level = crt::detected;
+	for (const auto isa : { crt::isa::sse2, crt::isa::unknown })
+	{
+		// unknown detects the cpu again, which picks avx2 where it is there
+		crt::detected = isa;
+		copies();
+		sets();
+		moves();
+	}
+	crt::detected = level;
+
+	timing();
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "check.hpp"
+
+// polygons up to and past what one flush holds, drawn on the recording device. every index
+// is resolved through the bound 16 bit index buffer, which the device checks against the
+// vertices written, and the triangles and lines that come out have to be the fan and the
+// closed outline of the whole polygon
+namespace
+{
+	constexpr rendering::colour white = { 1.f, 1.f, 1.f, 1.f };
+
+	// a convex polygon, the points of a circle
+	std::vector<rendering::vec2> circle(std::size_t count)
+	{
+		std::vector<rendering::vec2> points(count);
+		for (auto i = 0u; i < count; ++i)
+		{
+			const auto angle = 2.f * rendering::pi<float> * static_cast<float>(i) / static_cast<float>(count);
+			points[i] = { 640.f + 300.f * std::cos(angle), 360.f + 300.f * std::sin(angle) };
+		}
+		return points;
+	}
+
+	// the positions of every vertex of one topology drawn, in the order the gpu assembles them
+	std::vector<rendering::vec2> drawn(host::device& device, D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		std::vector<rendering::vec2> result;
+		for (const auto& draw : device.draws())
+		{
+			if (draw.topology != topology)
+				continue;
+
+			for (auto i = 0u; i < draw.count(); ++i)
+			{
+				rendering::vertex vertex;
+				std::memcpy(&vertex, draw.data.data() + i * draw.stride, sizeof(vertex));
+				result.push_back(vertex.pos);
+			}
+		}
+		return result;
+	}
+
+	bool same(const std::vector<rendering::vec2>& expected, const std::vector<rendering::vec2>& actual)
+	{
+		if (expected.size() != actual.size())
+			return false;
+
+		for (auto i = 0u; i < expected.size(); ++i)
+		{
+			if (expected[i].x != actual[i].x || expected[i].y != actual[i].y)
+				return false;
+		}
+		return true;
+	}
+
+	void polygons()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// one flush holds a fan of max_vertices points and an outline of half max_indices
+		const auto fits = static_cast<std::size_t>(rendering::max_vertices);
+		for (const auto count : { std::size_t{ 3u }, fits - 1u, fits, fits + 1u, fits * 5u + 7u, std::size_t{ 20000u } })
+		{
+			const auto points = circle(count);
+			std::vector<rendering::vec2> fan, outline;
+			for (auto i = 1u; i + 1u < count; ++i)
+				fan.insert(fan.end(), { points[0], points[i], points[i + 1u] });
+			for (auto i = 0u; i < count; ++i)
+				outline.insert(outline.end(), { points[i], points[(i + 1u) % count] });
+
+			// a line first so the polygons start part way into the buffers
+			const auto before = device.stats();
+			renderer->begin();
+			renderer->draw_line({ 0.f, 0.f }, { 10.f, 10.f }, white);
+			renderer->draw_filled_polygon(points.data(), count, white);
+			renderer->draw_polygon(points.data(), count, white);
+			const auto stats = renderer->stats();
+			renderer->end();
+
+			auto lines = drawn(device, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+			CHECK(lines.size() == outline.size() + 2u);
+			lines.erase(lines.begin(), lines.begin() + 2);
+			CHECK(same(fan, drawn(device, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST)) && same(outline, lines));
+			CHECK(stats.dropped == 0u && device.stats().errors == 0u);
+			CHECK(count <= fits || stats.overflow_flushes > 0u);
+			std::printf("%5zu points: %zu draws, %zu flushes forced\n", count, device.stats().draws - before.draws, stats.overflow_flushes);
+			device.draws().clear();
+		}
+	}
+}
+
+int main()
+{
+	polygons();
+	return host::failures;
+}
\ No newline at end of file
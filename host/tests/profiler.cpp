@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "device.hpp"
+#include "profiler.hpp"
+#include "check.hpp"
+
+// the percentile summaries against a sort of the same samples, and the gpu timings read back
+// from the recording device, whose clock moves a microsecond per timestamp
+namespace
+{
+	using enabled = rendering::basic_profiler<true>;
+	using disabled = rendering::basic_profiler<false>;
+
+	// nearest rank, the smallest sample with at least percent of them at or below it
+	rendering::percentiles expected(std::vector<std::uint64_t> samples)
+	{
+		std::sort(samples.begin(), samples.end());
+		const auto rank = [&](std::size_t percent) { return samples[(samples.size() * percent + 99u) / 100u - 1u]; };
+
+		auto total = std::uint64_t{ };
+		for (const auto sample : samples)
+			total += sample;
+		return { samples.size(), samples.front(), rank(50u), rank(95u), rank(99u), samples.back(), total / samples.size() };
+	}
+
+	bool same(const rendering::percentiles& a, const rendering::percentiles& b)
+	{
+		return a.samples == b.samples && a.min == b.min && a.p50 == b.p50 && a.p95 == b.p95 && a.p99 == b.p99 && a.max == b.max && a.mean == b.mean;
+	}
+
+	void summaries()
+	{
+		std::mt19937 random(15u);
+		for (const auto count : { 1u, 2u, 7u, 99u, 100u, 101u, 128u })
+		{
+			rendering::history<128> history{ };
+			std::vector<std::uint64_t> samples;
+			for (auto i = 0u; i < count; ++i)
+			{
+				samples.push_back(random() % 1000u);
+				history.add(samples.back());
+			}
+			CHECK(same(history.summarise(), expected(samples)));
+		}
+
+		// once full, only the last N samples are summarised
+		rendering::history<128> history{ };
+		std::vector<std::uint64_t> samples;
+		for (auto i = 0u; i < 300u; ++i)
+		{
+			samples.push_back(i < 172u ? 1000000u : random() % 1000u);
+			history.add(samples.back());
+		}
+		CHECK(history.count() == 128u);
+		CHECK(same(history.summarise(), expected({ samples.end() - 128, samples.end() })));
+
+		// a spike a hundredth of the time shows in p99 but not p95
+		rendering::history<100> spiky{ };
+		for (auto i = 0u; i < 100u; ++i)
+			spiky.add(i % 100u == 50u ? 5000u : 10u);
+		const auto spikes = spiky.summarise();
+		CHECK(spikes.p95 == 10u && spikes.p99 == 10u && spikes.max == 5000u);
+		spiky.add(5000u);
+		CHECK(spiky.summarise().p99 == 5000u);
+
+		CHECK(rendering::history<128>{ }.summarise().samples == 0u);
+		CHECK(rendering::history<0>{ }.summarise().samples == 0u);
+	}
+
+	void cpu()
+	{
+		// stages add up within a frame and are committed by end_frame
+		host::device device;
+		auto& context = device.immediate();
+		enabled profiler{ };
+		profiler.create(&device);
+		std::vector<std::uint64_t> draws, ends;
+		for (auto frame = 0u; frame < 50u; ++frame)
+		{
+			profiler.begin_frame(&context);
+			profiler.add(enabled::stage::draw, frame);
+			profiler.add(enabled::stage::draw, 100u);
+			profiler.add(enabled::stage::end, frame * frame);
+			profiler.end_frame(&context);
+			draws.push_back(frame + 100u);
+			ends.push_back(frame * frame);
+		}
+		CHECK(same(profiler.cpu(enabled::stage::draw), expected(draws)));
+		CHECK(same(profiler.cpu(enabled::stage::end), expected(ends)));
+		CHECK(profiler.cpu(enabled::stage::begin).max == 0u);
+		CHECK(enabled::now() != 0u && disabled::now() == 0u);
+		profiler.release();
+	}
+
+	void gpu()
+	{
+		host::device device;
+		auto& context = device.immediate();
+		enabled profiler{ };
+		profiler.create(&device);
+
+		// frames with a few timestamps of work between their start and end, each one a microsecond
+		ID3D11Query* work;
+		D3D11_QUERY_DESC desc = { D3D11_QUERY_TIMESTAMP, 0u };
+		device.CreateQuery(&desc, &work);
+
+		std::vector<std::uint64_t> times;
+		constexpr auto frames = 40u;
+		for (auto frame = 0u; frame < frames; ++frame)
+		{
+			profiler.begin_frame(&context);
+			const auto steps = frame % 7u;
+			for (auto i = 0u; i < steps; ++i)
+				context.End(work);
+			profiler.end_frame(&context);
+			times.push_back((steps + 1u) * 1000u);
+		}
+
+		// each frame is read back gpu_latency frames later, when its queries are reused
+		times.resize(frames - rendering::gpu_latency);
+		CHECK(same(profiler.gpu(), expected(times)));
+		CHECK(profiler.stats().gpu_dropped == 0u && profiler.stats().gpu_disjoint == 0u);
+
+		work->Release();
+		profiler.release();
+		CHECK(device.live_objects() == 1u);
+		CHECK(device.stats().errors == 0u);
+	}
+
+	void off()
+	{
+		// disabled, nothing is kept and no queries are made
+		host::device device;
+		auto& context = device.immediate();
+		disabled profiler{ };
+		profiler.create(&device);
+		for (auto frame = 0u; frame < 10u; ++frame)
+		{
+			profiler.begin_frame(&context);
+			profiler.add(disabled::stage::draw, 100u);
+			profiler.end_frame(&context);
+		}
+		CHECK(profiler.cpu(disabled::stage::draw).samples == 0u && profiler.gpu().samples == 0u);
+		CHECK(device.stats().queries == 0u && device.live_objects() == 1u);
+		profiler.release();
+		CHECK(sizeof(disabled) < sizeof(enabled) / 10u);
+	}
+}
+
+int main()
+{
+	summaries();
+	cpu();
+	gpu();
+	off();
+	return host::failures;
+}
\ No newline at end of file
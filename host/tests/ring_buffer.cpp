@@ -0,0 +1,187 @@
+#include <cstring>
+#include <optional>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "ring_buffer.hpp"
+#include "check.hpp"
+
+// drives rendering::ring_buffer on host::device, which fills every discarded buffer with
+// garbage, so data that an upload should have left alone shows up as changed
+namespace
+{
+	struct upload
+	{
+		UINT start;
+		std::vector<std::uint32_t> data;
+	};
+
+	bool holds(ID3D11Buffer* buffer, const upload& upload)
+	{
+		const auto& storage = host::device::storage(buffer);
+		return std::memcmp(storage.data() + upload.start * sizeof(std::uint32_t), upload.data.data(), upload.data.size() * sizeof(std::uint32_t)) == 0;
+	}
+
+	void appends_and_wraps()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		auto& context = device.immediate();
+
+		rendering::ring_buffer ring{ };
+		CHECK(ring.create(&device, D3D11_BIND_VERTEX_BUFFER, sizeof(std::uint32_t), 64u));
+
+		// everything uploaded since the last discard is what the gpu may still be reading
+		std::vector<upload> in_flight;
+		auto value = 0u;
+		auto discards = std::size_t{ };
+		auto wraps = 0u;
+		for (auto i = 0u; i < 100u; ++i)
+		{
+			upload next{ 0u, std::vector<std::uint32_t>(1u + i * 7u % 20u) };
+			for (auto& element : next.data)
+				element = ++value;
+
+			const auto discards_before = device.stats().discards;
+			const auto wraps_before = ring.stats().wraps;
+			CHECK(ring.upload(&context, next.data.data(), static_cast<UINT>(next.data.size()), next.start));
+
+			if (device.stats().discards != discards_before)
+			{
+				++discards;
+				in_flight.clear();
+				// only the first upload of a buffer and a wrap discard it
+				CHECK(next.start == 0u);
+			}
+			else
+				CHECK(!in_flight.empty() && next.start == in_flight.back().start + in_flight.back().data.size());
+			wraps += ring.stats().wraps - wraps_before;
+
+			// the first upload and a wrap take a fresh buffer, every other one appends
+			const auto discarded = i == 0u || ring.stats().wraps != wraps_before;
+			CHECK(device.maps().size() == i + 1u && device.maps().back().buffer == ring.buffer());
+			CHECK(device.maps().back().type == (discarded ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE));
+
+			in_flight.push_back(std::move(next));
+			for (const auto& upload : in_flight)
+				CHECK(holds(ring.buffer(), upload));
+		}
+
+		CHECK(discards == wraps + 1u);
+		CHECK(ring.stats().uploads == 100u);
+		CHECK(device.stats().maps == 100u && device.stats().errors == 0u);
+		ring.release();
+		CHECK(device.live_objects() == 1u);
+	}
+
+	void grows_next_frame()
+	{
+		host::device device;
+		auto& context = device.immediate();
+
+		rendering::ring_buffer ring{ };
+		CHECK(ring.create(&device, D3D11_BIND_INDEX_BUFFER, sizeof(std::uint16_t), 16u));
+		auto* first = ring.buffer();
+
+		// more than the whole buffer is refused, and the next frame makes room for it
+		std::vector<std::uint16_t> indices(40u, 7u);
+		UINT start;
+		CHECK(ring.upload(&context, indices.data(), 10u, start));
+		CHECK(!ring.upload(&context, indices.data(), 40u, start));
+		CHECK(ring.buffer() == first && ring.capacity() == 16u);
+
+		CHECK(ring.new_frame(&device));
+		CHECK(ring.capacity() == 64u && ring.buffer() != first && ring.stats().grows == 1u);
+		CHECK(ring.upload(&context, indices.data(), 40u, start) && start == 0u);
+		CHECK(!ring.new_frame(&device));
+
+		// a size that does not fit in a buffer leaves the old one and its capacity in place
+		auto* second = ring.buffer();
+		CHECK(!ring.grow(&device, 0x80000001u));
+		CHECK(!ring.grow(&device, 0x7fffffffu));
+		CHECK(ring.buffer() == second && ring.capacity() == 64u);
+		CHECK(ring.upload(&context, indices.data(), 40u, start));
+
+		// the buffer replaced by the grow was released with it, only the back buffer is left
+		ring.release();
+		CHECK(device.live_objects() == 1u);
+		CHECK(device.stats().errors == 0u);
+	}
+
+	// the renderer's vertex and index rings over frames of several flushes each. only the first
+	// map of each buffer and the maps that wrap it discard, the rest append
+	void renderer_maps()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		auto wraps = std::size_t{ };
+		auto flushes = std::size_t{ };
+		for (auto frame = 0u; frame < 8u; ++frame)
+		{
+			renderer->begin();
+			for (auto i = 0u; i < 1500u; ++i)
+				renderer->draw_filled_box({ static_cast<float>(i % 1000u), static_cast<float>(i / 1000u) * 20.f }, { 4.f, 4.f }, { 1.f, 1.f, 1.f, 1.f });
+			renderer->end();
+			wraps += renderer->stats().wraps;
+			flushes += renderer->stats().flushes;
+			CHECK(renderer->stats().grows == 0u);
+		}
+		CHECK(wraps > 0u);
+
+		auto vertex_discards = std::size_t{ }, index_discards = std::size_t{ }, appends = std::size_t{ };
+		for (const auto& map : device.maps())
+		{
+			const auto bind_flags = host::device::buffer_desc(map.buffer)->BindFlags;
+			const auto discard = map.type == D3D11_MAP_WRITE_DISCARD;
+			if (bind_flags & D3D11_BIND_VERTEX_BUFFER)
+				vertex_discards += discard;
+			else if (bind_flags & D3D11_BIND_INDEX_BUFFER)
+				index_discards += discard;
+			else
+				continue;
+			appends += !discard;
+		}
+		CHECK(vertex_discards + index_discards == wraps + 2u);
+		CHECK(vertex_discards + index_discards + appends == 2u * flushes);
+		CHECK(device.stats().errors == 0u);
+	}
+
+	void rewinds()
+	{
+		host::device device;
+		auto& context = device.immediate();
+
+		rendering::ring_buffer ring{ };
+		CHECK(ring.create(&device, D3D11_BIND_VERTEX_BUFFER, sizeof(std::uint32_t), 32u));
+
+		const std::uint32_t data[8] = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u };
+		UINT start;
+		ring.upload(&context, data, 8u, start);
+		ring.upload(&context, data, 8u, start);
+		CHECK(start == 8u);
+
+		// a rewound ring starts a fresh buffer instead of writing over what may be in flight
+		const auto discards = device.stats().discards;
+		ring.rewind();
+		ring.upload(&context, data, 8u, start);
+		CHECK(start == 0u && device.stats().discards == discards + 1u);
+		ring.release();
+	}
+}
+
+int main()
+{
+	appends_and_wraps();
+	grows_next_frame();
+	renderer_maps();
+	rewinds();
+	return host::failures;
+}
\ No newline at end of file
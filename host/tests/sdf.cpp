@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <random>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "sdf.hpp"
+#include "tessellation.hpp"
+#include "check.hpp"
+
+// the cpu distance functions the sdf shaders mirror, against a geometric reference and the
+// analytic areas of the shapes, and what the renderer sends the recording device for them
+namespace
+{
+	namespace sdf = rendering::sdf;
+
+	constexpr auto pi = 3.14159265358979323846;
+
+	// distance from a rounded box's edge worked out case by case: in a corner square it is
+	// the distance to that corner's circle, elsewhere to the nearest straight edge
+	double reference(double x, double y, double half_x, double half_y, double radius)
+	{
+		x = std::fabs(x), y = std::fabs(y);
+		const auto cx = half_x - radius, cy = half_y - radius;
+		if (x > cx && y > cy)
+			return std::hypot(x - cx, y - cy) - radius;
+		if (x <= half_x && y <= half_y)
+			return -std::min(half_x - x, half_y - y);
+		return std::max(x - half_x, y - half_y);
+	}
+
+	void distances()
+	{
+		std::mt19937 random(23u);
+		std::uniform_real_distribution<float> half(1.f, 200.f), unit(0.f, 1.f), offset(-1.5f, 1.5f);
+		auto worst = 0.;
+		for (auto i = 0u; i < 100000u; ++i)
+		{
+			const auto shape = sdf::rounded_box({ half(random), half(random) }, half(random) * unit(random), 0.f);
+			const rendering::vec2 local = { shape.half_size.x * offset(random), shape.half_size.y * offset(random) };
+			const auto expected = reference(local.x, local.y, shape.half_size.x, shape.half_size.y, shape.radius);
+			worst = std::max(worst, std::fabs(sdf::distance(local, shape) - expected));
+
+			// an outline is the band thickness deep inside the edge
+			const auto outline = sdf::rounded_box(shape.half_size, shape.radius, 3.f);
+			const auto band = std::fabs(expected + outline.thickness * .5) - outline.thickness * .5;
+			worst = std::max(worst, std::fabs(sdf::distance(local, outline) - band));
+		}
+		CHECK(worst < 1e-3);
+
+		// the edge fades over one pixel centred on it
+		const auto circle = sdf::circle(10.f, 0.f);
+		CHECK(sdf::coverage({ 9.5f, 0.f }, circle) == 1.f && sdf::coverage({ 10.f, 0.f }, circle) == .5f && sdf::coverage({ 10.5f, 0.f }, circle) == 0.f);
+
+		// sizes that cannot hold the radius or thickness clamp them
+		const auto clamped = sdf::rounded_box({ -8.f, 5.f }, 20.f, 9.f);
+		CHECK(clamped.half_size.x == 8.f && clamped.radius == 5.f && clamped.thickness == 5.f);
+		CHECK(sdf::rounded_box({ 8.f, 5.f }, -1.f, -1.f).radius == 0.f);
+	}
+
+	// coverage summed over the pixels, off centre so no row lines up with the edge
+	double area(const sdf::shape& shape)
+	{
+		const auto reach = static_cast<int>(std::max(shape.half_size.x, shape.half_size.y)) + 2;
+		auto sum = 0.;
+		for (auto y = -reach; y <= reach; ++y)
+			for (auto x = -reach; x <= reach; ++x)
+				sum += sdf::coverage({ x + .37f, y + .21f }, shape);
+		return sum;
+	}
+
+	void areas()
+	{
+		// a one pixel ramp across a curved edge adds about 1 / (12 r^2) of the area
+		for (const auto radius : { 3.f, 5.f, 12.f, 50.f, 121.f, 200.f })
+			CHECK(std::fabs(area(sdf::circle(radius, 0.f)) / (pi * radius * radius) - 1.) < 1. / (10. * radius * radius) + 1e-4);
+
+		// a box loses the squares of its corners outside the quarter circles
+		const auto rounded = [](double w, double h, double r) { return 4. * w * h - (4. - pi) * r * r; };
+		CHECK(std::fabs(area(sdf::rounded_box({ 60.f, 25.f }, 10.f, 0.f)) / rounded(60., 25., 10.) - 1.) < .001);
+		CHECK(std::fabs(area(sdf::rounded_box({ 60.f, 25.f }, 0.f, 0.f)) / rounded(60., 25., 0.) - 1.) < .001);
+
+		// an outline keeps the outer edge, its inside is the box shrunk by the thickness with
+		// the corner radius shrunk as far as it goes
+		const auto outline = rounded(60., 25., 10.) - rounded(56., 21., 6.);
+		CHECK(std::fabs(area(sdf::rounded_box({ 60.f, 25.f }, 10.f, 4.f)) / outline - 1.) < .005);
+
+		const auto ring = pi * (30. * 30. - 24. * 24.);
+		const auto drawn = area(sdf::circle(30.f, 6.f));
+		CHECK(std::fabs(drawn / ring - 1.) < .005);
+		std::printf("24-30 ring: %.1f px covered, %.1f analytic\n", drawn, ring);
+	}
+
+	void quads()
+	{
+		// the quad reaches a pixel past the edge, and the corners agree on the shape
+		sdf::vertex vertices[4];
+		const auto shape = sdf::rounded_box({ 20.f, 10.f }, 4.f, 0.f);
+		sdf::write(vertices, { 100.f, 50.f }, shape, { 1.f, 1.f, 1.f, 1.f });
+		CHECK(vertices[0].pos.x == 79.f && vertices[0].pos.y == 39.f && vertices[3].pos.x == 121.f && vertices[3].pos.y == 61.f);
+		for (const auto& vertex : vertices)
+		{
+			CHECK(vertex.pos.x - vertex.local.x == 100.f && vertex.pos.y - vertex.local.y == 50.f);
+			CHECK(std::memcmp(&vertex.shape, &shape, sizeof(shape)) == 0 && sdf::coverage(vertex.local, shape) == 0.f);
+		}
+
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// 300 circles of every size cost 6 vertices each, max_shapes to a draw
+		device.draws().clear();
+		renderer->begin();
+		for (auto i = 0u; i < 300u; ++i)
+			renderer->draw_filled_smooth_circle({ static_cast<float>(i % 20u) * 60.f + 30.f, static_cast<float>(i / 20u) * 45.f + 20.f }, 2.f + static_cast<float>(i % 40u), { 1.f, 0.f, 0.f, 1.f });
+		renderer->end();
+
+		auto vertex_count = std::size_t{ };
+		for (const auto& draw : device.draws())
+		{
+			CHECK(draw.stride == sizeof(sdf::vertex) && draw.topology == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			vertex_count += draw.count();
+		}
+		CHECK(device.draws().size() == (300u + rendering::default_config::max_shapes - 1u) / rendering::default_config::max_shapes);
+		CHECK(vertex_count == 300u * 6u && renderer->stats().shapes == 300u && device.stats().errors == 0u);
+
+		// a tessellated circle needs more vertices the larger it is, an sdf one always 4
+		for (const auto radius : { 4.f, 64.f, 1024.f })
+		{
+			const auto segments = rendering::tessellation::segments(radius, rendering::circle_error);
+			CHECK(segments + 1u > 4u);
+			std::printf("filled circle of radius %.0f: %zu vertices and %zu indices tessellated, 4 and 6 from a distance field\n",
+				radius, segments + 1u, segments * 3u);
+		}
+	}
+}
+
+int main()
+{
+	distances();
+	areas();
+	quads();
+	return host::failures;
+}
\ No newline at end of file
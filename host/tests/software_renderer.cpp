@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "software_renderer.hpp"
+#include "check.hpp"
+
+// the software renderer against a plain per pixel rasterizer written from the same rules:
+// pixel centres, the top-left fill rule, one pixel per step along a line's major axis and
+// source over blending rounded like the sse path. the recorded streams come from a draw_list,
+// so both sides rasterize exactly the same vertices in the same order
+namespace
+{
+	rendering::software_renderer renderer;
+	rendering::draw_list list;
+
+	struct image
+	{
+		image(std::uint32_t width, std::uint32_t height, std::uint32_t pitch)
+			: width(width)
+			, height(height)
+			, pitch(pitch)
+			, pixels(static_cast<std::size_t>(pitch) * height)
+		{ }
+
+		std::uint32_t width;
+		std::uint32_t height;
+		std::uint32_t pitch;
+		std::vector<std::uint32_t> pixels;
+	};
+
+	constexpr rendering::colour background = { .1f, .2f, .3f, 1.f };
+
+	void blend(std::uint32_t& dst, std::uint32_t src)
+	{
+		const auto alpha = src >> 24;
+		std::uint32_t result = 0u;
+		for (auto shift = 0u; shift < 32u; shift += 8u)
+		{
+			const auto value = ((src >> shift) & 0xffu) * alpha + ((dst >> shift) & 0xffu) * (255u - alpha) + 128u;
+			result |= ((value + (value >> 8)) >> 8) << shift;
+		}
+		dst = result;
+	}
+
+	std::uint32_t lerp(std::uint32_t a, std::uint32_t b, double t)
+	{
+		std::uint32_t result = 0u;
+		for (auto shift = 0u; shift < 32u; shift += 8u)
+		{
+			const auto from = static_cast<double>((a >> shift) & 0xffu);
+			const auto to = static_cast<double>((b >> shift) & 0xffu);
+			result |= static_cast<std::uint32_t>(from + (to - from) * t + .5) << shift;
+		}
+		return result;
+	}
+
+	void triangle(image& target, const rendering::vertex* v0, const rendering::vertex* v1, const rendering::vertex* v2)
+	{
+		auto area = (static_cast<double>(v1->pos.x) - v0->pos.x) * (static_cast<double>(v2->pos.y) - v0->pos.y) - (static_cast<double>(v1->pos.y) - v0->pos.y) * (static_cast<double>(v2->pos.x) - v0->pos.x);
+		if (area == 0.)
+			return;
+		if (area < 0.)
+		{
+			std::swap(v1, v2);
+			area = -area;
+		}
+
+		const rendering::vertex* v[3] = { v0, v1, v2 };
+		const auto flat = v0->colour == v1->colour && v1->colour == v2->colour;
+		for (auto y = 0u; y < target.height; ++y)
+		{
+			for (auto x = 0u; x < target.width; ++x)
+			{
+				double w[3];
+				auto inside = true;
+				for (auto i = 0u; i < 3u; ++i)
+				{
+					const auto from = v[(i + 1u) % 3u]->pos, to = v[(i + 2u) % 3u]->pos;
+					const double a = from.y - to.y, b = to.x - from.x;
+					w[i] = a * (x + .5 - from.x) + b * (y + .5 - from.y);
+					const auto top_left = (a == 0. && b > 0.) || a > 0.;
+					inside &= top_left ? w[i] >= 0. : w[i] > 0.;
+				}
+				if (!inside)
+					continue;
+
+				auto colour = v0->colour;
+				if (!flat)
+				{
+					colour = 0u;
+					for (auto shift = 0u; shift < 32u; shift += 8u)
+					{
+						auto value = 0.;
+						for (auto i = 0u; i < 3u; ++i)
+							value += w[i] * ((v[i]->colour >> shift) & 0xffu) / area;
+						colour |= static_cast<std::uint32_t>(std::nearbyint(value)) << shift;
+					}
+				}
+				blend(target.pixels[y * target.pitch + x], colour);
+			}
+		}
+	}
+
+	void line(image& target, const rendering::vertex& from, const rendering::vertex& to)
+	{
+		const double dx = to.pos.x - from.pos.x, dy = to.pos.y - from.pos.y;
+		const auto x_major = std::fabs(dx) >= std::fabs(dy);
+		const auto length = x_major ? dx : dy;
+		if (length == 0.)
+			return;
+
+		const double start = x_major ? from.pos.x : from.pos.y;
+		const double minor_start = x_major ? from.pos.y : from.pos.x;
+		const auto slope = (x_major ? dy : dx) / length;
+		const auto lower = std::fmin(start, start + length), upper = std::fmax(start, start + length);
+		for (auto major = static_cast<long>(std::floor(lower - .5)) + 1; major < static_cast<long>(std::floor(upper - .5)) + 1; ++major)
+		{
+			const auto minor = static_cast<long>(std::floor(minor_start + slope * (major + .5 - start)));
+			const auto x = x_major ? major : minor, y = x_major ? minor : major;
+			if (x < 0 || y < 0 || x >= static_cast<long>(target.width) || y >= static_cast<long>(target.height))
+				continue;
+			const auto colour = from.colour == to.colour ? from.colour : lerp(from.colour, to.colour, (major + .5 - start) / length);
+			blend(target.pixels[y * target.pitch + x], colour);
+		}
+	}
+
+	void point(image& target, const rendering::vertex& vertex)
+	{
+		const auto x = static_cast<long>(std::floor(vertex.pos.x)), y = static_cast<long>(std::floor(vertex.pos.y));
+		if (x >= 0 && y >= 0 && x < static_cast<long>(target.width) && y < static_cast<long>(target.height))
+			blend(target.pixels[y * target.pitch + x], vertex.colour);
+	}
+
+	void reference(image& target, const rendering::draw_list& list)
+	{
+		for (auto block = 0u; block < list.block_count(); ++block)
+		{
+			const auto* vertices = list.vertices(block);
+			const auto* indices = list.indices(block);
+			auto first = std::size_t{ };
+			for (auto i = 0u; i < list.batch_count(block); ++i)
+			{
+				const auto& batch = list.batches(block)[i];
+				for (auto index = first; index < first + batch.count; )
+				{
+					switch (batch.topology)
+					{
+					case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST:
+						triangle(target, &vertices[indices[index]], &vertices[indices[index + 1u]], &vertices[indices[index + 2u]]);
+						index += 3u;
+						break;
+					case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:
+						line(target, vertices[indices[index]], vertices[indices[index + 1u]]);
+						index += 2u;
+						break;
+					default:
+						point(target, vertices[indices[index]]);
+						++index;
+						break;
+					}
+				}
+				first += batch.count;
+			}
+		}
+	}
+
+	void clear(image& target)
+	{
+		std::fill(target.pixels.begin(), target.pixels.end(), 0xdeadbeefu);
+		for (auto y = 0u; y < target.height; ++y)
+			std::fill_n(target.pixels.begin() + y * target.pitch, target.width, rendering::pack(background));
+	}
+
+	// boxes, lines and circles at fractional positions with some alpha, and gradient
+	// triangles and points added directly
+	template<typename Recorder>
+	void scene(Recorder& recorder, std::uint32_t width, std::uint32_t height, std::uint32_t count)
+	{
+		std::mt19937 random(13u);
+		auto coordinate = [&](std::uint32_t extent) { return static_cast<float>(random() % (extent * 8u + 64u)) / 8.f - 4.f; };
+		auto colour = [&] { return rendering::colour{ (random() % 256u) / 255.f, (random() % 256u) / 255.f, (random() % 256u) / 255.f, (128u + random() % 128u) / 255.f }; };
+
+		for (auto i = 0u; i < count; ++i)
+		{
+			const rendering::vec2 a = { coordinate(width), coordinate(height) }, b = { coordinate(width), coordinate(height) };
+			switch (i % 6u)
+			{
+			case 0u:
+				recorder.draw_filled_box(a, { static_cast<float>(random() % 400u) / 8.f, static_cast<float>(random() % 400u) / 8.f }, colour());
+				break;
+			case 1u:
+				recorder.draw_line(a, b, colour());
+				break;
+			case 2u:
+				recorder.draw_filled_circle(a, static_cast<float>(random() % 200u) / 8.f + 1.f, colour());
+				break;
+			case 3u:
+			{
+				// kept within a tile or so, like most of what a frame draws
+				const rendering::vec2 c = { a.x + coordinate(64u) - 32.f, a.y + coordinate(64u) - 32.f }, d = { a.x + coordinate(64u) - 32.f, a.y + coordinate(64u) - 32.f };
+				const std::array<rendering::vertex, 3> triangle = { { { a, rendering::pack(colour()) }, { c, rendering::pack(colour()) }, { d, rendering::pack(colour()) } } };
+				recorder.add_vertices(triangle, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+				break;
+			}
+			case 4u:
+				recorder.draw_box(a, { static_cast<float>(random() % 400u) / 8.f, static_cast<float>(random() % 400u) / 8.f }, colour());
+				break;
+			default:
+			{
+				const std::array<rendering::vertex, 2> points = { { { a, rendering::pack(colour()) }, { b, rendering::pack(colour()) } } };
+				recorder.add_vertices(points, D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+				break;
+			}
+			}
+		}
+	}
+
+	template<typename Record>
+	void render(image& target, Record&& record)
+	{
+		clear(target);
+		renderer.set_target(target.pixels.data(), target.width, target.height, target.pitch);
+		renderer.begin();
+		record();
+		renderer.end();
+	}
+
+	std::size_t differences(const image& a, const image& b)
+	{
+		auto count = std::size_t{ };
+		for (auto i = 0u; i < a.pixels.size(); ++i)
+			count += a.pixels[i] != b.pixels[i];
+		return count;
+	}
+
+	void against_reference()
+	{
+		// not a multiple of the tile size, and a pitch past the width that must stay untouched
+		constexpr auto width = 301u, height = 203u, pitch = 320u;
+		image recorded(width, height, pitch), listed(width, height, pitch), expected(width, height, pitch);
+
+		list.set_viewport({ 0.f, 0.f }, { static_cast<float>(width), static_cast<float>(height) });
+		list.begin();
+		scene(list, width, height, 600u);
+		list.submit();
+		CHECK(list.stats().dropped == 0u);
+
+		render(recorded, [&] { scene(renderer, width, height, 600u); });
+		render(listed, [&] { renderer.draw(list); });
+		clear(expected);
+		reference(expected, list);
+		list.release();
+
+		// recording straight into the renderer flushes elsewhere than the list's blocks, but
+		// every pixel still sees the same primitives in the same order
+		CHECK(differences(recorded, listed) == 0u);
+
+		// only rounding of edge values and gradients that land exactly on a boundary may differ
+		const auto different = differences(listed, expected);
+		std::printf("%zu of %u pixels differ from the reference\n", different, width * height);
+		CHECK(different < width * height / 1000u);
+
+		for (auto y = 0u; y < height; ++y)
+			for (auto x = width; x < pitch; ++x)
+				CHECK(recorded.pixels[y * pitch + x] == 0xdeadbeefu);
+	}
+
+	// bin() once, then the tiles shared out over several threads, against end()
+	void threaded()
+	{
+		constexpr auto width = 640u, height = 480u;
+		image single(width, height, width), shared(width, height, width);
+
+		// few enough to stay in one flush, which is all bin() sees
+		render(single, [&] { scene(renderer, width, height, 120u); });
+
+		clear(shared);
+		renderer.set_target(shared.pixels.data(), width, height, width);
+		renderer.begin();
+		scene(renderer, width, height, 120u);
+		const auto tiles = renderer.bin();
+		CHECK(tiles == 10u * 8u);
+
+		std::vector<std::thread> workers;
+		for (auto i = 0u; i < 4u; ++i)
+			workers.emplace_back([&, i] { renderer.rasterize(tiles * i / 4u, tiles * (i + 1u) / 4u - tiles * i / 4u); });
+		for (auto& worker : workers)
+			worker.join();
+		renderer.finish();
+		renderer.end();
+
+		CHECK(differences(single, shared) == 0u);
+	}
+
+	// enough screen sized boxes to overflow the bins, which then scan every primitive per tile
+	void unbinned()
+	{
+		constexpr auto width = 1920u, height = 1080u;
+		image actual(width, height, width), expected(width, height, width);
+
+		auto record = [&](auto& recorder)
+		{
+			for (auto i = 0u; i < 40u; ++i)
+				recorder.draw_filled_box({ static_cast<float>(i * 7u), static_cast<float>(i * 3u) }, { 1800.f, 1000.f }, { (i % 5u) / 4.f, .5f, 1.f - (i % 3u) / 2.f, .25f });
+		};
+
+		list.set_viewport({ 0.f, 0.f }, { static_cast<float>(width), static_cast<float>(height) });
+		list.begin();
+		record(list);
+		list.submit();
+
+		render(actual, [&] { record(renderer); });
+		clear(expected);
+		reference(expected, list);
+		list.release();
+
+		// whole pixel boxes leave nothing to rounding
+		CHECK(differences(actual, expected) == 0u);
+	}
+
+	void timing()
+	{
+		for (const auto& [width, height] : { std::pair{ 1920u, 1080u }, std::pair{ 3840u, 2160u } })
+		{
+			image target(width, height, width);
+			constexpr auto frames = 5u;
+			const auto start = std::chrono::steady_clock::now();
+			for (auto i = 0u; i < frames; ++i)
+				render(target, [&] { scene(renderer, width, height, 10000u); });
+			const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			std::printf("%ux%u, 10000 primitives: %.2f ms per frame\n", width, height, elapsed / frames);
+		}
+	}
+}
+
+int main()
+{
+	against_reference();
+	threaded();
+	unbinned();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
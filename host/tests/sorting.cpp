@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "sorting.hpp"
+#include "check.hpp"
+
+// the radix sort against std::sort, the order the keys give batches, and what the renderer
+// then sends to the recording device: layers in order, and within a layer grouped by state
+// or in recorded order, whichever the default config compiles
+namespace
+{
+	namespace sorting = rendering::sorting;
+
+	std::vector<std::uint64_t> radix(std::vector<std::uint64_t> keys)
+	{
+		std::vector<std::uint64_t> scratch(keys.size());
+		const auto* sorted = sorting::radix_sort(keys.data(), scratch.data(), keys.size());
+		return { sorted, sorted + keys.size() };
+	}
+
+	void radix_sort()
+	{
+		std::mt19937_64 random(16u);
+		for (const auto count : { 0u, 1u, 2u, 3u, 100u, 4096u })
+		{
+			// random keys, keys sharing every byte but one, and keys already in order
+			for (const auto mask : { ~0ull, 0xff00ull, 0xff000000000000ffull })
+			{
+				std::vector<std::uint64_t> keys(count);
+				for (auto& key : keys)
+					key = (random() & mask) | 0x1200000000000000ull;
+
+				auto expected = keys;
+				std::sort(expected.begin(), expected.end());
+				CHECK(radix(keys) == expected);
+				CHECK(radix(expected) == expected);
+			}
+		}
+	}
+
+	// draws left for a batch order, consecutive batches of the same topology merge
+	std::size_t runs(const std::vector<D3D11_PRIMITIVE_TOPOLOGY>& topologies, bool by_state)
+	{
+		std::vector<std::uint64_t> keys;
+		for (auto i = 0u; i < topologies.size(); ++i)
+			keys.push_back(by_state ? sorting::make_key(0u, rendering::shape_type::none, topologies[i], i) : sorting::make_key(0u, i));
+		keys = radix(keys);
+
+		auto count = std::size_t{ };
+		for (auto i = 0u; i < keys.size(); ++i)
+			count += i == 0u || topologies[sorting::sequence(keys[i])] != topologies[sorting::sequence(keys[i - 1u])];
+		return count;
+	}
+
+	void keys()
+	{
+		// the layer outranks everything, the sequence only breaks ties
+		CHECK(sorting::make_key(1u, 0u) > sorting::make_key(0u, 0xffffffffu));
+		CHECK(sorting::make_key(1u, rendering::shape_type::none, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, 0u) > sorting::make_key(0u, rendering::shape_type::circle, D3D11_PRIMITIVE_TOPOLOGY_POINTLIST, 5u));
+		CHECK(sorting::make_key(0u, rendering::shape_type::none, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, 9u) < sorting::make_key(0u, rendering::shape_type::none, D3D11_PRIMITIVE_TOPOLOGY_LINELIST, 1u));
+		CHECK(sorting::sequence(sorting::make_key(3u, 1234u)) == 1234u);
+
+		// fills and outlines alternating in one layer draw once each by default, and merge
+		// into one draw per topology when grouped by state
+		std::vector<D3D11_PRIMITIVE_TOPOLOGY> alternating;
+		for (auto i = 0u; i < 40u; ++i)
+			alternating.push_back(i % 2u ? D3D11_PRIMITIVE_TOPOLOGY_LINELIST : D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		const auto kept = runs(alternating, false), grouped = runs(alternating, true);
+		CHECK(kept == 40u && grouped == 2u);
+		std::printf("alternating fills and lines: %zu draws in recorded order, %zu grouped by state\n", kept, grouped);
+	}
+
+	struct drawn
+	{
+		D3D11_PRIMITIVE_TOPOLOGY topology;
+		std::vector<std::uint32_t> colours;
+	};
+
+	// each captured draw with the colours of its primitives in the order they are drawn
+	std::vector<drawn> draws(host::device& device)
+	{
+		std::vector<drawn> result;
+		for (const auto& draw : device.draws())
+		{
+			auto& entry = result.emplace_back(drawn{ draw.topology, { } });
+			for (auto i = 0u; i < draw.count(); ++i)
+			{
+				rendering::vertex vertex;
+				std::memcpy(&vertex, draw.data.data() + i * draw.stride, sizeof(vertex));
+				if (entry.colours.empty() || entry.colours.back() != vertex.colour)
+					entry.colours.push_back(vertex.colour);
+			}
+		}
+		return result;
+	}
+
+	void rendered()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		const rendering::colour a = { 1.f, 0.f, 0.f, 1.f }, b = { 0.f, 1.f, 0.f, 1.f }, c = { 0.f, 0.f, 1.f, 1.f }, d = { 1.f, 1.f, 1.f, 1.f };
+
+		// layer 0 draws before layer 1 whatever the recording order
+		device.draws().clear();
+		renderer->begin();
+		renderer->set_sort_layer(1u);
+		renderer->draw_filled_box({ 10.f, 10.f }, { 10.f, 10.f }, a);
+		renderer->set_sort_layer(0u);
+		renderer->draw_line({ 0.f, 0.f }, { 50.f, 50.f }, b);
+		renderer->set_sort_layer(1u);
+		renderer->draw_line({ 50.f, 0.f }, { 0.f, 50.f }, c);
+		renderer->set_sort_layer(0u);
+		renderer->draw_filled_box({ 30.f, 30.f }, { 10.f, 10.f }, d);
+		renderer->end();
+
+		const auto layered = draws(device);
+		constexpr auto fill = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, line = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
+		if constexpr (rendering::default_config::state_sorting)
+		{
+			// fills go first within each layer
+			CHECK(layered.size() == 4u);
+			if (layered.size() == 4u)
+			{
+				CHECK(layered[0].topology == fill && layered[0].colours == std::vector{ rendering::pack(d) });
+				CHECK(layered[1].topology == line && layered[1].colours == std::vector{ rendering::pack(b) });
+				CHECK(layered[2].topology == fill && layered[2].colours == std::vector{ rendering::pack(a) });
+				CHECK(layered[3].topology == line && layered[3].colours == std::vector{ rendering::pack(c) });
+			}
+		}
+		else
+		{
+			// neighbours of the same topology merge across the layer boundary
+			CHECK(layered.size() == 3u);
+			if (layered.size() == 3u)
+			{
+				CHECK(layered[0].topology == line && layered[0].colours == std::vector{ rendering::pack(b) });
+				CHECK(layered[1].topology == fill && layered[1].colours == (std::vector{ rendering::pack(d), rendering::pack(a) }));
+				CHECK(layered[2].topology == line && layered[2].colours == std::vector{ rendering::pack(c) });
+			}
+		}
+
+		// alternating kinds in one layer merge into a draw per topology when grouped by state,
+		// each keeping its recorded order. otherwise they draw one by one
+		device.draws().clear();
+		const auto state_sets = device.stats().state_sets;
+		renderer->begin();
+		for (auto i = 0u; i < 20u; ++i)
+		{
+			const auto colour = rendering::colour{ static_cast<float>(i) / 255.f, 0.f, 0.f, 1.f };
+			if (i % 2u)
+				renderer->draw_line({ 0.f, static_cast<float>(i) }, { 100.f, static_cast<float>(i) }, colour);
+			else
+				renderer->draw_filled_box({ 0.f, static_cast<float>(i) }, { 100.f, 1.f }, colour);
+		}
+		renderer->end();
+
+		const auto alternating = draws(device);
+		if constexpr (rendering::default_config::state_sorting)
+		{
+			CHECK(alternating.size() == 2u);
+			for (auto i = 0u; i < alternating.size(); ++i)
+			{
+				CHECK(alternating[i].topology == (i == 0u ? fill : line) && alternating[i].colours.size() == 10u);
+				for (auto j = 0u; j < alternating[i].colours.size(); ++j)
+					CHECK((alternating[i].colours[j] & 0xffu) == j * 2u + i);
+			}
+		}
+		else
+		{
+			CHECK(alternating.size() == 20u);
+			for (auto i = 0u; i < alternating.size(); ++i)
+				CHECK(alternating[i].colours.size() == 1u && (alternating[i].colours[0] & 0xffu) == i);
+		}
+		std::printf("20 alternating primitives: %zu draws, %zu state changes, %zu device state calls\n",
+			alternating.size(), renderer->stats().state_changes, device.stats().state_sets - state_sets);
+		CHECK(device.stats().errors == 0u);
+	}
+
+	// fills, outlines, lines and circles in random order over four layers, with a label on
+	// top. what a frame of them costs in draws and state changes, and in time
+	void timing()
+	{
+		host::device device;
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		std::mt19937 random(160u);
+		std::uniform_real_distribution<float> x(0.f, 1280.f), y(0.f, 720.f);
+		struct primitive
+		{
+			std::uint32_t kind;
+			std::uint8_t layer;
+			rendering::vec2 a, b;
+		};
+		for (const auto count : { 100u, 1000u, 10000u })
+		{
+			std::vector<primitive> primitives;
+			for (auto i = 0u; i < count; ++i)
+				primitives.push_back({ static_cast<std::uint32_t>(random() % 4u), static_cast<std::uint8_t>(random() % 4u), { x(random), y(random) }, { x(random), y(random) } });
+
+			auto frame = [&]
+			{
+				renderer->begin();
+				for (const auto& primitive : primitives)
+				{
+					const rendering::colour colour = { static_cast<float>(primitive.layer) / 4.f, .5f, 1.f, 1.f };
+					renderer->set_sort_layer(primitive.layer);
+					if (primitive.kind == 0u)
+						renderer->draw_filled_box(primitive.a, { 12.f, 8.f }, colour);
+					else if (primitive.kind == 1u)
+						renderer->draw_box(primitive.a, { 12.f, 8.f }, colour);
+					else if (primitive.kind == 2u)
+						renderer->draw_line(primitive.a, primitive.b, colour);
+					else
+						renderer->draw_filled_circle(primitive.a, 6.f, colour);
+				}
+				renderer->draw_text({ 10.f, 10.f }, "mixed frame", { 1.f, 1.f, 1.f, 1.f });
+				renderer->end();
+				return renderer->stats();
+			};
+
+			const auto before = device.stats();
+			const auto stats = frame();
+			const auto sets = device.stats().state_sets - before.state_sets;
+			CHECK(stats.dropped == 0u && stats.draw_calls <= stats.batches_recorded + 1u);
+
+			constexpr auto frames = 50u;
+			const auto start = std::chrono::steady_clock::now();
+			for (auto i = 0u; i < frames; ++i)
+				frame();
+			const auto microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+			std::printf("%5u mixed primitives, %s: %4zu batches, %4zu draws, %4zu flushes, %4zu state changes, %4zu skipped, %4zu device sets, %7.1f us\n",
+				count, rendering::default_config::state_sorting ? "grouped by state" : "recorded order", stats.batches_recorded, stats.draw_calls, stats.flushes,
+				stats.state_changes, stats.redundant_states, sets, microseconds);
+		}
+		CHECK(device.stats().errors == 0u);
+	}
+}
+
+int main()
+{
+	radix_sort();
+	keys();
+	rendered();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
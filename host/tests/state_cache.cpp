@@ -0,0 +1,156 @@
+#include <cstdio>
+#include <optional>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "state_cache.hpp"
+#include "check.hpp"
+
+// state calls counted on the recording device: what the cache drops, what the backup reads
+// and puts back, and what whole renderer frames cost
+namespace
+{
+	constexpr auto pieces = 13u;
+
+	ID3D11Buffer* make_buffer(host::device& device)
+	{
+		D3D11_BUFFER_DESC desc = { };
+		desc.ByteWidth = 256u;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		ID3D11Buffer* buffer;
+		device.CreateBuffer(&desc, nullptr, &buffer);
+		return buffer;
+	}
+
+	template<bool Lazy>
+	void cache()
+	{
+		host::device device;
+		auto& context = device.immediate();
+
+		// what the game left bound
+		auto* game_buffer = make_buffer(device);
+		const UINT game_stride = 32u, game_offset = 16u;
+		context.IASetVertexBuffers(0u, 1u, &game_buffer, &game_stride, &game_offset);
+		context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+		auto* buffer = make_buffer(device);
+		const auto live = device.live_objects();
+
+		rendering::basic_state_cache<Lazy> cache{ };
+		auto stats = device.stats();
+		cache.begin(&context);
+		CHECK(device.stats().state_gets - stats.state_gets == (Lazy ? 0u : pieces));
+		CHECK(device.stats().state_sets == stats.state_sets);
+
+		// binding what is already bound is dropped, a different stride is not
+		stats = device.stats();
+		cache.set_topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		cache.set_topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		cache.set_vertex_buffer(buffer, 12u);
+		cache.set_vertex_buffer(buffer, 12u);
+		cache.set_vertex_buffer(buffer, 16u);
+		cache.set_scissor_rect({ 0, 0, 10, 10 });
+		cache.set_scissor_rect({ 0, 0, 10, 10 });
+		CHECK(cache.stats().calls == 4u && cache.stats().skipped == 3u);
+		CHECK(device.stats().state_sets - stats.state_sets == 4u);
+
+		// lazily, each piece is read the first time it changes
+		const auto saved = Lazy ? 3u : pieces;
+		CHECK(device.stats().state_gets - stats.state_gets == (Lazy ? saved : 0u));
+
+		// only what was saved is put back
+		stats = device.stats();
+		cache.end();
+		CHECK(device.stats().state_sets - stats.state_sets == saved);
+
+		ID3D11Buffer* bound;
+		UINT stride, offset;
+		context.IAGetVertexBuffers(0u, 1u, &bound, &stride, &offset);
+		CHECK(bound == game_buffer && stride == game_stride && offset == game_offset);
+		bound->Release();
+		D3D11_PRIMITIVE_TOPOLOGY topology;
+		context.IAGetPrimitiveTopology(&topology);
+		CHECK(topology == D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+
+		// the next frame binds again, the game may have changed anything in between
+		stats = device.stats();
+		cache.begin(&context);
+		cache.set_topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		CHECK(cache.stats().calls == 1u && cache.stats().skipped == 0u);
+		cache.end();
+
+		// every reference the backup took was given back
+		CHECK(device.live_objects() == live);
+		buffer->Release();
+		game_buffer->Release();
+		CHECK(device.live_objects() == live - 2u);
+		CHECK(device.stats().errors == 0u);
+	}
+
+	struct frame_cost
+	{
+		std::size_t gets;
+		std::size_t sets;
+		std::size_t draws;
+	};
+
+	template<typename Record>
+	frame_cost frame(host::device& device, rendering::renderer& renderer, Record&& record)
+	{
+		const auto before = device.stats();
+		renderer.begin();
+		record();
+		renderer.end();
+
+		const auto after = device.stats();
+		const frame_cost cost = { after.state_gets - before.state_gets, after.state_sets - before.state_sets, after.draws - before.draws };
+
+		// the renderer's own binds plus one set for every piece the backup read
+		CHECK(cost.sets == renderer.stats().state_changes + cost.gets);
+		return cost;
+	}
+
+	void frames()
+	{
+		host::device device;
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// a frame that draws nothing touches nothing, unless everything is saved up front
+		const auto empty = frame(device, *renderer, [] { });
+		CHECK(empty.draws == 0u && empty.gets == (rendering::default_config::lazy_state_backup ? 0u : pieces));
+		std::printf("empty frame: %zu gets, %zu sets\n", empty.gets, empty.sets);
+
+		// fills and lines alternating still bind each shader and buffer once
+		auto mixed = [&]
+		{
+			for (auto i = 0u; i < 200u; ++i)
+			{
+				renderer->draw_filled_box({ static_cast<float>(i), 10.f }, { 5.f, 5.f }, { 1.f, 0.f, 0.f, 1.f });
+				renderer->draw_line({ static_cast<float>(i), 30.f }, { static_cast<float>(i), 60.f }, { 0.f, 1.f, 0.f, 1.f });
+			}
+			renderer->draw_text({ 20.f, 400.f }, "state calls", { 1.f, 1.f, 1.f, 1.f });
+		};
+		const auto first = frame(device, *renderer, mixed);
+		const auto second = frame(device, *renderer, mixed);
+		CHECK(first.sets == second.sets && first.gets == second.gets);
+		CHECK(renderer->stats().redundant_states > 0u);
+
+		// a topology change per draw, everything else bound once per pipeline
+		CHECK(renderer->stats().state_changes < first.draws + 2u * pieces);
+		std::printf("400 alternating primitives and a label: %zu draws, %zu gets, %zu sets, %zu binds skipped\n",
+			first.draws, first.gets, first.sets, renderer->stats().redundant_states);
+		CHECK(device.stats().errors == 0u);
+	}
+}
+
+int main()
+{
+	cache<false>();
+	cache<true>();
+	frames();
+	return host::failures;
+}
\ No newline at end of file
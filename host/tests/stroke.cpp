@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <tuple>
+#include <vector>
+#include "software_renderer.hpp"
+#include "stroke.hpp"
+#include "check.hpp"
+
+// stroke geometry, counted and written, and what it covers once rasterized. white strokes
+// on black through the software renderer leave their coverage in every channel, which is
+// compared with the distance of each pixel centre from the ideal outline
+namespace
+{
+	namespace stroke = rendering::stroke;
+
+	constexpr auto size = 200u;
+	constexpr rendering::colour white = { 1.f, 1.f, 1.f, 1.f };
+
+	rendering::software_renderer renderer;
+	std::vector<std::uint32_t> pixels(size * size);
+
+	template<typename Record>
+	void render(Record&& record)
+	{
+		renderer.set_target(pixels.data(), size, size, size);
+		renderer.clear({ 0.f, 0.f, 0.f, 1.f });
+		renderer.begin();
+		record();
+		renderer.end();
+	}
+
+	float coverage(std::uint32_t x, std::uint32_t y)
+	{
+		return static_cast<float>(pixels[y * size + x] & 0xffu) / 255.f;
+	}
+
+	// distance from p to the segment's axis and how far past either end it lies
+	std::pair<float, float> segment_distance(rendering::vec2 p, rendering::vec2 a, rendering::vec2 b)
+	{
+		const auto dx = b.x - a.x, dy = b.y - a.y;
+		const auto length = std::sqrt(dx * dx + dy * dy);
+		const auto along = ((p.x - a.x) * dx + (p.y - a.y) * dy) / length;
+		const auto across = std::fabs((p.x - a.x) * dy - (p.y - a.y) * dx) / length;
+		return { across, std::fmax(-along, along - length) };
+	}
+
+	void counts()
+	{
+		const std::vector<rendering::vec2> points = { { 10.f, 10.f }, { 60.f, 10.f }, { 60.f, 10.f }, { 65.f, 80.f }, { 10.f, 15.f }, { 100.f, 100.f } };
+		for (const auto closed : { false, true })
+		{
+			for (const auto join : { stroke::join::miter, stroke::join::bevel })
+			{
+				for (const auto thickness : { .5f, 1.f, 7.f })
+				{
+					const stroke::style style = { thickness, join, stroke::cap::square };
+					const auto total = closed ? points.size() + 1u : points.size();
+					const auto size = stroke::measure(points.data(), points.size(), closed, 0u, total - 1u, style);
+					CHECK(size.vertices <= 9u * total && size.indices <= 27u * total + 18u && size.indices % 3u == 0u);
+
+					// sentinels past the end show the writer stayed within what was measured
+					constexpr std::uint16_t base = 40u;
+					std::vector<rendering::vertex> vertices(size.vertices + 1u, { { -1.f, -1.f }, 0xabababu });
+					std::vector<std::uint16_t> indices(size.indices + 1u, 0xabcdu);
+					stroke::write(vertices.data(), indices.data(), base, points.data(), points.size(), closed, 0u, total - 1u, style, white);
+					CHECK(vertices.back().colour == 0xabababu && indices.back() == 0xabcdu);
+
+					// every index is in range and every vertex finite. a bevel ending the stroke
+					// writes the whole outgoing row and only uses its outside
+					std::vector<bool> used(size.vertices);
+					for (auto i = 0u; i < size.indices; ++i)
+					{
+						CHECK(indices[i] >= base && indices[i] < base + size.vertices);
+						if (indices[i] >= base && indices[i] < base + size.vertices)
+							used[indices[i] - base] = true;
+					}
+					CHECK(std::count(used.begin(), used.end(), false) <= (closed && join == stroke::join::bevel ? 2 : 0));
+					for (auto i = 0u; i < size.vertices; ++i)
+						CHECK(std::isfinite(vertices[i].pos.x) && std::isfinite(vertices[i].pos.y));
+				}
+			}
+		}
+	}
+
+	// a long stroke written in pieces, the way the recorder splits it, gives exactly the
+	// triangles of the stroke written whole
+	void pieces()
+	{
+		std::vector<rendering::vec2> points;
+		for (auto i = 0u; i < 300u; ++i)
+			points.push_back({ static_cast<float>(i) * 3.f, i % 2u ? 0.f : 5.f + static_cast<float>(i % 7u) * 4.f });
+
+		for (const auto join : { stroke::join::miter, stroke::join::bevel })
+		{
+			const stroke::style style = { 4.f, join, stroke::cap::butt };
+			using triangle = std::array<std::tuple<float, float, std::uint32_t>, 3>;
+			auto triangles = [&](std::size_t first, std::size_t last, std::vector<triangle>& result)
+			{
+				const auto size = stroke::measure(points.data(), points.size(), true, first, last, style);
+				std::vector<rendering::vertex> vertices(size.vertices);
+				std::vector<std::uint16_t> indices(size.indices);
+				stroke::write(vertices.data(), indices.data(), 0u, points.data(), points.size(), true, first, last, style, white);
+				for (auto i = 0u; i < indices.size(); i += 3u)
+				{
+					triangle t;
+					for (auto k = 0u; k < 3u; ++k)
+						t[k] = { vertices[indices[i + k]].pos.x, vertices[indices[i + k]].pos.y, vertices[indices[i + k]].colour };
+					result.push_back(t);
+				}
+			};
+
+			std::vector<triangle> whole, split;
+			triangles(0u, points.size(), whole);
+			for (auto first = 0u; first < points.size(); first += 99u)
+				triangles(first, std::min<std::size_t>(first + 99u, points.size()), split);
+
+			std::sort(whole.begin(), whole.end());
+			std::sort(split.begin(), split.end());
+			CHECK(whole == split);
+		}
+	}
+
+	// a straight stroke fades over one pixel centred on its edge, along and across
+	void straight()
+	{
+		for (const auto cap : { stroke::cap::butt, stroke::cap::square })
+		{
+			for (const auto& [a, b] : { std::pair{ rendering::vec2{ 30.f, 100.f }, rendering::vec2{ 170.f, 100.f } }, std::pair{ rendering::vec2{ 40.f, 30.f }, rendering::vec2{ 150.f, 170.f } } })
+			{
+				constexpr auto thickness = 9.f;
+				render([&] { renderer.draw_thick_line(a, b, { thickness, stroke::join::miter, cap }, white); });
+
+				const auto extend = cap == stroke::cap::square ? thickness * .5f : 0.f;
+				auto worst = 0.f;
+				for (auto y = 0u; y < size; ++y)
+				{
+					for (auto x = 0u; x < size; ++x)
+					{
+						const auto [across, past] = segment_distance({ x + .5f, y + .5f }, a, b);
+						const auto side = std::clamp(thickness * .5f + .5f - across, 0.f, 1.f);
+						const auto end = std::clamp(extend + .5f - past, 0.f, 1.f);
+
+						// the corners fade both ways at once, which is not a product of the two
+						if (side > 0.f && side < 1.f && end > 0.f && end < 1.f)
+							continue;
+						worst = std::fmax(worst, std::fabs(coverage(x, y) - side * end));
+					}
+				}
+				CHECK(worst < .02f);
+			}
+		}
+
+		// thinner than the fringe keeps its width and fades instead
+		render([&] { renderer.draw_thick_line({ 20.f, 50.5f }, { 180.f, 50.5f }, { .5f }, white); });
+		CHECK(std::fabs(coverage(100u, 50u) - .5f) < .02f && coverage(100u, 49u) < .02f && coverage(100u, 51u) < .02f);
+	}
+
+	// the outside corner of a right angle is filled by a miter and cut off by a bevel
+	void joins()
+	{
+		const std::array<rendering::vec2, 3> corner = { { { 50.f, 50.f }, { 150.f, 50.f }, { 150.f, 150.f } } };
+		render([&] { renderer.draw_thick_polyline(corner, { 10.f, stroke::join::miter }, white); });
+		CHECK(coverage(154u, 45u) > .98f && coverage(150u, 50u) > .98f);
+		render([&] { renderer.draw_thick_polyline(corner, { 10.f, stroke::join::bevel }, white); });
+		CHECK(coverage(154u, 45u) < .02f && coverage(150u, 50u) > .98f);
+
+		// a sharp turn would put the miter tip far out, past the limit it is bevelled instead
+		// and ends right at the turn
+		const std::array<rendering::vec2, 3> sharp = { { { 20.f, 100.f }, { 150.f, 100.f }, { 20.f, 110.f } } };
+		render([&] { renderer.draw_thick_polyline(sharp, { 10.f, stroke::join::miter }, white); });
+		auto reach = 0u;
+		for (auto y = 90u; y < 120u; ++y)
+			for (auto x = 100u; x < size; ++x)
+				if (coverage(x, y) > .02f)
+					reach = std::max(reach, x);
+		CHECK(reach >= 149u && reach <= 151u);
+
+		// a closed outline has no caps, every corner is joined
+		const std::array<rendering::vec2, 4> square = { { { 40.f, 40.f }, { 160.f, 40.f }, { 160.f, 160.f }, { 40.f, 160.f } } };
+		render([&] { renderer.draw_thick_polygon(square, { 6.f, stroke::join::miter }, white); });
+		CHECK(coverage(37u, 37u) > .98f && coverage(162u, 37u) > .98f && coverage(162u, 162u) > .98f && coverage(37u, 162u) > .98f);
+		CHECK(coverage(100u, 100u) < .02f && coverage(35u, 35u) < .02f);
+	}
+
+	// vertices written per second for a long zigzag, in pieces of a thousand points like the
+	// recorder writes it. the sum keeps the writes from being optimized away
+	void timing()
+	{
+		std::vector<rendering::vec2> points;
+		for (auto i = 0u; i < 100000u; ++i)
+			points.push_back({ static_cast<float>(i % 1000u) * 2.f, static_cast<float>(i / 1000u) * 8.f + (i % 2u ? 0.f : 5.f) });
+
+		std::vector<rendering::vertex> vertices(9u * 1001u);
+		std::vector<std::uint16_t> indices(27u * 1001u + 18u);
+		for (const auto join : { stroke::join::miter, stroke::join::bevel })
+		{
+			const stroke::style style = { 3.f, join, stroke::cap::square };
+			constexpr auto rounds = 10u;
+			std::size_t written = 0u;
+			auto sum = 0.f;
+			const auto start = std::chrono::steady_clock::now();
+			for (auto round = 0u; round < rounds; ++round)
+			{
+				for (std::size_t first = 0u; first + 1u < points.size(); first += 1000u)
+				{
+					const auto last = first + 1000u < points.size() ? first + 1000u : points.size() - 1u;
+					const auto size = stroke::measure(points.data(), points.size(), false, first, last, style);
+					stroke::write(vertices.data(), indices.data(), 0u, points.data(), points.size(), false, first, last, style, white);
+					written += size.vertices;
+					sum += vertices[size.vertices - 1u].pos.x;
+				}
+			}
+			const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			CHECK(std::isfinite(sum));
+			std::printf("%s joins: %.1f million vertices/s\n", join == stroke::join::miter ? "miter" : "bevel", written / elapsed / 1e6);
+		}
+	}
+}
+
+
+int main()
+{
+	counts();
+	pieces();
+	straight();
+	joins();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
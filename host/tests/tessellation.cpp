@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "tessellation.hpp"
+#include "check.hpp"
+
+// the table trig against libm, tessellated circles against the analytic circle, and how many
+// vertices a second each writer produces
+namespace
+{
+	namespace tessellation = rendering::tessellation;
+
+	void trig()
+	{
+		// the float angle loses precision further out, the bound holds within a turn of 0
+		auto worst = 0.0;
+		for (auto i = -200000; i <= 200000; ++i)
+		{
+			const auto angle = static_cast<float>(i) * (2.f * rendering::pi<float> / 200000.f);
+			worst = std::max(worst, std::fabs(static_cast<double>(tessellation::sin(angle)) - std::sin(static_cast<double>(angle))));
+			worst = std::max(worst, std::fabs(static_cast<double>(tessellation::cos(angle)) - std::cos(static_cast<double>(angle))));
+		}
+		std::printf("table sin/cos error %.2e\n", worst);
+		CHECK(worst < 5e-6);
+	}
+
+	// furthest any point of the outline gets from the true circle, checking both the vertices
+	// and the middle of every edge, where a chord sags the most
+	double circle_error(const std::vector<rendering::vertex>& vertices, rendering::vec2 centre, float radius)
+	{
+		auto worst = 0.0;
+		for (auto i = 0u; i < vertices.size(); ++i)
+		{
+			const auto& a = vertices[i].pos;
+			const auto& b = vertices[(i + 1u) % vertices.size()].pos;
+			for (const auto t : { 0.0, 0.5 })
+			{
+				const auto x = a.x + (b.x - a.x) * t - centre.x;
+				const auto y = a.y + (b.y - a.y) * t - centre.y;
+				worst = std::max(worst, std::fabs(std::sqrt(x * x + y * y) - radius));
+			}
+		}
+		return worst;
+	}
+
+	void segment_counts()
+	{
+		const rendering::colour white = { 1.f, 1.f, 1.f, 1.f };
+		const rendering::vec2 centre = { 3000.f, 3000.f };
+
+		for (const auto max_error : { .1f, .25f, 1.f })
+		{
+			auto previous = std::size_t{ };
+			auto violations = 0u;
+			for (auto radius = .5f; radius < 4000.f; radius *= 1.1f)
+			{
+				const auto segments = tessellation::segments(radius, max_error);
+				CHECK(segments >= tessellation::min_segments && segments <= tessellation::max_segments);
+				// a larger circle never gets fewer segments
+				CHECK(segments >= previous);
+				previous = segments;
+
+				std::vector<rendering::vertex> vertices(segments);
+				std::vector<std::uint16_t> indices(segments * 2u);
+				tessellation::ellipse(vertices.data(), indices.data(), 0u, centre, { radius, radius }, segments, white);
+
+				// past max_segments the bound is given up for the vertex budget
+				if (segments < tessellation::max_segments)
+					violations += circle_error(vertices, centre, radius) > max_error;
+			}
+			CHECK(violations == 0u);
+		}
+	}
+
+	void writers()
+	{
+		const rendering::colour white = { 1.f, 1.f, 1.f, 1.f };
+		constexpr std::uint16_t base = 100u;
+		constexpr auto segments = 16u;
+
+		// a closed outline, every vertex starts one edge and ends the one before it
+		{
+			std::vector<rendering::vertex> vertices(segments);
+			std::vector<std::uint16_t> indices(segments * 2u);
+			tessellation::ellipse(vertices.data(), indices.data(), base, { 0.f, 0.f }, { 10.f, 5.f }, segments, white);
+			for (auto i = 0u; i < segments; ++i)
+			{
+				CHECK(indices[i * 2u] == base + i);
+				CHECK(indices[i * 2u + 1u] == base + (i + 1u) % segments);
+			}
+			const auto extreme = std::max_element(vertices.begin(), vertices.end(), [](const auto& a, const auto& b) { return a.pos.x < b.pos.x; });
+			CHECK(std::fabs(extreme->pos.x - 10.f) < 1e-4f);
+		}
+
+		// a fan around the centre, every triangle uses it
+		{
+			std::vector<rendering::vertex> vertices(segments + 1u);
+			std::vector<std::uint16_t> indices(segments * 3u);
+			tessellation::filled_ellipse(vertices.data(), indices.data(), base, { 5.f, 5.f }, { 4.f, 4.f }, segments, white);
+			auto fanned = 0u;
+			for (auto i = 0u; i < segments; ++i)
+			{
+				const auto* triangle = &indices[i * 3u];
+				fanned += std::count_if(triangle, triangle + 3, [&](std::uint16_t index) { return vertices[index - base].pos.x == 5.f && vertices[index - base].pos.y == 5.f; }) == 1;
+				for (auto j = 0u; j < 3u; ++j)
+					CHECK(triangle[j] >= base && triangle[j] < base + segments + 1u);
+			}
+			CHECK(fanned == segments);
+		}
+
+		// an open arc ends exactly at its end angle
+		{
+			std::vector<rendering::vertex> vertices(segments + 1u);
+			std::vector<std::uint16_t> indices(segments * 2u);
+			tessellation::arc(vertices.data(), indices.data(), base, { 0.f, 0.f }, 10.f, 0.f, rendering::pi<float> / 2.f, segments, white);
+			CHECK(std::fabs(vertices.front().pos.x - 10.f) < 1e-4f && std::fabs(vertices.front().pos.y) < 1e-4f);
+			CHECK(std::fabs(vertices.back().pos.x) < 1e-4f && std::fabs(vertices.back().pos.y - 10.f) < 1e-4f);
+			CHECK(indices.back() == base + segments);
+		}
+
+		// a convex polygon keeps its points and fans from the first
+		{
+			const rendering::vec2 points[5] = { { 0.f, 0.f }, { 4.f, 0.f }, { 5.f, 3.f }, { 2.f, 5.f }, { -1.f, 3.f } };
+			std::vector<rendering::vertex> vertices(5u);
+			std::vector<std::uint16_t> indices(3u * 3u);
+			tessellation::filled_polygon(vertices.data(), indices.data(), base, points, 5u, white);
+			for (auto i = 0u; i < 5u; ++i)
+				CHECK(vertices[i].pos.x == points[i].x && vertices[i].pos.y == points[i].y);
+			for (auto i = 0u; i < 3u; ++i)
+				CHECK(indices[i * 3u] == base && indices[i * 3u + 1u] == base + i + 1u && indices[i * 3u + 2u] == base + i + 2u);
+
+			std::vector<std::uint16_t> outline(5u * 2u);
+			tessellation::polygon(vertices.data(), outline.data(), base, points, 5u, white);
+			CHECK(outline.back() == base);
+		}
+	}
+
+	// the old draw_circle, a fixed 256 segments from libm
+	void libm_circle(rendering::vertex* vertices, std::uint16_t* indices, std::uint16_t base, rendering::vec2 pos, float radius, rendering::colour colour)
+	{
+		constexpr auto segments = 256u;
+		const auto c = rendering::vertex_colour(colour);
+		for (auto i = 0u; i < segments; ++i)
+		{
+			const auto angle = 2.f * rendering::pi<float> * static_cast<float>(i) / segments;
+			vertices[i] = { { pos.x + radius * std::cos(angle), pos.y + radius * std::sin(angle) }, c };
+			indices[i * 2u] = static_cast<std::uint16_t>(base + i);
+			indices[i * 2u + 1u] = static_cast<std::uint16_t>(base + (i + 1u) % segments);
+		}
+	}
+
+	// writes circles of random radii until a total of vertices, into buffers reused every
+	// shape so the timing is the writer and not the cache. returns vertices per second
+	template<typename Write>
+	double rate(const char* name, std::size_t total, Write&& write)
+	{
+		std::vector<rendering::vertex> vertices(tessellation::max_segments + 1u);
+		std::vector<std::uint16_t> indices(tessellation::max_segments * 3u);
+		auto written = std::size_t{ }, shapes = std::size_t{ };
+		auto sum = 0.f;
+		const auto start = std::chrono::steady_clock::now();
+		while (written < total)
+		{
+			const auto radius = 2.f + static_cast<float>(shapes * 7919u % 400u);
+			written += write(vertices.data(), indices.data(), radius);
+			sum += vertices[1].pos.x;
+			++shapes;
+		}
+		const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		CHECK(sum != 0.f);
+		std::printf("%-20s %6.1f M vertices/s, %5.1f vertices a shape\n", name, written / seconds / 1e6, static_cast<double>(written) / shapes);
+		return written / seconds;
+	}
+
+	void timing()
+	{
+		const rendering::colour white = { 1.f, 1.f, 1.f, 1.f };
+		const rendering::vec2 centre = { 640.f, 360.f };
+		constexpr auto total = std::size_t{ 20000000u };
+
+		rate("circle", total, [&](auto* vertices, auto* indices, float radius)
+		{
+			const auto segments = tessellation::segments(radius, .25f);
+			tessellation::ellipse(vertices, indices, 0u, centre, { radius, radius }, segments, white);
+			return segments;
+		});
+		rate("filled circle", total, [&](auto* vertices, auto* indices, float radius)
+		{
+			const auto segments = tessellation::segments(radius, .25f);
+			tessellation::filled_ellipse(vertices, indices, 0u, centre, { radius, radius }, segments, white);
+			return segments + 1u;
+		});
+		rate("quarter arc", total, [&](auto* vertices, auto* indices, float radius)
+		{
+			const auto segments = std::max(tessellation::segments(radius, .25f) / 4u, std::size_t{ 2u });
+			tessellation::arc(vertices, indices, 0u, centre, radius, 0.f, rendering::pi<float> / 2.f, segments, white);
+			return segments + 1u;
+		});
+		const auto libm = rate("libm 256 segments", total, [&](auto* vertices, auto* indices, float radius)
+		{
+			libm_circle(vertices, indices, 0u, centre, radius, white);
+			return std::size_t{ 256u };
+		});
+
+		// the same 256 segments from the tables, what they save per vertex apart from writing
+		// fewer of them
+		const auto table = rate("table 256 segments", total, [&](auto* vertices, auto* indices, float radius)
+		{
+			tessellation::ellipse(vertices, indices, 0u, centre, { radius, radius }, 256u, white);
+			return std::size_t{ 256u };
+		});
+		std::printf("tables %.2fx libm per vertex\n", table / libm);
+	}
+}
+
+int main()
+{
+	trig();
+	segment_counts();
+	writers();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+#include "device.hpp"
+#include "renderer.hpp"
+#include "text.hpp"
+#include "check.hpp"
+
+// text layout against the font metrics, its cache, and the quads draw_text sends to the
+// recording device
+namespace
+{
+	rendering::text_layout layout;
+
+	std::uint64_t hash(const std::string& text)
+	{
+		std::uint64_t value = 0xcbf29ce484222325ull;
+		for (const auto character : text.substr(0u, rendering::text_layout::max_length))
+			value = (value ^ static_cast<std::uint8_t>(character)) * 0x100000001b3ull;
+		return value;
+	}
+
+	void placement()
+	{
+		std::size_t count;
+		rendering::vec2 size;
+
+		// every glyph starts at the rounded pen plus its bearing, spaces only move the pen
+		const auto* glyphs = layout.layout("Hi, world", count, size);
+		CHECK(count == 8u);
+		auto pen = 0.f, expected_width = 0.f;
+		auto placed = 0u;
+		for (const auto character : std::string("Hi, world"))
+		{
+			const auto& glyph = rendering::font::glyphs[character - rendering::font::first_char];
+			if (glyph.width)
+			{
+				CHECK(glyphs[placed].index == character - rendering::font::first_char);
+				CHECK(glyphs[placed].x == static_cast<std::int32_t>(pen + .5f) + glyph.bearing_x);
+				CHECK(glyphs[placed].y == static_cast<std::int32_t>(rendering::font::ascent + .5f) + glyph.bearing_y);
+				++placed;
+			}
+			pen += glyph.advance;
+			expected_width = std::fmax(expected_width, pen);
+		}
+		CHECK(size.x == expected_width && size.y == rendering::font::line_height);
+
+		// a newline starts the pen over one line down, the widest line sets the width
+		const auto wide = layout.measure("abcdef");
+		const auto two_lines = layout.measure("abc\nabcdef");
+		CHECK(two_lines.x == wide.x && two_lines.y == 2.f * rendering::font::line_height);
+		glyphs = layout.layout("a\nb", count, size);
+		CHECK(count == 2u && glyphs[1].y - glyphs[0].y > 0 && glyphs[1].x <= glyphs[0].x + 1);
+
+		// characters outside the font are drawn as a question mark
+		glyphs = layout.layout("\x01\x7f", count, size);
+		CHECK(count == 2u && glyphs[0].index == '?' - rendering::font::first_char && glyphs[1].index == glyphs[0].index);
+
+		// past max_length the rest is cut off
+		const std::string long_text(rendering::text_layout::max_length + 20u, 'x');
+		layout.layout(long_text.c_str(), count, size);
+		CHECK(count == rendering::text_layout::max_length);
+		CHECK(layout.measure(long_text.c_str()).x == layout.measure(long_text.substr(0u, rendering::text_layout::max_length).c_str()).x);
+
+		CHECK(layout.measure("").x == 0.f);
+	}
+
+	void cache()
+	{
+		constexpr auto ways = 4u;
+		constexpr auto sets = rendering::text_layout::cache_size / ways;
+
+		// strings that land in the same set, one more than it holds
+		std::vector<std::string> same_set;
+		for (auto i = 0u; same_set.size() < ways + 1u; ++i)
+		{
+			const auto text = "label " + std::to_string(i);
+			if (hash(text) % sets == 0u)
+				same_set.push_back(text);
+		}
+
+		std::size_t count;
+		rendering::vec2 size;
+		auto stats = layout.stats();
+		for (auto i = 0u; i < ways; ++i)
+			layout.layout(same_set[i].c_str(), count, size);
+		CHECK(layout.stats().misses - stats.misses == ways);
+
+		// all of them are kept, the first is then the most recently used
+		for (auto i = 0u; i < ways; ++i)
+			layout.layout(same_set[i].c_str(), count, size);
+		layout.layout(same_set[0].c_str(), count, size);
+		CHECK(layout.stats().hits - stats.hits == ways + 1u);
+
+		// one more evicts the least recently used, which is the second
+		stats = layout.stats();
+		layout.layout(same_set[ways].c_str(), count, size);
+		layout.layout(same_set[0].c_str(), count, size);
+		CHECK(layout.stats().misses - stats.misses == 1u && layout.stats().hits - stats.hits == 1u);
+		layout.layout(same_set[1].c_str(), count, size);
+		CHECK(layout.stats().misses - stats.misses == 2u);
+
+		// a hit gives the same glyphs a fresh layout would
+		const auto* cached = layout.layout(same_set[1].c_str(), count, size);
+		const std::vector<rendering::text_layout::placed_glyph> copy(cached, cached + count);
+		rendering::text_layout fresh{ };
+		std::size_t fresh_count;
+		const auto* laid_out = fresh.layout(same_set[1].c_str(), fresh_count, size);
+		CHECK(fresh_count == count && std::memcmp(laid_out, copy.data(), count * sizeof(copy[0])) == 0);
+	}
+
+	void drawing()
+	{
+		host::device::options options;
+		options.capture = true;
+		host::device device(options);
+		host::swapchain swapchain(device);
+
+		// the renderer allocates itself from memory::alloc and has no operator delete
+		std::optional<rendering::renderer> renderer;
+		renderer.emplace(&swapchain);
+
+		// a frame's text goes out in one draw, as glyph quads
+		device.draws().clear();
+		renderer->begin();
+		renderer->draw_text({ 10.4f, 20.6f }, "Hello", { 1.f, 0.f, 0.f, 1.f });
+		renderer->draw_text({ 100.f, 200.f }, "world!", { 0.f, 1.f, 0.f, 1.f });
+		renderer->end();
+
+		const auto& draws = device.draws();
+		CHECK(draws.size() == 1u);
+		if (!draws.empty())
+		{
+			const auto& draw = draws.back();
+			CHECK(draw.stride == sizeof(rendering::textured_vertex) && draw.count() == 11u * 6u);
+
+			// the first quad is the H, snapped with the origin rounded to whole pixels
+			std::size_t count;
+			rendering::vec2 size;
+			const auto placed = layout.layout("Hello", count, size)[0];
+			const auto& glyph = rendering::font::glyphs['H' - rendering::font::first_char];
+			rendering::textured_vertex quad[6];
+			std::memcpy(quad, draw.data.data(), sizeof(quad));
+			auto min_x = quad[0].pos.x, max_x = min_x, min_y = quad[0].pos.y, max_y = min_y;
+			for (const auto& vertex : quad)
+			{
+				min_x = std::fmin(min_x, vertex.pos.x), max_x = std::fmax(max_x, vertex.pos.x);
+				min_y = std::fmin(min_y, vertex.pos.y), max_y = std::fmax(max_y, vertex.pos.y);
+				CHECK(vertex.colour == 0xff0000ffu);
+				CHECK(vertex.pos.x == std::floor(vertex.pos.x) && vertex.pos.y == std::floor(vertex.pos.y));
+
+				// uvs stay within the glyph's rect of the atlas
+				const auto u = (vertex.uv & 0xffffu) * static_cast<double>(rendering::font::atlas_width) / 0xffff;
+				const auto v = (vertex.uv >> 16) * static_cast<double>(rendering::font::atlas_height) / 0xffff;
+				CHECK(u > glyph.x - .01 && u < glyph.x + glyph.width + .01);
+				CHECK(v > glyph.y - .01 && v < glyph.y + glyph.height + .01);
+			}
+			CHECK(min_x == 10.f + placed.x && max_x - min_x == glyph.width);
+			CHECK(min_y == 21.f + placed.y && max_y - min_y == glyph.height);
+		}
+		CHECK(renderer->stats().glyphs == 11u);
+
+		// past max_glyphs the frame's text takes another draw, and the box recorded before it
+		// is drawn first so the text still covers it
+		device.draws().clear();
+		renderer->begin();
+		renderer->draw_filled_box({ 0.f, 0.f }, { 100.f, 100.f }, { 0.f, 0.f, 1.f, 1.f });
+		const std::string line(rendering::text_layout::max_length, 'w');
+		const auto lines = rendering::max_glyphs / line.size() + 1u;
+		for (auto i = 0u; i < lines; ++i)
+			renderer->draw_text({ 0.f, static_cast<float>(i) }, line.c_str(), { 1.f, 1.f, 1.f, 1.f });
+		CHECK(renderer->stats().overflow_flushes == 1u);
+		renderer->end();
+		CHECK(device.draws().size() == 3u);
+		auto total = std::size_t{ };
+		for (auto i = 1u; i < device.draws().size(); ++i)
+			total += device.draws()[i].count();
+		CHECK(device.draws()[0].stride == sizeof(rendering::vertex) && device.draws()[0].count() == 6u);
+		CHECK(total == lines * line.size() * 6u && renderer->stats().dropped == 0u);
+
+		// text entirely outside the viewport is not drawn
+		device.draws().clear();
+		renderer->begin();
+		renderer->draw_text({ -500.f, -500.f }, "gone", { 1.f, 1.f, 1.f, 1.f });
+		renderer->end();
+		CHECK(device.draws().empty());
+		CHECK(device.stats().errors == 0u);
+	}
+
+	void timing()
+	{
+		constexpr auto rounds = 200000u;
+		std::vector<std::string> labels;
+		for (auto i = 0u; i < 64u; ++i)
+			labels.push_back("frame time " + std::to_string(i * 37u) + " ms");
+
+		std::size_t count;
+		rendering::vec2 size;
+		for (const auto distinct : { std::size_t{ 1u }, labels.size() })
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (auto i = 0u; i < rounds; ++i)
+				layout.layout(labels[i % distinct].c_str(), count, size);
+			const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+			std::printf("layout of %zu rotating labels: %.1f ns\n", distinct, elapsed / rounds);
+		}
+	}
+}
+
+int main()
+{
+	placement();
+	cache();
+	drawing();
+	timing();
+	return host::failures;
+}
\ No newline at end of file
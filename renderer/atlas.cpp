@@ -0,0 +1,285 @@
+#include "atlas.hpp"
+
+namespace rendering
+{
+	void skyline::reset(std::uint16_t width, std::uint16_t height)
+	{
+		_width = width;
+		_height = height;
+		_nodes[0] = { 0u, 0u, width };
+		_count = 1u;
+		_used_area = 0u;
+	}
+
+	bool skyline::fit(std::size_t index, std::uint16_t width, std::uint16_t height, std::uint16_t& y) const
+	{
+		if (_nodes[index].x + width > _width)
+			return false;
+
+		// rests on the highest step it spans
+		y = 0u;
+		for (std::size_t remaining = width; remaining > 0; ++index)
+		{
+			const auto& node = _nodes[index];
+			if (node.y > y)
+				y = node.y;
+			if (y + height > _height)
+				return false;
+			remaining -= remaining < node.width ? remaining : node.width;
+		}
+		return true;
+	}
+
+	bool skyline::insert(std::uint16_t width, std::uint16_t height, std::uint16_t& x, std::uint16_t& y)
+	{
+		// a new step can split one, merging only happens afterwards
+		if (width == 0u || height == 0u || _count == max_nodes)
+			return false;
+
+		// lowest top edge, then the narrowest step so wide ones stay free for wide rectangles
+		auto best = max_nodes;
+		std::uint32_t best_top = 0xffffffffu;
+		std::uint32_t best_width = 0xffffffffu;
+		for (auto i = 0u; i < _count; ++i)
+		{
+			std::uint16_t top;
+			if (!fit(i, width, height, top))
+				continue;
+
+			top += height;
+			if (top < best_top || (top == best_top && _nodes[i].width < best_width))
+			{
+				best = i;
+				best_top = top;
+				best_width = _nodes[i].width;
+			}
+		}
+
+		if (best == max_nodes)
+			return false;
+
+		x = _nodes[best].x;
+		y = static_cast<std::uint16_t>(best_top - height);
+
+		for (auto i = _count; i > best; --i)
+			_nodes[i] = _nodes[i - 1];
+		_nodes[best] = { x, static_cast<std::uint16_t>(best_top), width };
+		++_count;
+
+		// steps now under the new one shrink from the left or go
+		const auto end = x + width;
+		auto next = best + 1;
+		while (next < _count && _nodes[next].x < end)
+		{
+			auto& node = _nodes[next];
+			const auto covered = end - node.x;
+			if (covered < node.width)
+			{
+				node.x = static_cast<std::uint16_t>(end);
+				node.width = static_cast<std::uint16_t>(node.width - covered);
+				break;
+			}
+
+			for (auto i = next; i + 1 < _count; ++i)
+				_nodes[i] = _nodes[i + 1];
+			--_count;
+		}
+
+		// neighbours at the same height become one step
+		for (auto i = 0u; i + 1 < _count;)
+		{
+			if (_nodes[i].y != _nodes[i + 1].y)
+			{
+				++i;
+				continue;
+			}
+
+			_nodes[i].width = static_cast<std::uint16_t>(_nodes[i].width + _nodes[i + 1].width);
+			for (auto j = i + 1; j + 1 < _count; ++j)
+				_nodes[j] = _nodes[j + 1];
+			--_count;
+		}
+
+		_used_area += static_cast<std::size_t>(width) * height;
+		return true;
+	}
+
+	std::size_t skyline::used_area() const
+	{
+		return _used_area;
+	}
+
+	sprite_atlas::sprite_atlas()
+		: _pages()
+		, _table()
+		, _free_count(max_atlas_images)
+		, _clock(1u)
+		, _cleared()
+		, _stats()
+	{
+		// popped from the back, so entries fill from the front
+		for (auto i = 0u; i < max_atlas_images; ++i)
+		{
+			_entries[i].region.page = no_page;
+			_free[i] = static_cast<std::uint16_t>(max_atlas_images - 1u - i);
+		}
+	}
+
+	std::size_t sprite_atlas::slot(std::uint64_t id) const
+	{
+		// ids are often small handles or addresses, so they are mixed before picking a slot
+		return ((id * 0x9e3779b97f4a7c15ull) >> 32) % table_size;
+	}
+
+	const sprite_atlas::region* sprite_atlas::acquire(const image& image, bool& placed)
+	{
+		placed = false;
+
+		auto index = slot(image.id);
+		for (; _table[index]; index = (index + 1) % table_size)
+		{
+			auto& entry = _entries[_table[index] - 1u];
+			if (entry.id == image.id)
+			{
+				++_stats.hits;
+				_pages[entry.region.page].last_used = _clock;
+				return &entry.region;
+			}
+		}
+
+		// it fits on no page, evicting one would only throw its images away
+		if (image.width == 0u || image.height == 0u || image.width > atlas_size || image.height > atlas_size)
+		{
+			++_stats.failures;
+			return nullptr;
+		}
+
+		region region;
+		auto packed = false;
+		if (_free_count != 0)
+		{
+			for (std::uint16_t page = 0u; page < atlas_pages && !packed; ++page)
+				packed = pack(page, image, region);
+		}
+
+		// every page is full or every entry taken. only pages holding images are worth
+		// clearing, an empty one already failed above
+		if (!packed)
+		{
+			auto victim = no_page;
+			for (std::uint16_t page = 0u; page < atlas_pages; ++page)
+			{
+				const auto& candidate = _pages[page];
+				if (candidate.used && candidate.last_used != _clock && (victim == no_page || candidate.last_used < _pages[victim].last_used))
+					victim = page;
+			}
+
+			if (victim != no_page)
+			{
+				evict(victim);
+				packed = pack(victim, image, region);
+			}
+		}
+
+		if (!packed)
+		{
+			++_stats.failures;
+			return nullptr;
+		}
+
+		const auto entry = _free[--_free_count];
+		_entries[entry] = { image.id, region };
+		index = slot(image.id);
+		while (_table[index])
+			index = (index + 1) % table_size;
+		_table[index] = static_cast<std::uint16_t>(entry + 1u);
+
+		++_stats.insertions;
+		placed = true;
+		return &_entries[entry].region;
+	}
+
+	bool sprite_atlas::pack(std::uint16_t page, const image& image, region& region)
+	{
+		auto& target = _pages[page];
+		if (!target.used)
+		{
+			target.skyline.reset(atlas_size, atlas_size);
+			_cleared |= 1u << page;
+		}
+
+		// a texel of space right and below keeps filtering from bleeding into the neighbours
+		const auto width = static_cast<std::uint16_t>(image.width < atlas_size ? image.width + 1u : image.width);
+		const auto height = static_cast<std::uint16_t>(image.height < atlas_size ? image.height + 1u : image.height);
+		std::uint16_t x, y;
+		if (!target.skyline.insert(width, height, x, y))
+			return false;
+
+		region = { page, x, y, image.width, image.height };
+		target.used = true;
+		target.last_used = _clock;
+		return true;
+	}
+
+	void sprite_atlas::evict(std::uint16_t page)
+	{
+		for (auto i = 0u; i < max_atlas_images; ++i)
+		{
+			if (_entries[i].region.page != page)
+				continue;
+
+			_entries[i].region.page = no_page;
+			_free[_free_count++] = static_cast<std::uint16_t>(i);
+		}
+
+		_pages[page].used = false;
+		++_stats.evictions;
+		rebuild_table();
+	}
+
+	void sprite_atlas::rebuild_table()
+	{
+		_table.fill(0u);
+		for (auto i = 0u; i < max_atlas_images; ++i)
+		{
+			if (_entries[i].region.page == no_page)
+				continue;
+
+			auto index = slot(_entries[i].id);
+			while (_table[index])
+				index = (index + 1) % table_size;
+			_table[index] = static_cast<std::uint16_t>(i + 1u);
+		}
+	}
+
+	void sprite_atlas::advance()
+	{
+		++_clock;
+	}
+
+	std::uint32_t sprite_atlas::take_cleared()
+	{
+		const auto cleared = _cleared;
+		_cleared = 0u;
+		return cleared;
+	}
+
+	float sprite_atlas::occupancy() const
+	{
+		std::size_t used = 0u, total = 0u;
+		for (const auto& page : _pages)
+		{
+			if (!page.used)
+				continue;
+
+			used += page.skyline.used_area();
+			total += static_cast<std::size_t>(atlas_size) * atlas_size;
+		}
+		return total ? static_cast<float>(used) / static_cast<float>(total) : 0.f;
+	}
+
+	const sprite_atlas::statistics& sprite_atlas::stats() const
+	{
+		return _stats;
+	}
+}
\ No newline at end of file
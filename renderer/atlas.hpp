@@ -0,0 +1,124 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "config.hpp"
+
+namespace rendering
+{
+	// packs rectangles into a fixed page bottom-left first. it only tracks the top edge of
+	// what was placed, the skyline, so space under an overhang is lost but every insert is
+	// linear in the number of steps in that edge
+	class skyline
+	{
+	public:
+		static constexpr std::size_t max_nodes = 128;
+
+		void reset(std::uint16_t width, std::uint16_t height);
+		// false if the rectangle fits nowhere, or the skyline would need more than max_nodes steps
+		bool insert(std::uint16_t width, std::uint16_t height, std::uint16_t& x, std::uint16_t& y);
+		// total area of the rectangles inserted since reset()
+		std::size_t used_area() const;
+	private:
+		struct node
+		{
+			std::uint16_t x;
+			std::uint16_t y;
+			std::uint16_t width;
+		};
+
+		// top of a width wide rectangle resting on the skyline from node index onwards, or
+		// false if it would leave the page
+		bool fit(std::size_t index, std::uint16_t width, std::uint16_t height, std::uint16_t& y) const;
+
+		std::uint16_t _width;
+		std::uint16_t _height;
+		std::array<node, max_nodes> _nodes;
+		std::size_t _count;
+		std::size_t _used_area;
+	};
+
+	// rgba8 pixels, rows tightly packed. id names the image in the atlas, the pixels are
+	// read whenever it is packed, again after its page was evicted, so they must outlive it
+	struct image
+	{
+		std::uint64_t id;
+		const std::uint32_t* pixels;
+		std::uint16_t width;
+		std::uint16_t height;
+	};
+
+	// keeps images packed across atlas_pages pages of atlas_size texels. when none of them
+	// has room the least recently used page is cleared as a whole and its images are packed
+	// again when next drawn. pages used since the last advance() are never cleared, so the
+	// texels of what is still waiting to be drawn stay put
+	class sprite_atlas
+	{
+	public:
+		struct region
+		{
+			std::uint16_t page;
+			std::uint16_t x;
+			std::uint16_t y;
+			std::uint16_t width;
+			std::uint16_t height;
+		};
+
+		struct statistics
+		{
+			std::size_t hits;
+			std::size_t insertions;
+			std::size_t evictions;
+			// images empty or larger than a page, or no page free to evict
+			std::size_t failures;
+		};
+
+		sprite_atlas();
+
+		// where the image lives, packing it first if needed. placed is set when its pixels
+		// have to be uploaded to the region. nullptr if it could not be packed
+		const region* acquire(const image& image, bool& placed);
+		// what was drawn from the pages so far has been submitted, they may be evicted again
+		void advance();
+		// a bit per page packed from empty since the last call. its texture still holds the
+		// images it was evicted with, which would bleed into the new ones under filtering
+		std::uint32_t take_cleared();
+
+		// share of the used pages' area covered by images and their padding
+		float occupancy() const;
+		const statistics& stats() const;
+	private:
+		static constexpr std::uint16_t no_page = 0xffffu;
+		static constexpr std::size_t table_size = max_atlas_images * 2;
+		static_assert(atlas_pages <= 32);
+
+		struct entry
+		{
+			std::uint64_t id;
+			sprite_atlas::region region;
+		};
+
+		struct page
+		{
+			rendering::skyline skyline;
+			std::uint32_t last_used;
+			bool used;
+		};
+
+		std::size_t slot(std::uint64_t id) const;
+		bool pack(std::uint16_t page, const image& image, region& region);
+		void evict(std::uint16_t page);
+		// after entries were removed, open addressing cannot just clear their slots
+		void rebuild_table();
+
+		std::array<page, atlas_pages> _pages;
+		std::array<entry, max_atlas_images> _entries;
+		// entry index + 1 per slot, 0 is empty
+		std::array<std::uint16_t, table_size> _table;
+		std::array<std::uint16_t, max_atlas_images> _free;
+		std::size_t _free_count;
+		std::uint32_t _clock;
+		std::uint32_t _cleared;
+		statistics _stats;
+	};
+}
\ No newline at end of file
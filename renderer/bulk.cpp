@@ -0,0 +1,334 @@
+#include <emmintrin.h>
+#include "bulk.hpp"
+
+namespace rendering
+{
+	namespace bulk
+	{
+		namespace
+		{
+			// each source loads a primitive as (x0, y0, x1, y1) or (x, y, width, height)
+			__m128 load(const box* boxes, std::size_t i)
+			{
+				return _mm_loadu_ps(&boxes[i].pos.x);
+			}
+
+			__m128 load(const box_columns& boxes, std::size_t i)
+			{
+				return _mm_setr_ps(boxes.x[i], boxes.y[i], boxes.width[i], boxes.height[i]);
+			}
+
+			__m128 load(const point_lines& lines, std::size_t i)
+			{
+				return _mm_loadu_ps(&lines.points[i * lines.stride].x);
+			}
+
+			__m128 load(const line_columns& lines, std::size_t i)
+			{
+				return _mm_setr_ps(lines.start_x[i], lines.start_y[i], lines.end_x[i], lines.end_y[i]);
+			}
+
+			// (x, y, x, y) of the clip rect's corners
+			__m128 clip_min(const clipping::rect& clip)
+			{
+				return _mm_setr_ps(clip.min.x, clip.min.y, clip.min.x, clip.min.y);
+			}
+
+			__m128 clip_max(const clipping::rect& clip)
+			{
+				return _mm_setr_ps(clip.max.x, clip.max.y, clip.max.x, clip.max.y);
+			}
+
+			// (min x, min y, max x, max y) of the box cut to the clip rect, empty if min is not below max
+			__m128 cut_box(__m128 box, __m128 min, __m128 max)
+			{
+				const auto start = _mm_movelh_ps(box, box);
+				const auto end = _mm_add_ps(start, _mm_movelh_ps(_mm_movehl_ps(box, box), _mm_movehl_ps(box, box)));
+				const auto low = _mm_min_ps(start, end);
+				const auto high = _mm_max_ps(start, end);
+				return _mm_min_ps(_mm_max_ps(_mm_movelh_ps(low, _mm_movehl_ps(high, high)), min), max);
+			}
+
+			bool has_area(__m128 box)
+			{
+				// min x < max x and min y < max y
+				return (_mm_movemask_ps(_mm_cmplt_ps(box, _mm_movehl_ps(box, box))) & 3) == 3;
+			}
+
+			enum class line_state
+			{
+				inside,
+				outside,
+				partial
+			};
+
+			// the cheap cases in sse, everything else goes to cohen-sutherland
+			line_state classify(__m128 line, __m128 min, __m128 max)
+			{
+				const auto below = _mm_movemask_ps(_mm_cmplt_ps(line, min));
+				const auto above = _mm_movemask_ps(_mm_cmpgt_ps(line, max));
+				if (!(below | above))
+					return line_state::inside;
+
+				// both ends past the same edge
+				if ((below & (below >> 2) & 3) || (above & (above >> 2) & 3))
+					return line_state::outside;
+
+				return line_state::partial;
+			}
+
+			bool clip_line(__m128& line, const clipping::rect& clip, __m128 min, __m128 max)
+			{
+				switch (classify(line, min, max))
+				{
+				case line_state::inside:
+					return true;
+				case line_state::outside:
+					return false;
+				default:
+					break;
+				}
+
+				alignas(16) float values[4];
+				_mm_store_ps(values, line);
+				vec2 start = { values[0], values[1] };
+				vec2 end = { values[2], values[3] };
+				if (!clipping::line(start, end, clip))
+					return false;
+
+				line = _mm_setr_ps(start.x, start.y, end.x, end.y);
+				return true;
+			}
+
+			__m128 colour_lanes(colour colour)
+			{
+				return _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(pack(colour))));
+			}
+
+			// two packed vertices, (x0, y0, c) and (x1, y1, c), from (x0, y0, x1, y1)
+			void store_pair(vertex* vertices, __m128 points, __m128 c)
+			{
+				const auto tail = _mm_shuffle_ps(points, c, _MM_SHUFFLE(0, 0, 3, 2));
+				_mm_storeu_ps(&vertices[0].pos.x, _mm_shuffle_ps(points, tail, _MM_SHUFFLE(0, 2, 1, 0)));
+				_mm_storel_pi(reinterpret_cast<__m64*>(&vertices[1].pos.y), _mm_shuffle_ps(tail, tail, _MM_SHUFFLE(2, 2, 2, 1)));
+			}
+
+			void store_box(vertex* vertices, __m128 box, __m128 c)
+			{
+				// (min x, min y, max x, max y) to the four corners in draw_filled_box order,
+				// 48 bytes written as three stores
+				const auto tail = _mm_shuffle_ps(box, c, _MM_SHUFFLE(0, 0, 3, 2));
+				const auto low = _mm_unpacklo_ps(box, c);
+				const auto high = _mm_unpackhi_ps(c, box);
+				auto out = &vertices[0].pos.x;
+				_mm_storeu_ps(out, _mm_shuffle_ps(box, tail, _MM_SHUFFLE(0, 2, 1, 0)));
+				_mm_storeu_ps(out + 4, _mm_shuffle_ps(low, box, _MM_SHUFFLE(3, 0, 1, 2)));
+				_mm_storeu_ps(out + 8, _mm_shuffle_ps(high, tail, _MM_SHUFFLE(2, 1, 1, 0)));
+			}
+
+			template<typename Boxes>
+			std::size_t count_boxes(const Boxes& boxes, std::size_t first, std::size_t count, const clipping::rect& clip)
+			{
+				const auto min = clip_min(clip);
+				const auto max = clip_max(clip);
+
+				std::size_t visible = 0;
+				for (auto i = first; i < first + count; ++i)
+					visible += has_area(cut_box(load(boxes, i), min, max));
+				return visible;
+			}
+
+			template<typename Lines>
+			std::size_t count_lines(const Lines& lines, std::size_t first, std::size_t count, const clipping::rect& clip)
+			{
+				const auto min = clip_min(clip);
+				const auto max = clip_max(clip);
+
+				std::size_t visible = 0;
+				for (auto i = first; i < first + count; ++i)
+				{
+					auto line = load(lines, i);
+					visible += clip_line(line, clip, min, max);
+				}
+				return visible;
+			}
+
+			// base + offset + step * i, eight at a time
+			void sequence(std::uint16_t* indices, std::size_t count, __m128i pattern, std::uint16_t step)
+			{
+				const auto increment = _mm_set1_epi16(static_cast<short>(step));
+				auto i = 0ull;
+				for (; i + 8 <= count; i += 8)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(indices + i), pattern);
+					pattern = _mm_add_epi16(pattern, increment);
+				}
+
+				alignas(16) std::uint16_t rest[8];
+				_mm_store_si128(reinterpret_cast<__m128i*>(rest), pattern);
+				for (auto j = 0u; i < count; ++i, ++j)
+					indices[i] = rest[j];
+			}
+
+			void box_indices(std::uint16_t* indices, std::uint16_t base, std::size_t count)
+			{
+				// 0, 1, 2, 2, 1, 3 for every box, 24 indices cover four boxes
+				const auto b = _mm_set1_epi16(static_cast<short>(base));
+				const auto step = _mm_set1_epi16(16);
+				auto first = _mm_add_epi16(b, _mm_setr_epi16(0, 1, 2, 2, 1, 3, 4, 5));
+				auto second = _mm_add_epi16(b, _mm_setr_epi16(6, 6, 5, 7, 8, 9, 10, 10));
+				auto third = _mm_add_epi16(b, _mm_setr_epi16(9, 11, 12, 13, 14, 14, 13, 15));
+
+				auto i = 0ull;
+				for (; i + 4 <= count; i += 4)
+				{
+					const auto out = reinterpret_cast<__m128i*>(indices + i * 6);
+					_mm_storeu_si128(out, first);
+					_mm_storeu_si128(out + 1, second);
+					_mm_storeu_si128(out + 2, third);
+					first = _mm_add_epi16(first, step);
+					second = _mm_add_epi16(second, step);
+					third = _mm_add_epi16(third, step);
+				}
+
+				constexpr std::uint16_t quad[6] = { 0, 1, 2, 2, 1, 3 };
+				for (; i < count; ++i)
+					for (auto j = 0u; j < 6; ++j)
+						indices[i * 6 + j] = static_cast<std::uint16_t>(base + i * 4 + quad[j]);
+			}
+
+			template<typename Boxes>
+			void write_boxes(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const Boxes& boxes, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour)
+			{
+				const auto min = clip_min(clip);
+				const auto max = clip_max(clip);
+				const auto c = colour_lanes(colour);
+				const auto value = vertex_colour(colour);
+
+				auto written = 0ull;
+				for (auto i = first; i < first + count; ++i)
+				{
+					const auto box = cut_box(load(boxes, i), min, max);
+					if (!has_area(box))
+						continue;
+
+					if constexpr (use_packed_vertices)
+					{
+						store_box(vertices + written * 4, box, c);
+					}
+					else
+					{
+						alignas(16) float corner[4];
+						_mm_store_ps(corner, box);
+						vertices[written * 4 + 0] = { { corner[0], corner[1] }, value };
+						vertices[written * 4 + 1] = { { corner[2], corner[1] }, value };
+						vertices[written * 4 + 2] = { { corner[0], corner[3] }, value };
+						vertices[written * 4 + 3] = { { corner[2], corner[3] }, value };
+					}
+					++written;
+				}
+
+				box_indices(indices, base, written);
+			}
+
+			template<typename Lines>
+			void write_lines(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const Lines& lines, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour)
+			{
+				const auto min = clip_min(clip);
+				const auto max = clip_max(clip);
+				const auto c = colour_lanes(colour);
+				const auto value = vertex_colour(colour);
+
+				auto written = 0ull;
+				for (auto i = first; i < first + count; ++i)
+				{
+					auto line = load(lines, i);
+					if (!clip_line(line, clip, min, max))
+						continue;
+
+					if constexpr (use_packed_vertices)
+					{
+						store_pair(vertices + written * 2, line, c);
+					}
+					else
+					{
+						alignas(16) float point[4];
+						_mm_store_ps(point, line);
+						vertices[written * 2] = { { point[0], point[1] }, value };
+						vertices[written * 2 + 1] = { { point[2], point[3] }, value };
+					}
+					++written;
+				}
+
+				const auto b = static_cast<short>(base);
+				sequence(indices, written * 2, _mm_add_epi16(_mm_set1_epi16(b), _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7)), 8);
+			}
+		}
+
+		std::size_t visible(const box* boxes, std::size_t first, std::size_t count, const clipping::rect& clip)
+		{
+			return count_boxes(boxes, first, count, clip);
+		}
+
+		std::size_t visible(const box_columns& boxes, std::size_t first, std::size_t count, const clipping::rect& clip)
+		{
+			return count_boxes(boxes, first, count, clip);
+		}
+
+		std::size_t visible(const point_lines& lines, std::size_t first, std::size_t count, const clipping::rect& clip)
+		{
+			return count_lines(lines, first, count, clip);
+		}
+
+		std::size_t visible(const line_columns& lines, std::size_t first, std::size_t count, const clipping::rect& clip)
+		{
+			return count_lines(lines, first, count, clip);
+		}
+
+		void filled_boxes(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const box* boxes, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour)
+		{
+			write_boxes(vertices, indices, base, boxes, first, count, clip, colour);
+		}
+
+		void filled_boxes(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const box_columns& boxes, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour)
+		{
+			write_boxes(vertices, indices, base, boxes, first, count, clip, colour);
+		}
+
+		void lines(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const point_lines& lines, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour)
+		{
+			write_lines(vertices, indices, base, lines, first, count, clip, colour);
+		}
+
+		void lines(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const line_columns& lines, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour)
+		{
+			write_lines(vertices, indices, base, lines, first, count, clip, colour);
+		}
+
+		void polyline(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, colour colour)
+		{
+			const auto c = colour_lanes(colour);
+			const auto value = vertex_colour(colour);
+
+			// two points per store pair, the last odd one on its own
+			auto i = 0ull;
+			for (; i + 2 <= count; i += 2)
+			{
+				if constexpr (use_packed_vertices)
+				{
+					store_pair(vertices + i, _mm_loadu_ps(&points[i].x), c);
+				}
+				else
+				{
+					vertices[i] = { points[i], value };
+					vertices[i + 1] = { points[i + 1], value };
+				}
+			}
+			if (i < count)
+				vertices[i] = { points[i], value };
+
+			const auto b = static_cast<short>(base);
+			sequence(indices, (count - 1) * 2, _mm_add_epi16(_mm_set1_epi16(b), _mm_setr_epi16(0, 1, 1, 2, 2, 3, 3, 4)), 4);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "types.hpp"
+#include "clipping.hpp"
+
+namespace rendering
+{
+	// kernels behind the span drawing functions, expanding many primitives straight into
+	// allocated vertex and index storage with sse. every primitive is checked against the
+	// clip rect, and the writers emit exactly as many primitives as the counters report
+	namespace bulk
+	{
+		struct box
+		{
+			vec2 pos;
+			vec2 dimensions;
+		};
+
+		struct line
+		{
+			vec2 start;
+			vec2 end;
+		};
+
+		// the same boxes as separate arrays
+		struct box_columns
+		{
+			const float* x;
+			const float* y;
+			const float* width;
+			const float* height;
+		};
+
+		// lines whose start is stride points apart, 2 for an array of lines and 1 for the
+		// segments of a polyline
+		struct point_lines
+		{
+			const vec2* points;
+			std::size_t stride;
+		};
+
+		struct line_columns
+		{
+			const float* start_x;
+			const float* start_y;
+			const float* end_x;
+			const float* end_y;
+		};
+
+		// boxes in [first, first + count) that are at least partly inside clip
+		std::size_t visible(const box* boxes, std::size_t first, std::size_t count, const clipping::rect& clip);
+		std::size_t visible(const box_columns& boxes, std::size_t first, std::size_t count, const clipping::rect& clip);
+		std::size_t visible(const point_lines& lines, std::size_t first, std::size_t count, const clipping::rect& clip);
+		std::size_t visible(const line_columns& lines, std::size_t first, std::size_t count, const clipping::rect& clip);
+
+		// 4 vertices and 6 indices per visible box, cut to clip
+		void filled_boxes(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const box* boxes, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour);
+		void filled_boxes(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const box_columns& boxes, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour);
+
+		// line list, 2 vertices and 2 indices per visible line, clipped to clip
+		void lines(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const point_lines& lines, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour);
+		void lines(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const line_columns& lines, std::size_t first, std::size_t count, const clipping::rect& clip, colour colour);
+
+		// open line list sharing vertices between segments, count vertices and 2 * (count - 1)
+		// indices. the points must all be inside the clip rect
+		void polyline(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, colour colour);
+	}
+}
\ No newline at end of file
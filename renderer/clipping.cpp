@@ -0,0 +1,98 @@
+#include "clipping.hpp"
+
+namespace rendering
+{
+	namespace clipping
+	{
+		constexpr std::uint32_t inside = 0u;
+		constexpr std::uint32_t left = 1u << 0;
+		constexpr std::uint32_t right = 1u << 1;
+		constexpr std::uint32_t top = 1u << 2;
+		constexpr std::uint32_t bottom = 1u << 3;
+
+		std::uint32_t outcode(vec2 point, const rect& clip)
+		{
+			auto code = inside;
+			if (point.x < clip.min.x)
+				code |= left;
+			else if (point.x > clip.max.x)
+				code |= right;
+			if (point.y < clip.min.y)
+				code |= top;
+			else if (point.y > clip.max.y)
+				code |= bottom;
+			return code;
+		}
+
+		void extend(rect& rect, vec2 point)
+		{
+			if (point.x < rect.min.x)
+				rect.min.x = point.x;
+			if (point.x > rect.max.x)
+				rect.max.x = point.x;
+			if (point.y < rect.min.y)
+				rect.min.y = point.y;
+			if (point.y > rect.max.y)
+				rect.max.y = point.y;
+		}
+
+		rect bounds(const vec2* points, std::size_t count)
+		{
+			rect result = { points[0], points[0] };
+			for (auto i = 1ull; i < count; ++i)
+				extend(result, points[i]);
+			return result;
+		}
+
+		rect bounds(const vertex* vertices, std::size_t count)
+		{
+			rect result = { vertices[0].pos, vertices[0].pos };
+			for (auto i = 1ull; i < count; ++i)
+				extend(result, vertices[i].pos);
+			return result;
+		}
+
+		bool line(vec2& start, vec2& end, const rect& clip)
+		{
+			auto start_code = outcode(start, clip);
+			auto end_code = outcode(end, clip);
+
+			// every step moves one end onto an edge. rounding can leave a point a hair outside
+			// another edge, so the steps are capped rather than trusted to converge
+			for (auto step = 0u; step < 8u; ++step)
+			{
+				if (!(start_code | end_code))
+					return true;
+				if (start_code & end_code)
+					return false;
+
+				const auto code = start_code ? start_code : end_code;
+				const auto dx = end.x - start.x;
+				const auto dy = end.y - start.y;
+
+				vec2 point;
+				if (code & top)
+					point = { start.x + dx * (clip.min.y - start.y) / dy, clip.min.y };
+				else if (code & bottom)
+					point = { start.x + dx * (clip.max.y - start.y) / dy, clip.max.y };
+				else if (code & left)
+					point = { clip.min.x, start.y + dy * (clip.min.x - start.x) / dx };
+				else
+					point = { clip.max.x, start.y + dy * (clip.max.x - start.x) / dx };
+
+				if (code == start_code)
+				{
+					start = point;
+					start_code = outcode(start, clip);
+				}
+				else
+				{
+					end = point;
+					end_code = outcode(end, clip);
+				}
+			}
+
+			return !(start_code | end_code);
+		}
+	}
+}
\ No newline at end of file
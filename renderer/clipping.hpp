@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include "types.hpp"
+
+namespace rendering
+{
+	namespace clipping
+	{
+		struct rect
+		{
+			vec2 min;
+			vec2 max;
+		};
+
+		constexpr rect unbounded =
+		{
+			{ -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() },
+			{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() }
+		};
+
+		// normalised so negative dimensions work like they do when drawing
+		constexpr rect from(vec2 pos, vec2 dimensions)
+		{
+			const vec2 end = { pos.x + dimensions.x, pos.y + dimensions.y };
+			return
+			{
+				{ pos.x < end.x ? pos.x : end.x, pos.y < end.y ? pos.y : end.y },
+				{ pos.x < end.x ? end.x : pos.x, pos.y < end.y ? end.y : pos.y }
+			};
+		}
+
+		// edges count as overlapping, a line along the border of the clip rect is still drawn
+		constexpr bool overlaps(const rect& a, const rect& b)
+		{
+			return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y;
+		}
+
+		constexpr bool contains(const rect& outer, const rect& inner)
+		{
+			return inner.min.x >= outer.min.x && inner.max.x <= outer.max.x && inner.min.y >= outer.min.y && inner.max.y <= outer.max.y;
+		}
+
+		// may come out empty, with min past max
+		constexpr rect intersection(const rect& a, const rect& b)
+		{
+			return
+			{
+				{ a.min.x > b.min.x ? a.min.x : b.min.x, a.min.y > b.min.y ? a.min.y : b.min.y },
+				{ a.max.x < b.max.x ? a.max.x : b.max.x, a.max.y < b.max.y ? a.max.y : b.max.y }
+			};
+		}
+
+		constexpr bool empty(const rect& rect)
+		{
+			return rect.min.x >= rect.max.x || rect.min.y >= rect.max.y;
+		}
+
+		// smallest rect around the points, count must not be 0
+		rect bounds(const vec2* points, std::size_t count);
+		rect bounds(const vertex* vertices, std::size_t count);
+
+		// cohen-sutherland, returns false if no part of the line is inside
+		bool line(vec2& start, vec2& end, const rect& clip);
+	}
+}
\ No newline at end of file
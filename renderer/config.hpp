@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace rendering
+{
+	constexpr auto max_vertices = 1000;
+	constexpr auto max_indices = max_vertices * 3;
+	// initial size of the gpu ring buffers, in flushes of max_vertices/max_indices
+	constexpr auto ring_flushes = 16;
+	constexpr auto use_frame_arena = true;
+	// boxes and lines are recorded as one instance each and expanded by the vertex shader
+	constexpr auto use_instancing = false;
+	constexpr auto max_instances = 1024;
+	// maximum distance in pixels between a tessellated curve and the true curve
+	constexpr auto circle_error = 0.25f;
+	// draw lists the renderer gathers from other threads each frame
+	constexpr auto max_draw_lists = 16;
+	// blocks of one flush each that all draw lists share, taken by a list that outgrows its own
+	constexpr auto draw_list_blocks = 8;
+	// glyphs drawn in one call, a frame's text only takes more than one draw past this
+	constexpr auto max_glyphs = 1024;
+	// square rgba8 sprite atlas pages. once all are full the least recently used page is cleared
+	constexpr auto atlas_size = 512;
+	constexpr auto atlas_pages = 4;
+	// images packed into the atlas at once, and sprites drawn in one call per page
+	constexpr auto max_atlas_images = 256;
+	constexpr auto max_sprites = 256;
+	// sdf circles, rounded boxes and rings drawn in one call
+	constexpr auto max_shapes = 128;
+	// the batches of a flush are drawn in sort layer order, keeping the order they were recorded
+	// in within a layer
+	constexpr auto use_batch_sorting = true;
+	// also group each layer's batches by state so mixed shapes merge into fewer draws. overlapping
+	// shapes of different kinds in one layer then no longer draw in the order they were recorded,
+	// a caller that relies on it puts them in different layers or turns this off
+	constexpr auto use_state_sorting = true;
+	// nesting depth of push_clip_rect
+	constexpr auto max_clip_rects = 16;
+	// frame timings and their percentiles, compiled out entirely when false
+	constexpr auto use_profiling = false;
+	constexpr auto profile_history = 128;
+	// gpu frame times from timestamp queries, read back this many frames late so they never stall
+	constexpr auto use_gpu_timing = true;
+	constexpr auto gpu_latency = 4;
+	// save and restore only the pieces of the game's pipeline state a frame actually changes,
+	// each read the first time it is changed, instead of all of them in begin()
+	constexpr auto use_lazy_state_backup = false;
+
+	// optional parts of a renderer. boxes and lines are always there
+	namespace feature
+	{
+		// circles, arcs and ellipses
+		constexpr std::uint32_t curves = 1u << 0;
+		constexpr std::uint32_t polygons = 1u << 1;
+		// the span apis
+		constexpr std::uint32_t bulk = 1u << 2;
+		constexpr std::uint32_t strokes = 1u << 3;
+		constexpr std::uint32_t text = 1u << 4;
+		constexpr std::uint32_t layers = 1u << 5;
+		constexpr std::uint32_t draw_lists = 1u << 6;
+		constexpr std::uint32_t sprites = 1u << 7;
+		// circles, rounded boxes and rings from a distance field, one quad each
+		constexpr std::uint32_t shapes = 1u << 8;
+		constexpr std::uint32_t all = (1u << 9) - 1u;
+	}
+
+	// what a renderer is built with. a config derives from this one and overrides what it
+	// needs. features it leaves out are not compiled and create no gpu resources
+	struct default_config
+	{
+		// one flush, which is also the most a single shape can use
+		static constexpr std::size_t max_vertices = rendering::max_vertices;
+		static constexpr std::size_t max_indices = rendering::max_indices;
+		static constexpr std::size_t max_glyphs = rendering::max_glyphs;
+		static constexpr std::size_t max_sprites = rendering::max_sprites;
+		static constexpr std::size_t max_shapes = rendering::max_shapes;
+		// boxes and lines as instances, see use_instancing. draw lists and layers are recorded
+		// with this config, so a renderer gathering them has to match it
+		static constexpr bool instancing = use_instancing;
+		static constexpr std::size_t max_instances = rendering::max_instances;
+		// per-frame storage from memory::frame rather than the static heap
+		static constexpr bool frame_arena = use_frame_arena;
+		static constexpr std::uint32_t features = feature::all;
+		static constexpr bool profiling = use_profiling;
+		static constexpr bool batch_sorting = use_batch_sorting;
+		static constexpr bool state_sorting = use_state_sorting;
+		static constexpr bool lazy_state_backup = use_lazy_state_backup;
+	};
+
+	// boxes, lines and text from a quarter of the buffers, for a small overlay
+	struct compact_config : default_config
+	{
+		static constexpr std::size_t max_vertices = 256;
+		static constexpr std::size_t max_indices = max_vertices * 3;
+		static constexpr std::size_t max_glyphs = 256;
+		static constexpr std::uint32_t features = feature::text;
+		static constexpr bool profiling = false;
+	};
+
+	// boxes and lines expanded from instances by the vertex shader. draw lists and layers are
+	// recorded without, so this renderer cannot gather them. half the instances keep a frame
+	// within the arena
+	struct instanced_config : default_config
+	{
+		static constexpr bool instancing = true;
+		static constexpr std::size_t max_instances = 512;
+		static constexpr std::uint32_t features = feature::all & ~(feature::draw_lists | feature::layers);
+	};
+}
\ No newline at end of file
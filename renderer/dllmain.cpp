@@ -23,7 +23,7 @@ extern "C" HRESULT __declspec(dllexport) entry(IDXGISwapChain* swapchain, UINT s
 	renderer->draw_box({ 50.f, 50.f }, { 50.f, 50.f }, { 1.f, 0.f, 0.f, 1.f });
 	renderer->draw_line({ 50.f, 125.f }, { 100.f, 125.f }, { 0.f, 0.f, 1.f, 1.f });
 	renderer->draw_filled_box({ 50.f, 150.f }, { 50.f, 50.f }, { 1.f, 0.f, 0.f, 1.f });
-	//renderer.draw_circle({ 75.f, 250.f }, 25.f, { 0.f, 0.f, 1.f, 1.f });
+	renderer->draw_circle({ 75.f, 250.f }, 25.f, { 0.f, 0.f, 1.f, 1.f });
 
 	renderer->end();
 
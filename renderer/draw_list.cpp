@@ -0,0 +1,205 @@
+#include <bit>
+#include "draw_list.hpp"
+
+namespace rendering
+{
+	std::atomic<std::uint32_t> draw_list::_pool_used { };
+	std::array<draw_list::block, draw_list_blocks> draw_list::_pool { };
+
+	bool draw_list::begin()
+	{
+		// pairs with release() so the renderer is done reading before anything is overwritten
+		if (_state.load(std::memory_order_acquire) == pending)
+			return false;
+
+		// release so whichever list takes a block next sees every read of it finished
+		auto chained = 0u;
+		for (auto i = 0ull; i < _chained_count; ++i)
+			chained |= 1u << (_chained[i] - _pool.data());
+		if (chained)
+			_pool_used.fetch_and(~chained, std::memory_order_release);
+
+		_chained_count = 0u;
+		_block.vertex_count = 0u;
+		_block.index_count = 0u;
+		_block.instance_count = 0u;
+		_block.batch_count = 0u;
+		_stats = { };
+		reset_clip();
+		return true;
+	}
+
+	void draw_list::submit()
+	{
+		// publishes everything recorded since begin()
+		_state.store(pending, std::memory_order_release);
+	}
+
+	void draw_list::set_viewport(vec2 pos, vec2 dimensions)
+	{
+		set_bounds(clipping::from(pos, dimensions));
+	}
+
+	bool draw_list::submitted() const
+	{
+		return _state.load(std::memory_order_acquire) == pending;
+	}
+
+	void draw_list::release()
+	{
+		_state.store(recording, std::memory_order_release);
+	}
+
+	draw_list::block& draw_list::current()
+	{
+		return _chained_count ? *_chained[_chained_count - 1] : _block;
+	}
+
+	const draw_list::block& draw_list::storage(std::size_t index) const
+	{
+		return index ? *_chained[index - 1] : _block;
+	}
+
+	bool draw_list::chain()
+	{
+		if (_chained_count == _chained.size())
+			return false;
+
+		// lowest free bit, retried if another list took it first
+		auto used = _pool_used.load(std::memory_order_relaxed);
+		std::uint32_t bit;
+		do
+		{
+			const auto index = std::countr_one(used);
+			if (index >= draw_list_blocks)
+				return false;
+			bit = 1u << index;
+		} while (!_pool_used.compare_exchange_weak(used, used | bit, std::memory_order_acquire, std::memory_order_relaxed));
+
+		auto& block = _pool[std::countr_zero(bit)];
+		block.vertex_count = 0u;
+		block.index_count = 0u;
+		block.instance_count = 0u;
+		block.batch_count = 0u;
+		_chained[_chained_count++] = &block;
+		++_stats.chained;
+		return true;
+	}
+
+	bool draw_list::allocate(std::size_t vertex_count, std::size_t index_count, geometry& geometry)
+	{
+		if (vertex_count == 0 || index_count == 0)
+			return false;
+
+		// a list cannot flush, it carries on in a new block instead. more than a whole
+		// block holds is dropped like anything that finds the pool empty
+		auto* block = &current();
+		if (block->vertex_count + vertex_count > max_vertices || block->index_count + index_count > max_indices || block->batch_count == max_batches)
+		{
+			if (vertex_count > max_vertices || index_count > max_indices || !chain())
+			{
+				++_stats.dropped;
+				return false;
+			}
+			block = &current();
+		}
+
+		geometry.vertices = &block->vertices[block->vertex_count];
+		geometry.indices = &block->indices[block->index_count];
+		geometry.base = static_cast<std::uint16_t>(block->vertex_count);
+
+		block->vertex_count += vertex_count;
+		block->index_count += index_count;
+		return true;
+	}
+
+	void draw_list::add_batch(std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		const auto mergeable = topology == D3D11_PRIMITIVE_TOPOLOGY_POINTLIST
+			|| topology == D3D11_PRIMITIVE_TOPOLOGY_LINELIST
+			|| topology == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+
+		// allocate() already made sure there is room for a new batch
+		auto& block = current();
+		const auto last = block.batch_count ? &block.batches[block.batch_count - 1] : nullptr;
+		if (mergeable && last && last->topology == topology && last->shape == shape_type::none)
+			last->count += index_count;
+		else
+			block.batches[block.batch_count++] = batch(index_count, topology);
+	}
+
+	void draw_list::add_instance(const instance& instance)
+	{
+		if constexpr (!default_config::instancing)
+			return;
+
+		auto* block = &current();
+		if (block->instance_count == max_list_instances || block->batch_count == max_batches)
+		{
+			if (!chain())
+			{
+				++_stats.dropped;
+				return;
+			}
+			block = &current();
+		}
+
+		block->instances[block->instance_count++] = instance;
+
+		const auto last = block->batch_count ? &block->batches[block->batch_count - 1] : nullptr;
+		if (last && last->shape == instance.type)
+			++last->count;
+		else
+			block->batches[block->batch_count++] = batch(1u, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, instance.type);
+	}
+
+	std::size_t draw_list::block_count() const
+	{
+		return 1u + _chained_count;
+	}
+
+	const vertex* draw_list::vertices(std::size_t block) const
+	{
+		return storage(block).vertices.data();
+	}
+
+	std::size_t draw_list::vertex_count(std::size_t block) const
+	{
+		return storage(block).vertex_count;
+	}
+
+	const std::uint16_t* draw_list::indices(std::size_t block) const
+	{
+		return storage(block).indices.data();
+	}
+
+	std::size_t draw_list::index_count(std::size_t block) const
+	{
+		return storage(block).index_count;
+	}
+
+	const instance* draw_list::instances(std::size_t block) const
+	{
+		return storage(block).instances.data();
+	}
+
+	std::size_t draw_list::instance_count(std::size_t block) const
+	{
+		return storage(block).instance_count;
+	}
+
+	const batch* draw_list::batches(std::size_t block) const
+	{
+		return storage(block).batches.data();
+	}
+
+	std::size_t draw_list::batch_count(std::size_t block) const
+	{
+		return storage(block).batch_count;
+	}
+
+	const draw_list::statistics& draw_list::stats() const
+	{
+		return _stats;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "recorder.hpp"
+
+namespace rendering
+{
+	// command list that can be recorded on any thread without locks. the recording thread
+	// calls begin(), draws, then submit(). the renderer gathers submitted lists in end() and
+	// hands them back, until then begin() fails and the list is not touched.
+	// a list holds one flush itself and chains blocks from a pool shared by all lists when it
+	// outgrows that, each block is drawn on its own. the chained blocks go back in begin()
+	class draw_list : public recorder<draw_list>
+	{
+		friend class recorder<draw_list>;
+	public:
+		static constexpr auto max_blocks = 1 + draw_list_blocks;
+
+		struct statistics
+		{
+			// primitives that did not fit since the last begin(), because the pool was empty
+			std::size_t dropped;
+			// blocks taken from the pool since the last begin()
+			std::size_t chained;
+		};
+
+		// recording thread
+		bool begin();
+		void submit();
+		void add_instance(const instance& instance);
+		// the outermost clip rect, anything entirely outside it is culled while recording.
+		// it is kept across begin()
+		void set_viewport(vec2 pos, vec2 dimensions);
+
+		// renderer thread
+		bool submitted() const;
+		void release();
+
+		// indices and batches refer to their own block only
+		std::size_t block_count() const;
+		const vertex* vertices(std::size_t block) const;
+		std::size_t vertex_count(std::size_t block) const;
+		const std::uint16_t* indices(std::size_t block) const;
+		std::size_t index_count(std::size_t block) const;
+		const instance* instances(std::size_t block) const;
+		std::size_t instance_count(std::size_t block) const;
+		const batch* batches(std::size_t block) const;
+		std::size_t batch_count(std::size_t block) const;
+
+		const statistics& stats() const;
+	private:
+		static constexpr auto max_batches = max_vertices / 4;
+		static constexpr auto max_list_instances = default_config::instancing ? default_config::max_instances : 0;
+
+		enum state : std::uint32_t
+		{
+			recording,
+			pending
+		};
+
+		struct block
+		{
+			std::size_t vertex_count;
+			std::size_t index_count;
+			std::size_t instance_count;
+			std::size_t batch_count;
+			std::array<vertex, max_vertices> vertices;
+			std::array<std::uint16_t, max_indices> indices;
+			std::array<instance, max_list_instances> instances;
+			std::array<batch, max_batches> batches;
+		};
+
+		bool allocate(std::size_t vertex_count, std::size_t index_count, geometry& geometry);
+		void add_batch(std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology);
+		block& current();
+		const block& storage(std::size_t index) const;
+		// moves recording on to a block from the pool, false if none is left
+		bool chain();
+
+		// everything is zero initialised so a list can live in static storage without a
+		// constructor call, which is where it belongs as it is too large for the heap
+		std::atomic<std::uint32_t> _state { recording };
+		statistics _stats { };
+		std::size_t _chained_count { };
+		std::array<block*, draw_list_blocks> _chained { };
+		block _block { };
+
+		// one bit per pool block, set while a list holds it
+		static_assert(draw_list_blocks <= 32);
+		static std::atomic<std::uint32_t> _pool_used;
+		static std::array<block, draw_list_blocks> _pool;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,409 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace rendering
+{
+	namespace font
+	{
+		// DejaVu Sans (Bitstream Vera license) at 13 pixels for characters 32 to 126, rasterized
+		// with 8x8 supersampling into a single channel coverage atlas. positions are in pixels
+		// relative to the pen on the baseline
+		constexpr std::uint32_t atlas_width = 128;
+		constexpr std::uint32_t atlas_height = 69;
+		constexpr char first_char = 32;
+		constexpr char last_char = 126;
+		constexpr float ascent = 12.07f;
+		constexpr float line_height = 15.f;
+
+		struct glyph
+		{
+			std::uint8_t x;
+			std::uint8_t y;
+			std::uint8_t width;
+			std::uint8_t height;
+			std::int8_t bearing_x;
+			std::int8_t bearing_y;
+			float advance;
+		};
+
+		constexpr std::array<glyph, last_char - first_char + 1> glyphs
+		{{
+			{ 0, 0, 0, 0, 0, 0, 4.1323f },
+			{ 18, 27, 3, 10, 1, -10, 5.2114f },
+			{ 63, 61, 4, 5, 1, -10, 5.9795f },
+			{ 22, 27, 9, 10, 1, -10, 10.8926f },
+			{ 41, 0, 7, 12, 1, -10, 8.2710f },
+			{ 89, 0, 12, 11, 0, -10, 12.3525f },
+			{ 102, 0, 10, 11, 0, -10, 10.1372f },
+			{ 68, 61, 2, 5, 1, -10, 3.5737f },
+			{ 49, 0, 4, 12, 1, -10, 5.0718f },
+			{ 54, 0, 3, 12, 1, -10, 5.0718f },
+			{ 52, 61, 7, 7, 0, -10, 6.5000f },
+			{ 28, 50, 9, 9, 1, -9, 10.8926f },
+			{ 81, 61, 2, 4, 1, -2, 4.1323f },
+			{ 109, 61, 5, 2, 0, -5, 4.6909f },
+			{ 115, 61, 2, 2, 1, -2, 4.1323f },
+			{ 58, 0, 5, 12, 0, -10, 4.3799f },
+			{ 113, 0, 8, 11, 0, -10, 8.2710f },
+			{ 32, 27, 7, 10, 1, -10, 8.2710f },
+			{ 40, 27, 7, 10, 0, -10, 8.2710f },
+			{ 0, 15, 8, 11, 0, -10, 8.2710f },
+			{ 48, 27, 8, 10, 0, -10, 8.2710f },
+			{ 9, 15, 7, 11, 1, -10, 8.2710f },
+			{ 17, 15, 8, 11, 0, -10, 8.2710f },
+			{ 57, 27, 7, 10, 1, -10, 8.2710f },
+			{ 26, 15, 8, 11, 0, -10, 8.2710f },
+			{ 35, 15, 8, 11, 0, -10, 8.2710f },
+			{ 60, 61, 2, 7, 1, -7, 4.3799f },
+			{ 38, 50, 2, 9, 1, -7, 4.3799f },
+			{ 91, 50, 9, 8, 1, -8, 10.8926f },
+			{ 84, 61, 9, 4, 1, -6, 10.8926f },
+			{ 101, 50, 9, 8, 1, -8, 10.8926f },
+			{ 65, 27, 6, 10, 0, -10, 6.8999f },
+			{ 3, 0, 13, 13, 0, -10, 13.0000f },
+			{ 72, 27, 9, 10, 0, -10, 8.8931f },
+			{ 82, 27, 7, 10, 1, -10, 8.9185f },
+			{ 44, 15, 9, 11, 0, -10, 9.0771f },
+			{ 90, 27, 9, 10, 1, -10, 10.0103f },
+			{ 100, 27, 7, 10, 1, -10, 8.2139f },
+			{ 108, 27, 6, 10, 1, -10, 7.4775f },
+			{ 54, 15, 10, 11, 0, -10, 10.0737f },
+			{ 115, 27, 8, 10, 1, -10, 9.7754f },
+			{ 124, 27, 2, 10, 1, -10, 3.8340f },
+			{ 17, 0, 4, 13, -1, -10, 3.8340f },
+			{ 0, 39, 8, 10, 1, -10, 8.5249f },
+			{ 9, 39, 7, 10, 1, -10, 7.2427f },
+			{ 17, 39, 9, 10, 1, -10, 11.2163f },
+			{ 27, 39, 8, 10, 1, -10, 9.7246f },
+			{ 65, 15, 10, 11, 0, -10, 10.2324f },
+			{ 36, 39, 7, 10, 1, -10, 7.8394f },
+			{ 64, 0, 10, 12, 0, -10, 10.2324f },
+			{ 44, 39, 8, 10, 1, -10, 9.0327f },
+			{ 76, 15, 8, 11, 0, -10, 8.2520f },
+			{ 53, 39, 9, 10, -1, -10, 7.9409f },
+			{ 85, 15, 8, 11, 1, -10, 9.5151f },
+			{ 63, 39, 9, 10, 0, -10, 8.8931f },
+			{ 73, 39, 13, 10, 0, -10, 12.8540f },
+			{ 87, 39, 9, 10, 0, -10, 8.9058f },
+			{ 97, 39, 9, 10, -1, -10, 7.9409f },
+			{ 107, 39, 9, 10, 0, -10, 8.9058f },
+			{ 75, 0, 3, 12, 1, -10, 5.0718f },
+			{ 79, 0, 5, 12, 0, -10, 4.3799f },
+			{ 85, 0, 3, 12, 1, -10, 5.0718f },
+			{ 71, 61, 9, 5, 1, -10, 10.8926f },
+			{ 118, 61, 8, 2, -1, 2, 6.5000f },
+			{ 104, 61, 4, 3, 1, -11, 6.5000f },
+			{ 41, 50, 7, 9, 0, -8, 7.9663f },
+			{ 94, 15, 7, 11, 1, -10, 8.2520f },
+			{ 49, 50, 7, 9, 0, -8, 7.1475f },
+			{ 102, 15, 8, 11, 0, -10, 8.2520f },
+			{ 57, 50, 8, 9, 0, -8, 7.9980f },
+			{ 117, 39, 5, 10, 0, -10, 4.5767f },
+			{ 111, 15, 8, 11, 0, -8, 8.2520f },
+			{ 0, 50, 7, 10, 1, -10, 8.2393f },
+			{ 8, 50, 2, 10, 1, -10, 3.6118f },
+			{ 22, 0, 4, 13, -1, -10, 3.6118f },
+			{ 11, 50, 7, 10, 1, -10, 7.5283f },
+			{ 19, 50, 2, 10, 1, -10, 3.6118f },
+			{ 111, 50, 11, 8, 1, -8, 12.6636f },
+			{ 0, 61, 7, 8, 1, -8, 8.2393f },
+			{ 66, 50, 8, 9, 0, -8, 7.9536f },
+			{ 120, 15, 7, 11, 1, -8, 8.2520f },
+			{ 0, 27, 8, 11, 0, -8, 8.2520f },
+			{ 8, 61, 5, 8, 1, -8, 5.3447f },
+			{ 75, 50, 7, 9, 0, -8, 6.7729f },
+			{ 22, 50, 5, 10, 0, -10, 5.0972f },
+			{ 83, 50, 7, 9, 1, -8, 8.2393f },
+			{ 14, 61, 8, 8, 0, -8, 7.6934f },
+			{ 23, 61, 11, 8, 0, -8, 10.6323f },
+			{ 35, 61, 8, 8, 0, -8, 7.6934f },
+			{ 9, 27, 8, 11, 0, -8, 7.6934f },
+			{ 44, 61, 7, 8, 0, -8, 6.8237f },
+			{ 27, 0, 6, 13, 1, -10, 8.2710f },
+			{ 0, 0, 2, 14, 1, -10, 4.3799f },
+			{ 34, 0, 6, 13, 1, -10, 8.2710f },
+			{ 94, 61, 9, 4, 1, -6, 10.8926f }
+		}};
+
+		constexpr std::array<std::uint8_t, atlas_width * atlas_height> atlas
+		{{
+			0x54, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x00, 0x00, 0x00, 0xa7, 0x54, 0x00, 0x00, 0x00, 0x04, 0x9b, 0xd7,
+			0x8b, 0x00, 0x54, 0xdf, 0xaf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xaf, 0x00, 0x00, 0x9f, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x28, 0x00,
+			0x00, 0x00, 0x04, 0x60, 0x9b, 0x9f, 0x74, 0x10, 0x00, 0x00, 0x00, 0xc3, 0xdf, 0xa7, 0x00, 0x78, 0x14, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xdf, 0xdf, 0x00, 0x00, 0x30, 0x97, 0x8b, 0x18, 0x00, 0x00,
+			0x00, 0x5c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x83, 0x9f, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x93, 0x9b, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x40, 0xbf, 0xe3, 0xbf, 0xd3, 0xdb, 0x6c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x78, 0x3c, 0x00, 0x00, 0x00, 0x4c, 0xeb, 0x20,
+			0x00, 0x00, 0x00, 0x0c, 0xb3, 0x93, 0x00, 0x00, 0x00, 0x00, 0x20, 0x83, 0x9b, 0x4c, 0x10, 0x00, 0x00, 0x00, 0xbf, 0x54, 0x00, 0x00, 0x44, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf7, 0x14, 0x00,
+			0x00, 0x10, 0xcb, 0xd7, 0x78, 0x6c, 0xbf, 0xe7, 0x28, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0xb3, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x0c, 0xe7, 0x4c, 0x70, 0xc7, 0x00, 0x00,
+			0x1c, 0xdb, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xbb, 0x60, 0x80, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x83, 0x70, 0xe7, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x00, 0x70, 0xcf, 0x40, 0x00, 0x00, 0x00, 0x1c, 0xa3, 0xab, 0x04, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x60, 0xbf, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x80, 0x9f, 0x00, 0x00, 0x00, 0x68, 0xe7, 0xab, 0xb3, 0xaf, 0x97, 0x00, 0x00, 0x34, 0xeb, 0x04, 0x00, 0x00, 0x00, 0xdb, 0x44, 0x00, 0x00, 0x00, 0x50, 0xc3, 0x00, 0x00,
+			0x00, 0x9f, 0xd7, 0x0c, 0x00, 0x00, 0x00, 0xa3, 0xd7, 0x04, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x64, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x3c, 0xc3, 0x00, 0x00, 0xef, 0x14, 0x00,
+			0xa7, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x97, 0x00, 0x00, 0x50, 0xf3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x40, 0xcf, 0x0c, 0x00, 0x24, 0x40, 0x0c, 0x18, 0x08, 0x9b, 0x74, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x60, 0xbf, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x80, 0x9f, 0x00, 0x00, 0x00, 0xdb, 0x50, 0x40, 0x60, 0x00, 0x04, 0x00, 0x00, 0x87, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x93, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x78, 0x00, 0x00,
+			0x0c, 0xfb, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x44, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x14, 0xf7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x38, 0xc7, 0x00, 0x04, 0xf3, 0x10, 0x44,
+			0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfb, 0x4c, 0x00, 0x00, 0x08, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0xc3, 0x34, 0x00, 0x6c, 0xe7, 0xa7, 0xd3, 0xe3, 0x40, 0x14, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x70, 0xbf, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x7c, 0xb3, 0x00, 0x00, 0x00, 0xcf, 0x83, 0x44, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x74, 0x00, 0x00, 0x00, 0x00, 0x64, 0xd3, 0x00, 0x00, 0x04, 0xeb, 0x24, 0x00, 0x00,
+			0x3c, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x78, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0xc3, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x08, 0xdf, 0x70, 0x8f, 0xb3, 0x04, 0xd3,
+			0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcb, 0xf7, 0x54, 0x00, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x20, 0xff, 0x28, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x0c, 0xdf, 0x00, 0x0c, 0xf3, 0x1c, 0x00, 0x1c, 0xf7, 0x40, 0x00, 0xdf, 0x18, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x24, 0x68, 0xdb, 0x70, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x34, 0xeb, 0x78, 0x3c, 0x00, 0x3c, 0xdb, 0xf7, 0xd3, 0x83, 0x14, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x44, 0xf3, 0x00, 0x00, 0x3c, 0xdb, 0x00, 0x00, 0x00,
+			0x40, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x78, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x18, 0x78, 0x6c, 0x0c, 0x78, 0x87,
+			0x18, 0xbb, 0xdf, 0xb3, 0x0c, 0x00, 0x00, 0xb3, 0x9b, 0x4c, 0xf7, 0x54, 0x00, 0x00, 0xf3, 0x34, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x20, 0xbf, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0xcb, 0x40, 0x00, 0xe7, 0x0c, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x3c, 0xa3, 0xe3, 0x48, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x1c, 0xd3, 0xaf, 0x64, 0x00, 0x00, 0x00, 0x58, 0x9f, 0xbb, 0xd7, 0x08, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xeb, 0x00, 0x00, 0x8b, 0x83, 0x00, 0x00, 0x00,
+			0x2c, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x64, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x24, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xd7, 0x0c,
+			0x8f, 0x83, 0x00, 0x9f, 0x74, 0x00, 0x18, 0xff, 0x20, 0x00, 0x54, 0xf7, 0x54, 0x3c, 0xe7, 0x04, 0x00, 0x14, 0xff, 0x38, 0x00, 0x00, 0x00, 0xef, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x10, 0xd7, 0x00, 0x10, 0xef, 0x10, 0x00, 0x0c, 0xef, 0x40, 0x44, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x80, 0xb7, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x74, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x08, 0xff, 0x24, 0x00, 0xb7, 0x78, 0x00, 0x00, 0x00, 0x00, 0x68, 0xcf, 0x00, 0x00, 0xdb, 0x3c, 0x00, 0x00, 0x00,
+			0x00, 0xe3, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfb, 0x1c, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x3c, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x58, 0x00,
+			0xbf, 0x40, 0x00, 0x60, 0x9f, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0x54, 0xf7, 0xd3, 0x68, 0x00, 0x00, 0x00, 0xe7, 0x64, 0x00, 0x00, 0x20, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0xcf, 0x28, 0x00, 0x9b, 0xcb, 0x80, 0xbf, 0xeb, 0xaf, 0xd3, 0x24, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x60, 0xbf, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x80, 0x9f, 0x00, 0x00, 0x00, 0x68, 0x18, 0x40, 0x60, 0x60, 0xf3, 0x0c, 0x00, 0x80, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x8f, 0x00, 0x28, 0xe7, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x54, 0xfb, 0x60, 0x00, 0x00, 0x34, 0xe7, 0x8f, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x87, 0x8b, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbb, 0x00, 0x00,
+			0x9f, 0x6c, 0x00, 0x87, 0x83, 0x00, 0x00, 0xd3, 0xaf, 0x10, 0x00, 0x10, 0xc3, 0xff, 0x54, 0x00, 0x00, 0x00, 0x87, 0xd3, 0x0c, 0x00, 0x9f, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x5c, 0xb7, 0x04, 0x00, 0x4c, 0x68, 0x28, 0x58, 0x4c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x60, 0xbf, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x80, 0x9f, 0x00, 0x00, 0x00, 0x83, 0xd7, 0xef, 0xf7, 0xc3, 0x38, 0x00, 0x00, 0x24, 0xf3, 0x08, 0x00, 0x00, 0x04, 0xe7, 0x38, 0x00, 0x7c, 0x9b, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x5c, 0xe3, 0xeb, 0xe3, 0xff, 0x80, 0x04, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xdb, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x08, 0xd7, 0x28, 0x00, 0x00,
+			0x2c, 0xdf, 0xa7, 0xdf, 0x1c, 0x00, 0x00, 0x24, 0xc7, 0xf3, 0xdf, 0xef, 0x93, 0x60, 0xf7, 0x40, 0x00, 0x00, 0x0c, 0xb7, 0xef, 0xe7, 0xdb, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x00, 0x8f, 0xb3, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x7c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x74, 0x00, 0x00, 0x00, 0xc7, 0x60, 0x00, 0x00, 0x00, 0x58, 0xdb, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x93, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x68, 0x00, 0x00, 0x54, 0xbf, 0x00, 0x00, 0xc3, 0x4c, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0xe7, 0x8b, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x28, 0x00, 0x30, 0x70, 0xff, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x00,
+			0x00, 0x0c, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x68, 0xdf, 0xc7, 0x9f, 0xbb, 0xdf, 0x78, 0x04, 0x00, 0x00, 0x00, 0x50, 0xab, 0xf3, 0x24, 0x00, 0x10, 0x5c, 0xf7, 0x30, 0x00, 0x00, 0x00, 0x10, 0xd7, 0xdf,
+			0x78, 0x00, 0x48, 0xcf, 0xef, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x9f, 0x00, 0x00, 0x93, 0x34, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x9f, 0x28, 0x00, 0x00, 0xa7, 0xbf, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x00, 0x8f, 0xbf, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x40, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x8b, 0x2c, 0x00, 0x00, 0x30, 0xaf, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+			0x14, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x40, 0x83, 0x9f, 0x97, 0x58, 0x00, 0x00, 0x00, 0x50, 0x80, 0x80, 0x80, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x08, 0x68, 0x9f, 0x97, 0x58, 0x00, 0x00, 0x00, 0x00, 0x54, 0x97, 0x9f, 0x70,
+			0x0c, 0x00, 0x00, 0x00, 0x00, 0x54, 0x9b, 0x97, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x58, 0x93, 0x9f, 0x87, 0x38, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x93, 0x9f, 0x8f, 0x54, 0x04, 0x00,
+			0x00, 0x00, 0x00, 0x04, 0x60, 0x9b, 0x9f, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x58, 0x97, 0x9f, 0x8b, 0x4c, 0x00, 0x00, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x00, 0xc3, 0x54,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xdf, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x40, 0x24, 0x04, 0x20, 0x04, 0x00, 0x1c, 0x0c, 0x14, 0x40, 0x24, 0x00, 0x00, 0x00,
+			0x00, 0x97, 0x8f, 0x70, 0x87, 0xeb, 0x97, 0x00, 0x00, 0x9f, 0xdb, 0x9f, 0x9f, 0x9f, 0x3c, 0x00, 0x00, 0x00, 0x0c, 0xc3, 0xcb, 0x78, 0x80, 0xa3, 0x00, 0x00, 0x00, 0x80, 0xef, 0x74, 0x68, 0xcf,
+			0xbf, 0x00, 0x00, 0x00, 0x83, 0xe7, 0x70, 0x74, 0xeb, 0x64, 0x00, 0x00, 0x00, 0x0c, 0xbf, 0xdf, 0x83, 0x60, 0x8b, 0xe7, 0x54, 0x00, 0x00, 0x0c, 0xbf, 0xe3, 0x8b, 0x60, 0x83, 0xd3, 0xaf, 0x00,
+			0x00, 0x00, 0x10, 0xcb, 0xd7, 0x78, 0x6c, 0xbf, 0xe7, 0x28, 0x00, 0x00, 0x00, 0x9f, 0xe3, 0x7c, 0x60, 0x8b, 0xdf, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0x4c, 0xf3, 0xc7, 0xcf, 0xa3, 0xff, 0x20, 0x00, 0xdf, 0xab, 0xd7, 0xbf, 0xf7, 0x7c, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xf7, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xcf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x74, 0x00, 0x00, 0x30,
+			0xff, 0x1c, 0x00, 0x0c, 0xf7, 0x54, 0x00, 0x00, 0x5c, 0xe7, 0x04, 0x00, 0x00, 0x9f, 0xd7, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x00, 0x00, 0x9f, 0xd3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+			0x00, 0x00, 0x9f, 0xd7, 0x0c, 0x00, 0x00, 0x00, 0xa3, 0xd7, 0x04, 0x00, 0x14, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60,
+			0x14, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40, 0x24, 0x20, 0xff, 0x20, 0x00, 0x04, 0xe7, 0x68, 0x00, 0x00, 0x9b, 0xff, 0x20, 0x00, 0xdf, 0xd3, 0x0c, 0x00, 0x30, 0xfb, 0x2c, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xe3, 0x00, 0x00, 0x9f, 0xab, 0x40, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x68, 0x1c, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x80, 0x00, 0x00, 0x3c,
+			0xfb, 0x10, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0x20, 0xff, 0x34, 0x00, 0x0c, 0xfb, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfb, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x0c, 0xfb, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x44, 0x00, 0x18, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0xab,
+			0xd7, 0xbf, 0xf7, 0x7c, 0x00, 0x00, 0x00, 0x40, 0xf3, 0xc7, 0xcf, 0xa3, 0xff, 0x20, 0x00, 0x34, 0xff, 0x08, 0x00, 0x00, 0x2c, 0xff, 0x20, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0xc7, 0x74, 0x00,
+			0x00, 0x00, 0x3c, 0x9f, 0xab, 0xd7, 0x3c, 0x00, 0x00, 0x9f, 0xeb, 0xdf, 0xf3, 0xdb, 0x28, 0x00, 0x00, 0x0c, 0xff, 0xb3, 0xe3, 0xc7, 0xf7, 0x7c, 0x00, 0x00, 0x00, 0x30, 0xd3, 0x9b, 0x8b, 0xd3,
+			0x60, 0x00, 0x00, 0x14, 0xff, 0x3c, 0x00, 0x00, 0x4c, 0xff, 0x58, 0x00, 0x3c, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x3c, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x78, 0x00, 0x00, 0xa7, 0xf7, 0xaf, 0x74, 0x38, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0xd3,
+			0x0c, 0x00, 0x30, 0xfb, 0x2c, 0x00, 0x04, 0xe7, 0x6c, 0x00, 0x00, 0x9f, 0xff, 0x20, 0x00, 0x40, 0xe7, 0x00, 0x00, 0x00, 0x20, 0xff, 0x20, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0xa3, 0x80, 0x00,
+			0x00, 0x00, 0x30, 0x80, 0x8b, 0xe7, 0x7c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0xb3, 0xd3, 0x00, 0x00, 0x20, 0xff, 0xd3, 0x0c, 0x00, 0x40, 0xff, 0x2c, 0x00, 0x00, 0x50, 0xdf, 0x93, 0x87, 0xd7,
+			0x83, 0x00, 0x00, 0x00, 0xa7, 0xd7, 0x4c, 0x50, 0xd3, 0xf7, 0x60, 0x00, 0x40, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x20, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0x00,
+			0x00, 0x40, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x00, 0x00, 0x04, 0x58, 0x9f, 0xd7, 0xff, 0xbb, 0x08, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x70,
+			0x00, 0x00, 0x00, 0xc7, 0x74, 0x00, 0x34, 0xff, 0x08, 0x00, 0x00, 0x30, 0xff, 0x20, 0x00, 0x28, 0xff, 0x14, 0x00, 0x00, 0x40, 0xff, 0x20, 0x00, 0xdf, 0x78, 0x00, 0x00, 0x00, 0xcb, 0x70, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0x18, 0x00, 0x04, 0xff, 0x74, 0x00, 0x00, 0x00, 0xe3, 0x6c, 0x00, 0x08, 0xef, 0x5c, 0x00, 0x00, 0x1c,
+			0xfb, 0x38, 0x00, 0x00, 0x08, 0x7c, 0xbf, 0xb3, 0x4c, 0xff, 0x40, 0x00, 0x2c, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x30, 0x00, 0x00, 0x0c, 0x20, 0x58, 0xff, 0x00,
+			0x00, 0x2c, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfb, 0x64, 0x00, 0xdf, 0x68, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0xdf, 0x60,
+			0x00, 0x00, 0x00, 0xa3, 0x80, 0x00, 0x40, 0xe7, 0x00, 0x00, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0xcb, 0xa3, 0x0c, 0x14, 0xc3, 0xff, 0x20, 0x00, 0xdf, 0xdf, 0x18, 0x00, 0x40, 0xfb, 0x20, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0x18, 0x00, 0x00, 0xd7, 0x78, 0x00, 0x00, 0x00, 0xe7, 0x6c, 0x00, 0x20, 0xff, 0x2c, 0x00, 0x00, 0x00,
+			0xe7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xf7, 0x0c, 0x00, 0x00, 0xdb, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00,
+			0x00, 0x00, 0xe3, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x80, 0x00, 0xc3, 0x8b, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x4c, 0x00, 0xdf, 0x78,
+			0x00, 0x00, 0x00, 0xcb, 0x70, 0x00, 0x30, 0xff, 0x0c, 0x00, 0x00, 0x38, 0xff, 0x20, 0x00, 0x00, 0x20, 0xbb, 0xff, 0xdf, 0x6c, 0xff, 0x0c, 0x00, 0xdf, 0x9b, 0xe3, 0xcf, 0xf3, 0x64, 0x00, 0x00,
+			0x00, 0x48, 0x04, 0x00, 0x08, 0x97, 0xeb, 0x08, 0x00, 0x48, 0x04, 0x00, 0x18, 0xc3, 0xcb, 0x00, 0x00, 0x00, 0x74, 0xd7, 0x10, 0x00, 0x58, 0xfb, 0x20, 0x00, 0x00, 0xe7, 0x97, 0x04, 0x00, 0x58,
+			0xff, 0x28, 0x00, 0x00, 0x28, 0x08, 0x00, 0x24, 0xd7, 0x87, 0x00, 0x00, 0x00, 0x50, 0xfb, 0x68, 0x04, 0x00, 0x08, 0x74, 0x54, 0x00, 0x00, 0x54, 0xfb, 0x68, 0x08, 0x00, 0x00, 0x64, 0xff, 0x00,
+			0x00, 0x00, 0x54, 0xfb, 0x60, 0x00, 0x00, 0x34, 0xe7, 0x93, 0x00, 0x00, 0x18, 0x70, 0x14, 0x00, 0x00, 0x48, 0xfb, 0x4c, 0x00, 0x70, 0xeb, 0x28, 0x00, 0x04, 0x87, 0xeb, 0x08, 0x00, 0xdf, 0xdf,
+			0x18, 0x00, 0x40, 0xfb, 0x20, 0x00, 0x00, 0xdb, 0x80, 0x00, 0x04, 0xaf, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xe7, 0x00, 0x00, 0xdf, 0x60, 0x08, 0x20, 0x10, 0x00, 0x00, 0x00,
+			0x00, 0xdf, 0xf7, 0xdf, 0xfb, 0xd7, 0x38, 0x00, 0x00, 0xe7, 0xf7, 0xdf, 0xff, 0xc7, 0x24, 0x00, 0x00, 0x00, 0x04, 0x9f, 0xf3, 0xdf, 0xef, 0x60, 0x00, 0x00, 0x00, 0x3c, 0xe3, 0xeb, 0xe3, 0xf7,
+			0x6c, 0x00, 0x00, 0x00, 0x8b, 0xf7, 0xe3, 0xfb, 0x93, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0xdb, 0xf3, 0xdf, 0xf7, 0xbb, 0x24, 0x00, 0x00, 0x00, 0x54, 0xd7, 0xf7, 0xdf, 0xef, 0xdb, 0x6c, 0x00,
+			0x00, 0x00, 0x00, 0x5c, 0xe3, 0xeb, 0xe3, 0xf3, 0x83, 0x04, 0x00, 0x00, 0x14, 0xc3, 0xff, 0xdf, 0xe7, 0xf7, 0x80, 0x00, 0x00, 0x04, 0x97, 0xfb, 0xdf, 0xef, 0xdb, 0x3c, 0x00, 0x00, 0xdf, 0x9b,
+			0xe3, 0xcf, 0xf3, 0x64, 0x00, 0x00, 0x00, 0x38, 0xe3, 0xd7, 0xe3, 0x8f, 0xff, 0x20, 0x00, 0x00, 0x40, 0x74, 0x40, 0x64, 0xe7, 0x78, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x18, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x18, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x08, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x93, 0xb7, 0xa7, 0x5c, 0x00, 0x00, 0x00, 0xa7, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x14, 0x40, 0x24, 0x04, 0x20, 0x04, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, 0x00, 0x30, 0x34, 0x00, 0x00,
+			0x0c, 0x3c, 0x70, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x80, 0x9f, 0x93, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x80, 0x20, 0x00, 0x00, 0x70, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10,
+			0x00, 0x00, 0x38, 0x8f, 0x9f, 0x78, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x80, 0x80, 0x64, 0x18, 0x00, 0x00, 0x60, 0x80, 0x80, 0x7c, 0x58, 0x1c,
+			0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x00, 0x60, 0x80, 0x80, 0x80, 0x80, 0x60, 0x00, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x00, 0x60, 0x40, 0x00, 0x00,
+			0x00, 0x40, 0xf3, 0xc7, 0xcf, 0xa3, 0xff, 0x20, 0x00, 0x5c, 0xdf, 0x00, 0x00, 0x00, 0x2c, 0xf7, 0x14, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x87, 0x80, 0x00, 0xa7, 0x60, 0x00, 0x00,
+			0x9f, 0xef, 0xd3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x9f, 0x74, 0x97, 0xfb, 0x64, 0x00, 0x00, 0x00, 0x00, 0x20, 0xeb, 0xff, 0x40, 0x00, 0x00, 0x8b, 0x9f, 0x9f, 0x9f, 0xcb, 0xf3, 0x0c,
+			0x00, 0x1c, 0xe3, 0x80, 0x6c, 0xdb, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xf7, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0xc3, 0xf3, 0x2c, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0xb7, 0xfb,
+			0xa7, 0x0c, 0x00, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0x9f, 0x9f, 0x28, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0x9f, 0x78, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x04, 0xe7, 0x6c, 0x00, 0x00, 0x9f, 0xff, 0x20, 0x00, 0x08, 0xeb, 0x48, 0x00, 0x00, 0x93, 0xa7, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x40, 0x00, 0xe7, 0x20, 0x00, 0x00,
+			0x10, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x83, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x80, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x9b, 0x00,
+			0x00, 0x08, 0x08, 0x00, 0x00, 0x58, 0xfb, 0x00, 0x00, 0x00, 0x10, 0xf7, 0x7c, 0xe7, 0x04, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xcb, 0x93, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x28,
+			0xe3, 0x9b, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x34, 0xff, 0x08, 0x00, 0x00, 0x30, 0xff, 0x20, 0x00, 0x00, 0x8b, 0xab, 0x00, 0x08, 0xef, 0x40, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0x30, 0xbf, 0xbf, 0xfb, 0xc7, 0xc3, 0xff, 0xbf, 0xa7, 0x00,
+			0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xdb, 0x00, 0x00, 0x00, 0x60, 0xb7, 0x20, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x38, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xbb, 0x00, 0x00, 0x00, 0x6c, 0xcf, 0x04, 0xe7, 0x50, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x68, 0xf7, 0x0c, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x40, 0xe7, 0x00, 0x00, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0x20, 0xfb, 0x18, 0x60, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0x10, 0x40, 0x7c, 0xc7, 0x40, 0x93, 0xaf, 0x40, 0x38, 0x00,
+			0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xd7, 0x87, 0x00, 0x00, 0x1c, 0xe3, 0x20, 0x20, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd7, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x8f, 0xd7, 0x18, 0x00, 0x00, 0x00, 0xcb, 0x70, 0x00, 0x8b, 0xaf, 0x00, 0x00, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0xc3, 0xc3, 0x18, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x28, 0xff, 0x34, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0x9f, 0x9f, 0x14, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0x9f, 0x3c, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0x9f, 0x9f, 0xe7, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x30, 0xff, 0x0c, 0x00, 0x00, 0x38, 0xff, 0x20, 0x00, 0x00, 0x00, 0xb7, 0x78, 0xc7, 0x74, 0x00, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0x00, 0x87, 0x80, 0x00, 0xa7, 0x60, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xab, 0xc3, 0x08, 0x00, 0x00, 0xb3, 0x74, 0x00, 0x20, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x74, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x4c, 0xef, 0x18, 0x00, 0x00, 0x00, 0x2c, 0xfb, 0x18, 0x00, 0x30, 0xfb, 0x18, 0x00, 0x00, 0xbf, 0xbf, 0x80, 0x80, 0x97, 0xe3, 0x40, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x20, 0xff, 0x40, 0x00, 0xbf, 0xbf, 0x80, 0x80, 0x80, 0x80, 0x10, 0x00, 0xbf, 0xbf, 0x80, 0x80, 0x80, 0x30, 0x00, 0xbf, 0xbf, 0x80, 0x80, 0x80, 0x80, 0xdf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x00, 0xdb, 0x80, 0x00, 0x04, 0xaf, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4c, 0xeb, 0xf7, 0x14, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x20, 0x00, 0x9f, 0x9f, 0xe3, 0xbf, 0x9f, 0xef, 0xb3, 0x9f, 0x14, 0x00,
+			0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xab, 0xc3, 0x0c, 0x00, 0x00, 0x44, 0xe3, 0x44, 0x40, 0x58, 0xff, 0x70, 0x20, 0x00, 0x00, 0x00, 0x48, 0xfb, 0x18, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xe7, 0x80, 0x80, 0x80, 0xf3, 0x74, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x80, 0xdb, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x3c, 0xff, 0x20, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x00, 0x38, 0xe3, 0xd7, 0xe3, 0x8f, 0xff, 0x20, 0x00, 0x00, 0x00, 0x04, 0xe3, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x6c, 0xf7, 0x60, 0x80, 0xe3, 0x60, 0x60, 0x0c, 0x00,
+			0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xab, 0xd7, 0x14, 0x00, 0x00, 0x00, 0x48, 0xbf, 0xbf, 0xbf, 0xc7, 0xff, 0xcf, 0x60, 0x00, 0x00, 0x00, 0xa7, 0xab, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x00, 0x08, 0xeb, 0xb3, 0x9f, 0x9f, 0x9f, 0xbf, 0xd3, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x64, 0xff, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00,
+			0x9f, 0xdb, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x00, 0x00, 0x08, 0x20, 0x10, 0x20, 0xff, 0x20, 0x00, 0x00, 0x00, 0x08, 0xef, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x28, 0x00, 0x00, 0x48, 0xbf, 0x00, 0x68, 0x9f, 0x00, 0x00, 0x00, 0x00,
+			0x0c, 0x20, 0x58, 0xff, 0x20, 0x20, 0x04, 0x00, 0x00, 0xab, 0xe7, 0x38, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x40, 0x00, 0x00, 0x00, 0x14, 0xf7, 0x4c, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x50, 0x78, 0x00, 0x00, 0x00, 0x54, 0xf3, 0x08, 0x00, 0x00, 0x00, 0x18, 0xfb, 0x38, 0x00, 0xbf, 0x80, 0x00, 0x04, 0x30, 0xcb, 0xbb, 0x00, 0xbf, 0x80, 0x00, 0x14, 0x34, 0x97,
+			0xfb, 0x48, 0x00, 0x00, 0xbf, 0x8f, 0x20, 0x20, 0x20, 0x20, 0x0c, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x20, 0x00, 0x00, 0x40, 0x9b, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x87, 0x80, 0x00, 0xa7, 0x60, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x40, 0x00, 0x00, 0x00, 0x6c, 0xe3, 0x04, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x00, 0xb3, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x97, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xef, 0xab, 0x18, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xa3,
+			0x2c, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xbf, 0x18, 0x00, 0x00, 0xbf, 0x9f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0x40, 0x00, 0x00, 0x00, 0x38, 0x80, 0x18, 0x00, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x80, 0x24, 0x00, 0x00, 0x00, 0x08, 0x80, 0x80, 0x00, 0x60, 0x80, 0x10, 0x00, 0x00,
+			0x00, 0x60, 0x40, 0x00, 0x60, 0x80, 0x80, 0x7c, 0x4c, 0x04, 0x00, 0x00, 0x60, 0x80, 0x80, 0x7c, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x68,
+			0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x58, 0x00, 0x40, 0x64, 0x00, 0x00, 0x00, 0x2c, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00, 0x08, 0x7c, 0x2c, 0x00, 0x00, 0x00, 0x20, 0x80, 0x10,
+			0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x68, 0x00, 0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10, 0x00, 0x00, 0x0c, 0xa3, 0xdf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x00, 0x00, 0x40, 0xf3, 0x70, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf7, 0x8b, 0x00, 0x00, 0x00, 0x54, 0xf7, 0xff, 0x00, 0xbf, 0xff, 0x80, 0x00, 0x00,
+			0x00, 0xbf, 0x80, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0xeb, 0xc3, 0x04, 0x00, 0xbf, 0xcf, 0x9f, 0x9f, 0xe7, 0xcf, 0x08, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x9f, 0xdb, 0xdb, 0x9f, 0x9f, 0x9f, 0x00, 0x87,
+			0xcf, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe7, 0x68, 0x00, 0x50, 0xf3, 0x04, 0x00, 0x00, 0x87, 0xf7, 0x64, 0x00, 0x00, 0x20, 0xff, 0x30, 0x00, 0x00, 0x8b, 0xcf, 0x04, 0x00, 0x00, 0xbf, 0x9f, 0x00,
+			0x00, 0x00, 0x60, 0xeb, 0x14, 0x00, 0x00, 0x20, 0xf3, 0x4c, 0x00, 0x28, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xdb, 0xf7, 0x14, 0x00, 0x00, 0x74, 0xc7, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x00, 0x54, 0xf7, 0x5c, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xab, 0xe7, 0x04, 0x00, 0x00, 0xb3, 0xa3, 0xff, 0x00, 0xbf, 0xbf, 0xf7, 0x18, 0x00,
+			0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x24, 0xff, 0x4c, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x20, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x24,
+			0xff, 0x30, 0x00, 0x00, 0x00, 0x4c, 0xf7, 0x10, 0x00, 0x10, 0xff, 0x38, 0x00, 0x00, 0xc7, 0x9f, 0x9f, 0x00, 0x00, 0x60, 0xef, 0x00, 0x00, 0x00, 0x08, 0xd7, 0x80, 0x00, 0x6c, 0xe3, 0x10, 0x00,
+			0x00, 0x00, 0x00, 0xb3, 0xab, 0x00, 0x00, 0xbf, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xf3, 0x60, 0x00, 0x00, 0x18, 0xab, 0xab, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x58, 0xf7, 0x54, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0xcb, 0x4c, 0x00, 0x1c, 0xf3, 0x4c, 0xff, 0x00, 0xbf, 0x80, 0xbb, 0x8f, 0x00,
+			0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xc3, 0x8f, 0x00, 0x00, 0x00, 0xab, 0xa7, 0x00, 0x00, 0x00, 0xcf, 0x78, 0x00, 0x0c, 0xf3, 0x30, 0xdf, 0x00, 0x00, 0x9f, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x50, 0xf3, 0x4c, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x14, 0xeb, 0x60, 0x6c, 0xe3, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xdf, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0xe7, 0xe7, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0xd7, 0xf3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x6c, 0xab, 0x00, 0x78, 0xa3, 0x40, 0xff, 0x00, 0xbf, 0x80, 0x30, 0xfb, 0x24,
+			0x00, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x60, 0xff, 0x34, 0x00, 0xbf, 0x80, 0x00, 0x18, 0x80, 0xf7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x60, 0xeb, 0x04, 0x00, 0x14, 0xf7, 0x44, 0x00, 0x00, 0x00, 0x8f, 0xb7, 0x00, 0x48, 0xc7, 0x00, 0xe7, 0x20, 0x00, 0xd7, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0x9f, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x54, 0xef, 0xf3, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xbb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0xd7, 0xfb, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x14, 0xef, 0x14, 0xd7, 0x44, 0x40, 0xff, 0x00, 0xbf, 0x80, 0x00, 0xab, 0x9f,
+			0x00, 0xbf, 0x80, 0x00, 0xbf, 0xef, 0xdf, 0xe3, 0xf7, 0x83, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x0c, 0xf3, 0x50, 0x00, 0x6c, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf3, 0x04, 0x87, 0x87, 0x00, 0xa7, 0x60, 0x18, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0x8b, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xdf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x70, 0xfb, 0x54, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0xab, 0xa3, 0xe3, 0x00, 0x40, 0xff, 0x00, 0xbf, 0x80, 0x00, 0x24, 0xfb,
+			0x30, 0xbf, 0x80, 0x00, 0xbf, 0x9f, 0x40, 0x28, 0x0c, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x0c, 0xa7, 0xcf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x9f, 0xaf, 0x00, 0xcb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0x38, 0xc7, 0x48, 0x00, 0x68, 0x9f, 0x58, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf3, 0x58, 0xf7, 0x38, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x00, 0x70, 0xfb, 0x54, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x4c, 0xff, 0x80, 0x00, 0x40, 0xff, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x9b,
+			0xaf, 0xbf, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x10, 0xe7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x3c, 0xfb, 0x40, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x83, 0xf7, 0x0c, 0x00, 0x2c, 0xdf, 0x97, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe3, 0x6c, 0x00, 0x8b, 0xcf, 0x04, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x00, 0x00, 0x70, 0xfb, 0x54, 0x00, 0x00, 0xbf, 0x8f, 0x20, 0x20, 0x20, 0x20, 0x04, 0x00, 0xbf, 0x80, 0x00, 0x04, 0x20, 0x08, 0x00, 0x40, 0xff, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x18,
+			0xf7, 0xef, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x70, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xd7, 0xe7, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xef, 0xc7, 0x00, 0x00, 0x00, 0xef, 0xeb, 0x70, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xbf, 0x00, 0x00, 0x08, 0xd7, 0x80, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe7, 0x9f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0c, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xbf, 0x80, 0x00, 0x00, 0x00, 0x70, 0xfb, 0x54, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00,
+			0x8b, 0xff, 0x80, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x08, 0xeb, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x78, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x87, 0x00, 0x00, 0x00, 0xaf, 0xff, 0x30, 0x00, 0x00, 0x00, 0x4c, 0xf7, 0x20, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x30,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xc3, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x54, 0x00, 0xc3, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x54, 0x00, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+			0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xa7, 0x00, 0x00, 0x00, 0x24, 0x40, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x34, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x34, 0x40, 0x10, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x08, 0x3c, 0x3c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x40, 0x38, 0x08, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x30, 0x38, 0x00, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x14, 0x40, 0x20, 0x00, 0x00, 0x2c, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3c, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xc3, 0x00, 0x00, 0xab, 0xd7, 0xbf, 0xdb, 0xd3, 0x18, 0x00, 0x00, 0x28, 0xdb, 0xd7, 0xbf, 0xe3, 0x58, 0x00, 0x00, 0x28, 0xdb, 0xd3, 0xc3, 0xef, 0x54,
+			0x00, 0x00, 0x00, 0x3c, 0xeb, 0xcb, 0xcf, 0xe7, 0x38, 0x00, 0x00, 0x04, 0xb7, 0xdf, 0xbf, 0xcb, 0xb7, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+			0x74, 0xcf, 0xef, 0x58, 0x00, 0x70, 0xf3, 0xc7, 0x6c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xa7, 0xd7, 0xc3, 0xf7, 0x54, 0xa7, 0xcb, 0xd7, 0xd7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x14, 0x40, 0x24, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x08, 0x20, 0x08, 0x00, 0xbf, 0x60, 0x00, 0x14, 0xc7, 0x74, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa7, 0x93, 0x00, 0x00, 0xdb, 0x93, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xd7, 0x78, 0x00, 0x00, 0x40, 0xef,
+			0x0c, 0x00, 0x04, 0xe3, 0x80, 0x00, 0x00, 0x87, 0xdb, 0x00, 0x00, 0x38, 0xeb, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x0c, 0x60, 0xbb, 0xf7,
+			0xaf, 0x50, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x5c, 0xb7, 0xf7, 0xaf, 0x54, 0x08, 0x00, 0x00, 0xdf, 0xc3, 0x08, 0x00, 0x78, 0xf7, 0x64, 0x00, 0x04, 0xd7, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x9f, 0xd7, 0xbf, 0xf7, 0x7c, 0x00, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0x18, 0xc3, 0x9f, 0x04, 0x00, 0xbf, 0x60, 0x00, 0x78, 0xef, 0xd7, 0xbf, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4c, 0x7c, 0x80, 0xaf, 0xbf, 0x00, 0x30, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0x28, 0x20, 0x24, 0x40, 0xeb,
+			0x40, 0x00, 0x34, 0xff, 0x0c, 0x00, 0x00, 0x18, 0xff, 0x2c, 0x00, 0x24, 0xf7, 0x78, 0x28, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0x70, 0xf7, 0xbb, 0x64, 0x0c,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x70, 0xc7, 0xef, 0x58, 0x00, 0xdf, 0x68, 0x00, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0xc7, 0x08, 0x00, 0x4c, 0xf7, 0x08, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0x60, 0x24, 0xd7, 0x80, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x64, 0x9f, 0x9f, 0xab,
+			0xff, 0x9f, 0x9f, 0x9f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc7, 0x80, 0x60, 0x9b, 0xbf, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+			0x30, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x44, 0xbb, 0xf3, 0xe3, 0x60, 0x00, 0x00, 0xdf, 0x40, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0x5c, 0xdb, 0xe3, 0x83, 0x2c,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x8f, 0xe7, 0xcf, 0x48, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x68, 0x00, 0x00, 0x08, 0xff, 0x20, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0x97, 0xe3, 0x64, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x50, 0x80, 0x80, 0x8f,
+			0xff, 0x80, 0x80, 0x80, 0x40, 0x00, 0x50, 0x8b, 0x00, 0x30, 0xff, 0x08, 0x00, 0x00, 0x7c, 0xbf, 0x00, 0x2c, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x30, 0xff, 0x14, 0x00, 0x00, 0x20, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68, 0xfb, 0x14, 0x00, 0xdf, 0x48, 0x00, 0x00, 0x2c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x93, 0xeb,
+			0xcf, 0x78, 0x1c, 0x00, 0x00, 0x00, 0x24, 0x83, 0xdb, 0xe3, 0x8b, 0x30, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0xe7, 0xd3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xcf, 0x00, 0x28, 0xff, 0x2c, 0x00, 0x1c, 0xe3, 0xbf, 0x00, 0x00, 0xcb, 0x9f, 0x04, 0x00, 0x08, 0x1c, 0x00, 0x00, 0xcb, 0x9f, 0x08, 0x00, 0x00, 0x38,
+			0x00, 0x00, 0x00, 0xdb, 0x97, 0x00, 0x00, 0x9b, 0xcf, 0x00, 0x00, 0x18, 0x1c, 0x00, 0x00, 0x38, 0xfb, 0x14, 0x00, 0xb7, 0x97, 0x00, 0x04, 0x9f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+			0x50, 0xab, 0xf7, 0x6c, 0x00, 0x8b, 0xf3, 0xa3, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0x64, 0xa3, 0xd7, 0x18, 0x00, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x54, 0x00, 0x00, 0x97, 0xf7, 0xcb, 0xdb, 0x93, 0xbf, 0x00, 0x00, 0x20, 0xcb, 0xef, 0xd3, 0xeb, 0x4c, 0x00, 0x00, 0x18, 0xbf, 0xef, 0xcf, 0xeb, 0xd3,
+			0x00, 0x00, 0x00, 0x28, 0xdb, 0xe3, 0xe3, 0xd7, 0x28, 0x00, 0x00, 0x30, 0xf3, 0xdf, 0xcb, 0xef, 0x6c, 0x00, 0x00, 0x34, 0xef, 0xe7, 0xe7, 0x83, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x10, 0x28, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0x8f, 0xd7, 0x18, 0x00, 0x00, 0xbf, 0x60, 0x00, 0x00, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x14, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xbf, 0x60, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x8f, 0xd7, 0x18, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x44, 0xdf, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x1c, 0x0c, 0x14, 0x40, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x14, 0x40, 0x18, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x10, 0x18, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x04,
+			0x20, 0x04, 0x00, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x08, 0x20, 0x04, 0x00, 0x08, 0x20, 0x20, 0x20, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x14, 0x64, 0x00, 0x00, 0x00, 0x00, 0x60, 0xa7, 0x00, 0x60,
+			0x30, 0x30, 0x60, 0x00, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x50, 0x8b, 0x00, 0x8b, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x70, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x48, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x20, 0x20, 0x00, 0x00, 0x64, 0x78, 0x00, 0x1c, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x8b, 0x00, 0x00,
+			0xdf, 0x9f, 0xd7, 0xbf, 0xf7, 0x7c, 0x00, 0x00, 0xdf, 0xab, 0xdf, 0xc3, 0x58, 0x00, 0x64, 0xdb, 0x00, 0x00, 0x00, 0x28, 0xfb, 0x18, 0x00, 0x48, 0xdf, 0x00, 0x00, 0x87, 0xff, 0x28, 0x00, 0x40,
+			0xef, 0x00, 0x00, 0x10, 0xdf, 0x70, 0x00, 0x00, 0xaf, 0xaf, 0x00, 0x00, 0x38, 0xdf, 0xdf, 0xdf, 0xe3, 0xff, 0x40, 0x00, 0x30, 0x20, 0x20, 0x9f, 0x00, 0x50, 0x00, 0x00, 0x70, 0xc3, 0x00, 0xbf,
+			0x60, 0x60, 0xbf, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x00, 0x30, 0xf3, 0xbf, 0xe7, 0x28, 0x00, 0x00, 0x00, 0x83, 0xcf, 0x00, 0x14, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x00, 0x34, 0xbb,
+			0xff, 0xef, 0x9f, 0x4c, 0x30, 0x80, 0x78, 0x00, 0x30, 0xdb, 0x18, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0x00, 0x00, 0x9f, 0xbf, 0x00, 0x04, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x14, 0x00, 0x00,
+			0xdf, 0xc7, 0x08, 0x00, 0x4c, 0xf7, 0x08, 0x00, 0xdf, 0xd3, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0xf7, 0x38, 0x00, 0x00, 0x87, 0xb3, 0x00, 0x00, 0x0c, 0xfb, 0x20, 0x00, 0xc7, 0xcf, 0x70, 0x00, 0x80,
+			0xa7, 0x00, 0x00, 0x00, 0x34, 0xf7, 0x34, 0x70, 0xdf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xc3, 0x08, 0x00, 0x28, 0xa7, 0x93, 0xc3, 0xaf, 0x6c, 0x04, 0x00, 0x00, 0x00, 0x00, 0xbf,
+			0x60, 0x60, 0xbf, 0x00, 0xbf, 0x60, 0x00, 0x00, 0x28, 0xe3, 0x68, 0x00, 0x80, 0xe3, 0x18, 0x00, 0x00, 0xbf, 0x54, 0x00, 0x3c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x00, 0x80, 0x50,
+			0x08, 0x28, 0x83, 0xcf, 0xd7, 0x8f, 0x10, 0x00, 0x00, 0x48, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x68, 0x00, 0x00, 0x08, 0xff, 0x20, 0x00, 0xdf, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x97, 0x00, 0x04, 0xe3, 0x54, 0x00, 0x00, 0x00, 0xc7, 0x68, 0x10, 0xf3, 0x5c, 0xaf, 0x00, 0xc3,
+			0x68, 0x00, 0x00, 0x00, 0x00, 0x70, 0xe3, 0xf7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xdb, 0x18, 0x00, 0x00, 0x00, 0x18, 0xbb, 0xf7, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+			0x60, 0x60, 0xbf, 0x00, 0xbf, 0x60, 0x00, 0x28, 0xdb, 0x54, 0x00, 0x00, 0x00, 0x68, 0xd3, 0x18, 0x00, 0x70, 0x00, 0x00, 0x78, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x60, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xef, 0x08, 0x48, 0xeb, 0x08, 0x00, 0x00, 0x00, 0x80, 0xa7, 0x50, 0xb7, 0x10, 0xf3, 0x10, 0xfb,
+			0x24, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf7, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xeb, 0x28, 0x00, 0x00, 0x00, 0x50, 0xb3, 0x44, 0xa3, 0x6c, 0xb3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x58, 0xa3, 0x93, 0x00, 0x00, 0x00, 0x00, 0x40, 0xeb, 0x97, 0x70, 0x00, 0xcf, 0x80, 0xdf,
+			0x00, 0x00, 0x00, 0x00, 0x04, 0xc3, 0xa3, 0xe3, 0x68, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf7, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x9f, 0x00, 0x08, 0x00, 0x00, 0x50, 0x8b, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xc3, 0xf7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf7, 0xf3, 0x30, 0x00, 0x87, 0xef, 0x9f,
+			0x00, 0x00, 0x00, 0x00, 0x80, 0xd3, 0x08, 0x3c, 0xf3, 0x30, 0x00, 0x00, 0x28, 0xeb, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00, 0x80, 0xdf, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0xdf, 0x60, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xe7, 0x00, 0x00, 0x48, 0xff, 0x5c,
+			0x00, 0x00, 0x00, 0x44, 0xef, 0x2c, 0x00, 0x00, 0x78, 0xdb, 0x0c, 0x00, 0x80, 0xfb, 0xdf, 0xdf, 0xdf, 0xdf, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+		}};
+	}
+}
\ No newline at end of file
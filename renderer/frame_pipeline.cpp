@@ -0,0 +1,54 @@
+#include "frame_pipeline.hpp"
+
+namespace rendering
+{
+	draw_list& frame_pipeline::record()
+	{
+		auto& list = _buffers[_back];
+		list.begin();
+		return list;
+	}
+
+	void frame_pipeline::publish()
+	{
+		if (const auto dropped = _buffers[_back].stats().dropped)
+			_overflowed.fetch_add(dropped, std::memory_order_relaxed);
+
+		// release makes the recorded frame visible to the hook, acquire makes sure the
+		// hook has finished with the buffer we get back before it is recorded into
+		const auto previous = _middle.exchange(_back | fresh, std::memory_order_acq_rel);
+		_back = previous & index_mask;
+
+		_published.fetch_add(1u, std::memory_order_relaxed);
+		if (previous & fresh)
+			_dropped.fetch_add(1u, std::memory_order_relaxed);
+	}
+
+	const draw_list& frame_pipeline::latest()
+	{
+		// never blocks, if the producer has not finished a frame the current one is drawn again
+		if (!(_middle.load(std::memory_order_relaxed) & fresh))
+		{
+			_reused.fetch_add(1u, std::memory_order_relaxed);
+			return _buffers[_front];
+		}
+
+		const auto previous = _middle.exchange(_front, std::memory_order_acq_rel);
+		_front = previous & index_mask;
+
+		_presented.fetch_add(1u, std::memory_order_relaxed);
+		return _buffers[_front];
+	}
+
+	frame_pipeline::statistics frame_pipeline::stats() const
+	{
+		return
+		{
+			_published.load(std::memory_order_relaxed),
+			_presented.load(std::memory_order_relaxed),
+			_dropped.load(std::memory_order_relaxed),
+			_reused.load(std::memory_order_relaxed),
+			_overflowed.load(std::memory_order_relaxed)
+		};
+	}
+}
\ No newline at end of file
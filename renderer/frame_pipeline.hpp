@@ -0,0 +1,53 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "draw_list.hpp"
+
+namespace rendering
+{
+	// triple buffered frames between one producer thread and the present hook. the producer
+	// records into the back buffer while the hook draws the front one, and the most recently
+	// completed frame waits in the middle. buffers change hands with one atomic exchange
+	class frame_pipeline
+	{
+	public:
+		struct statistics
+		{
+			std::size_t published;
+			std::size_t presented;
+			// completed frames replaced by a newer one before the hook saw them
+			std::size_t dropped;
+			// hook calls that found nothing new and drew the last frame again
+			std::size_t reused;
+			// primitives published frames could not hold, see draw_list::statistics
+			std::size_t overflowed;
+		};
+
+		// producer thread, the returned list is cleared and stays valid until publish()
+		draw_list& record();
+		void publish();
+
+		// present hook, the returned list stays valid until the next call
+		const draw_list& latest();
+
+		// safe to call from either thread
+		statistics stats() const;
+	private:
+		// the middle buffer index and whether it holds a frame the hook has not taken yet
+		static constexpr std::uint32_t index_mask = 3u;
+		static constexpr std::uint32_t fresh = 4u;
+
+		std::array<draw_list, 3> _buffers { };
+		std::atomic<std::uint32_t> _middle { 1u };
+		std::uint32_t _back { 0u };
+		std::uint32_t _front { 2u };
+
+		std::atomic<std::size_t> _published { };
+		std::atomic<std::size_t> _presented { };
+		std::atomic<std::size_t> _dropped { };
+		std::atomic<std::size_t> _reused { };
+		std::atomic<std::size_t> _overflowed { };
+	};
+}
\ No newline at end of file
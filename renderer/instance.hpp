@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include "types.hpp"
+
+namespace rendering
+{
+	// keep in sync with instanced_vertex.hlsl
+	enum class shape_type : std::uint32_t
+	{
+		filled_box,
+		box,
+		line,
+		circle,
+		none
+	};
+
+	constexpr auto circle_segments = 48u;
+
+	// one record per shape, expanded into triangles by the instanced vertex shader
+	struct instance
+	{
+		vec2 a;
+		vec2 b;
+		float thickness;
+		std::uint32_t colour;
+		shape_type type;
+	};
+	static_assert(sizeof(instance) == 28);
+
+	constexpr std::uint32_t vertices_per_instance(shape_type type)
+	{
+		switch (type)
+		{
+		case shape_type::filled_box:
+		case shape_type::line:
+			return 6u;
+		case shape_type::box:
+			return 6u * 4u;
+		case shape_type::circle:
+			return 6u * circle_segments;
+		default:
+			return 0u;
+		}
+	}
+
+	// a is the top left corner, b the dimensions
+	inline instance make_filled_box(vec2 pos, vec2 dimensions, colour colour)
+	{
+		return { pos, dimensions, 0.f, pack(colour), shape_type::filled_box };
+	}
+
+	// the outline is drawn inside the rect
+	inline instance make_box(vec2 pos, vec2 dimensions, float thickness, colour colour)
+	{
+		return { pos, dimensions, thickness, pack(colour), shape_type::box };
+	}
+
+	inline instance make_line(vec2 start, vec2 end, float thickness, colour colour)
+	{
+		return { start, end, thickness, pack(colour), shape_type::line };
+	}
+
+	// b.x is the radius, a thickness of 0 fills the circle
+	inline instance make_circle(vec2 pos, float radius, float thickness, colour colour)
+	{
+		return { pos, { radius, 0.f }, thickness, pack(colour), shape_type::circle };
+	}
+}
\ No newline at end of file
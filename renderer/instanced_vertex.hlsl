@@ -0,0 +1,95 @@
+cbuffer projection_buffer : register(b0)
+{
+	float4x4 projection;
+};
+
+// keep in sync with rendering::shape_type and rendering::circle_segments
+static const uint shape_filled_box = 0;
+static const uint shape_box = 1;
+static const uint shape_line = 2;
+static const uint shape_circle = 3;
+static const uint circle_segments = 48;
+static const float pi = 3.14159265359f;
+
+// two triangles with the same winding as renderer::draw_filled_box
+static const float2 corners[6] =
+{
+	float2(0.f, 0.f), float2(1.f, 0.f), float2(0.f, 1.f),
+	float2(0.f, 1.f), float2(1.f, 0.f), float2(1.f, 1.f)
+};
+
+struct instance
+{
+	float2 a : A;
+	float2 b : B;
+	float thickness : THICKNESS;
+	float4 colour : COLOUR;
+	uint type : TYPE;
+};
+
+struct vs_output
+{
+	float4 position : SV_POSITION;
+	float4 colour : COLOUR;
+};
+
+vs_output main(instance i, uint id : SV_VertexID)
+{
+	const float2 corner = corners[id % 6];
+	const uint part = id / 6;
+	float2 position;
+
+	if (i.type == shape_filled_box)
+	{
+		position = i.a + corner * i.b;
+	}
+	else if (i.type == shape_box)
+	{
+		// one quad per edge, inside the rect
+		const float t = i.thickness;
+		float2 origin;
+		float2 size;
+		if (part == 0)
+		{
+			origin = i.a;
+			size = float2(i.b.x, t);
+		}
+		else if (part == 1)
+		{
+			origin = i.a + float2(0.f, i.b.y - t);
+			size = float2(i.b.x, t);
+		}
+		else if (part == 2)
+		{
+			origin = i.a + float2(0.f, t);
+			size = float2(t, i.b.y - 2.f * t);
+		}
+		else
+		{
+			origin = i.a + float2(i.b.x - t, t);
+			size = float2(t, i.b.y - 2.f * t);
+		}
+		position = origin + corner * size;
+	}
+	else if (i.type == shape_line)
+	{
+		const float2 delta = i.b - i.a;
+		const float len = length(delta);
+		const float2 direction = len > 0.f ? delta / len : float2(1.f, 0.f);
+		const float2 normal = float2(-direction.y, direction.x) * i.thickness * 0.5f;
+		position = lerp(i.a, i.b, corner.x) + normal * (corner.y * 2.f - 1.f);
+	}
+	else
+	{
+		// ring segment between the outer and inner radius, a thickness of 0 fills it
+		const float radius = i.b.x;
+		const float inner = i.thickness > 0.f ? max(radius - i.thickness, 0.f) : 0.f;
+		const float angle = (part + corner.x) * 2.f * pi / circle_segments;
+		position = i.a + float2(cos(angle), sin(angle)) * lerp(radius, inner, corner.y);
+	}
+
+	vs_output output;
+	output.position = mul(projection, float4(position, 0.f, 1.f));
+	output.colour = i.colour;
+	return output;
+}
\ No newline at end of file
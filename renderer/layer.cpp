@@ -0,0 +1,145 @@
+#include <cstring>
+#include "layer.hpp"
+
+namespace rendering
+{
+	namespace
+	{
+		constexpr std::uint64_t prime = 0x9e3779b97f4a7c15ull;
+
+		std::uint64_t mix(std::uint64_t value, std::uint64_t word)
+		{
+			value = (value ^ word) * prime;
+			return value ^ (value >> 29);
+		}
+
+		// multiply-xor over 8 byte words, collisions only cost a missed upload of equal-looking
+		// content. only for types without padding, whose bytes are all their value
+		std::uint64_t hash(const void* data, std::size_t size, std::uint64_t seed)
+		{
+			const auto bytes = static_cast<const std::uint8_t*>(data);
+
+			auto value = seed ^ (size * prime);
+			auto i = 0ull;
+			for (; i + 8 <= size; i += 8)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, bytes + i, 8);
+				value = mix(value, word);
+			}
+			for (; i < size; ++i)
+				value = (value ^ bytes[i]) * prime;
+			return value;
+		}
+
+		// batches have padding after sort_layer, so they go field by field
+		std::uint64_t hash(const batch* batches, std::size_t count, std::uint64_t seed)
+		{
+			auto value = seed ^ (count * prime);
+			for (auto i = 0ull; i < count; ++i)
+			{
+				const auto& batch = batches[i];
+				value = mix(value, batch.count);
+				value = mix(value, static_cast<std::uint64_t>(batch.topology) | static_cast<std::uint64_t>(batch.shape) << 32);
+				value = mix(value, batch.sort_layer);
+			}
+			return value;
+		}
+
+		// vertices and instances are hashed as bytes
+		static_assert(sizeof(vertex) == sizeof(vertex::pos) + sizeof(vertex::colour));
+		static_assert(sizeof(instance) == sizeof(instance::a) + sizeof(instance::b) + sizeof(instance::thickness) + sizeof(instance::colour) + sizeof(instance::type));
+	}
+
+	draw_list& layer::record()
+	{
+		_recorded = true;
+		_list.begin();
+		return _list;
+	}
+
+	void layer::invalidate()
+	{
+		_dirty = true;
+	}
+
+	void layer::release()
+	{
+		_vertex_buffer.release();
+		_index_buffer.release();
+		_instance_buffer.release();
+	}
+
+	std::size_t layer::upload(ID3D11Device* device, ID3D11DeviceContext* device_context)
+	{
+		if (!_vertex_buffer.buffer())
+		{
+			// sized for a full list so an upload always fits without growing
+			_vertex_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(vertex), max_vertices);
+			_index_buffer.create(device, D3D11_BIND_INDEX_BUFFER, sizeof(std::uint16_t), max_indices);
+			if constexpr (default_config::instancing)
+				_instance_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(instance), default_config::max_instances);
+			_dirty = true;
+		}
+
+		if (_recorded)
+		{
+			_recorded = false;
+
+			auto value = static_cast<std::uint64_t>(_list.block_count());
+			for (auto i = 0ull; i < _list.block_count(); ++i)
+			{
+				value = hash(_list.vertices(i), _list.vertex_count(i) * sizeof(vertex), value);
+				value = hash(_list.indices(i), _list.index_count(i) * sizeof(std::uint16_t), value);
+				value = hash(_list.instances(i), _list.instance_count(i) * sizeof(instance), value);
+				value = hash(_list.batches(i), _list.batch_count(i), value);
+			}
+
+			if (value != _hash)
+			{
+				_hash = value;
+				_dirty = true;
+			}
+		}
+
+		if (!_dirty)
+			return 0u;
+
+		std::size_t vertex_count = 0u, index_count = 0u, instance_count = 0u;
+		for (auto i = 0ull; i < _list.block_count(); ++i)
+		{
+			vertex_count += _list.vertex_count(i);
+			index_count += _list.index_count(i);
+			instance_count += _list.instance_count(i);
+		}
+
+		// a list that chained blocks can outgrow the buffers, which then have to hold all of
+		// it at once. every upload starts over at the front so no block wraps over another
+		const auto sized = _vertex_buffer.grow(device, static_cast<UINT>(vertex_count))
+			&& _index_buffer.grow(device, static_cast<UINT>(index_count))
+			&& (!default_config::instancing || _instance_buffer.grow(device, static_cast<UINT>(instance_count)));
+		if (!sized)
+			return 0u;
+
+		_vertex_buffer.rewind();
+		_index_buffer.rewind();
+		_instance_buffer.rewind();
+
+		auto uploaded = true;
+		for (auto i = 0ull; i < _list.block_count() && uploaded; ++i)
+		{
+			uploaded = (_list.vertex_count(i) == 0
+					|| (_vertex_buffer.upload(device_context, _list.vertices(i), static_cast<UINT>(_list.vertex_count(i)), _base_vertex[i])
+					&& _index_buffer.upload(device_context, _list.indices(i), static_cast<UINT>(_list.index_count(i)), _start_index[i])))
+				&& (_list.instance_count(i) == 0
+					|| _instance_buffer.upload(device_context, _list.instances(i), static_cast<UINT>(_list.instance_count(i)), _start_instance[i]));
+		}
+
+		// try again next frame
+		if (!uploaded)
+			return 0u;
+
+		_dirty = false;
+		return vertex_count * sizeof(vertex) + index_count * sizeof(std::uint16_t) + instance_count * sizeof(instance);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <d3d11.h>
+#include "draw_list.hpp"
+#include "ring_buffer.hpp"
+
+namespace rendering
+{
+	// geometry that is recorded once and kept in its own gpu buffers. it is uploaded again
+	// only when its content changes, so re-recording an identical layer costs a hash but
+	// no upload. like draw_list it is meant to live in static storage
+	class layer
+	{
+		template<typename Config>
+		friend class basic_renderer;
+	public:
+		// clears the layer for recording, the new content is compared when it is next drawn
+		draw_list& record();
+		// uploads on the next draw even if the content looks unchanged
+		void invalidate();
+		void release();
+	private:
+		// returns the bytes uploaded, 0 if the gpu copy was still current
+		std::size_t upload(ID3D11Device* device, ID3D11DeviceContext* device_context);
+
+		// zero initialised like draw_list, so a layer is empty wherever it lives
+		draw_list _list;
+		ring_buffer _vertex_buffer { };
+		ring_buffer _index_buffer { };
+		ring_buffer _instance_buffer { };
+		// where each block of the list starts in the buffers
+		std::array<UINT, draw_list::max_blocks> _base_vertex { };
+		std::array<UINT, draw_list::max_blocks> _start_index { };
+		std::array<UINT, draw_list::max_blocks> _start_instance { };
+		std::uint64_t _hash { };
+		bool _recorded { };
+		bool _dirty { };
+	};
+}
\ No newline at end of file
@@ -1,48 +1,382 @@
+#include <bit>
 #include <cstdint>
-#include <cstring>
+#include <intrin.h>
 #include "memory_manager.hpp"
 
 namespace memory
 {
+	// two-level segregated fit allocator. the first level splits block sizes
+	// by power of two, the second level splits every power of two into
+	// sl_count linear ranges. both levels are tracked in bitmaps so finding
+	// a free list that fits is two bit scans, making alloc and free O(1).
+	constexpr std::size_t align_log2 = 4;
+	constexpr std::size_t alignment = 1ull << align_log2;
+	constexpr std::size_t sl_count_log2 = 4;
+	constexpr std::size_t sl_count = 1ull << sl_count_log2;
+	constexpr std::size_t fl_shift = sl_count_log2 + align_log2;
+	constexpr std::size_t small_block_size = 1ull << fl_shift;
+	constexpr std::size_t fl_count = std::bit_width(static_cast<std::size_t>(buffer_size)) - fl_shift + 1;
+
+	constexpr std::size_t block_free = 1ull << 0;
+	constexpr std::size_t block_prev_free = 1ull << 1;
+	constexpr std::size_t block_flags = block_free | block_prev_free;
+
 	struct block
 	{
+		block* prev_physical;
 		std::size_t size;
-		block* next;
+
+		// only valid while the block is free, overlaps the payload otherwise
+		block* next_free;
+		block* prev_free;
+
+		std::size_t get_size() const { return size & ~block_flags; }
+		void set_size(std::size_t new_size) { size = new_size | (size & block_flags); }
+		bool is_free() const { return size & block_free; }
+		bool is_prev_free() const { return size & block_prev_free; }
+		void set_free(bool free) { size = free ? size | block_free : size & ~block_free; }
+		void set_prev_free(bool free) { size = free ? size | block_prev_free : size & ~block_prev_free; }
+
+		void* payload() { return reinterpret_cast<std::uint8_t*>(this) + header_size(); }
+		block* next_physical() { return reinterpret_cast<block*>(reinterpret_cast<std::uint8_t*>(payload()) + get_size()); }
+
+		static constexpr std::size_t header_size() { return sizeof(block*) + sizeof(std::size_t); }
+		static constexpr std::size_t min_size() { return sizeof(block) - header_size(); }
+		static block* from_payload(void* data) { return reinterpret_cast<block*>(reinterpret_cast<std::uint8_t*>(data) - header_size()); }
 	};
+	static_assert(block::header_size() % alignment == 0);
+
+	alignas(alignment) std::uint8_t buffer[buffer_size];
+
+	// the dll has no entry point so nothing here can rely on static initialisation
+	struct control
+	{
+		bool initialised;
+		std::uint32_t fl_bitmap;
+		std::uint32_t sl_bitmap[fl_count];
+		block* free_lists[fl_count][sl_count];
+		statistics stats;
+	} heap;
+
+	void mapping(std::size_t size, std::size_t& fl, std::size_t& sl)
+	{
+		if (size < small_block_size)
+		{
+			fl = 0;
+			sl = size >> align_log2;
+		}
+		else
+		{
+			fl = std::bit_width(size) - 1;
+			sl = (size >> (fl - sl_count_log2)) ^ sl_count;
+			fl -= fl_shift - 1;
+		}
+	}
+
+	// round up to the next list so any block found is guaranteed to fit
+	void mapping_search(std::size_t size, std::size_t& fl, std::size_t& sl)
+	{
+		if (size >= small_block_size)
+			size += (1ull << (std::bit_width(size) - 1 - sl_count_log2)) - 1;
+		mapping(size, fl, sl);
+	}
+
+	block* find_suitable(std::size_t& fl, std::size_t& sl)
+	{
+		if (fl >= fl_count)
+			return nullptr;
+
+		auto sl_map = heap.sl_bitmap[fl] & (~0u << sl);
+		if (!sl_map)
+		{
+			const auto fl_map = fl + 1 < 32 ? heap.fl_bitmap & (~0u << (fl + 1)) : 0u;
+			if (!fl_map)
+				return nullptr;
+
+			fl = std::countr_zero(fl_map);
+			sl_map = heap.sl_bitmap[fl];
+		}
+
+		sl = std::countr_zero(sl_map);
+		return heap.free_lists[fl][sl];
+	}
+
+	void insert_free(block* current)
+	{
+		std::size_t fl, sl;
+		mapping(current->get_size(), fl, sl);
+
+		auto& head = heap.free_lists[fl][sl];
+		current->prev_free = nullptr;
+		current->next_free = head;
+		if (head)
+			head->prev_free = current;
+		head = current;
+
+		heap.fl_bitmap |= 1u << fl;
+		heap.sl_bitmap[fl] |= 1u << sl;
+
+		heap.stats.free += current->get_size();
+		++heap.stats.free_blocks;
+	}
+
+	void remove_free(block* current)
+	{
+		std::size_t fl, sl;
+		mapping(current->get_size(), fl, sl);
+
+		if (current->prev_free)
+			current->prev_free->next_free = current->next_free;
+		else
+			heap.free_lists[fl][sl] = current->next_free;
+
+		if (current->next_free)
+			current->next_free->prev_free = current->prev_free;
+
+		if (!heap.free_lists[fl][sl])
+		{
+			heap.sl_bitmap[fl] &= ~(1u << sl);
+			if (!heap.sl_bitmap[fl])
+				heap.fl_bitmap &= ~(1u << fl);
+		}
+
+		heap.stats.free -= current->get_size();
+		--heap.stats.free_blocks;
+	}
+
+	void mark_free(block* current)
+	{
+		current->set_free(true);
+		auto next = current->next_physical();
+		next->prev_physical = current;
+		next->set_prev_free(true);
+	}
+
+	void mark_used(block* current)
+	{
+		current->set_free(false);
+		current->next_physical()->set_prev_free(false);
+	}
+
+	void initialise()
+	{
+		heap.initialised = true;
+
+		// one free block spanning the buffer followed by a zero sized, used sentinel
+		// so the last real block always has a physical neighbour to update
+		auto first = reinterpret_cast<block*>(buffer);
+		first->prev_physical = nullptr;
+		first->size = buffer_size - 2 * block::header_size();
+
+		auto sentinel = first->next_physical();
+		sentinel->size = 0;
+
+		heap.stats.capacity = first->get_size();
+		mark_free(first);
+		insert_free(first);
+	}
+
+	std::size_t round_size(std::size_t size)
+	{
+		size = (size + alignment - 1) & ~(alignment - 1);
+		return size < block::min_size() ? block::min_size() : size;
+	}
+
+	// the free block alloc takes for a rounded size, or nullptr
+	block* search(std::size_t size)
+	{
+		std::size_t fl, sl;
+		mapping_search(size, fl, sl);
+
+		auto current = find_suitable(fl, sl);
+
+		// the rounded search skips the list the size itself maps to, its head may still fit
+		if (!current)
+		{
+			mapping(size, fl, sl);
+			current = fl < fl_count ? heap.free_lists[fl][sl] : nullptr;
+			if (current && current->get_size() < size)
+				current = nullptr;
+		}
 
-	std::uint8_t buffer[buffer_size];
+		return current;
+	}
 
 	void* alloc(std::size_t size)
 	{
 		if (size == 0)
 			return nullptr;
 
-		auto current = reinterpret_cast<block*>(buffer);
+		if (!heap.initialised)
+			initialise();
+
+		++heap.stats.alloc_calls;
+		size = round_size(size);
 
-		while (true)
+		auto current = search(size);
+		if (!current)
 		{
-			if (current->size == 0ull && (!current->next || ((uint64_t)current->next - ((uint64_t)current + sizeof(block))) >= size))
-				break;
-			current = current->next;
+			++heap.stats.failures;
+			return nullptr;
 		}
 
-		if ((uint64_t)current + sizeof(block) + size > (uint64_t)buffer + buffer_size)
-			return nullptr;
+		remove_free(current);
+
+		// split off the tail if it is large enough to hold a block of its own
+		if (current->get_size() >= size + sizeof(block))
+		{
+			auto remaining = reinterpret_cast<block*>(reinterpret_cast<std::uint8_t*>(current->payload()) + size);
+			remaining->size = current->get_size() - size - block::header_size();
+			current->set_size(size);
 
-		current->size = size;
+			remaining->prev_physical = current;
+			mark_free(remaining);
+			insert_free(remaining);
+		}
+
+		mark_used(current);
 
-		auto next = current->next;
-		current->next = reinterpret_cast<block*>((uint64_t)current + sizeof(block) + size);
-		if (!current->next->next)
-			current->next->next = next;
+		heap.stats.used += current->get_size();
+		++heap.stats.allocations;
+		if (heap.stats.used > heap.stats.high_water)
+			heap.stats.high_water = heap.stats.used;
 
-		return reinterpret_cast<void*>((uint64_t)current + sizeof(block));
+		return current->payload();
 	}
 
 	void free(void* data)
 	{
-		auto current = reinterpret_cast<block*>((uint64_t)data - sizeof(block));
-		memset(data, 0, current->size);
-		current->size = 0;
+		if (!data)
+			return;
+
+		auto current = block::from_payload(data);
+		heap.stats.used -= current->get_size();
+		--heap.stats.allocations;
+
+		// coalesce with the free physical neighbours on either side
+		if (current->is_prev_free())
+		{
+			auto prev = current->prev_physical;
+			remove_free(prev);
+			prev->set_size(prev->get_size() + block::header_size() + current->get_size());
+			current = prev;
+		}
+
+		auto next = current->next_physical();
+		if (next->is_free())
+		{
+			remove_free(next);
+			current->set_size(current->get_size() + block::header_size() + next->get_size());
+		}
+
+		mark_free(current);
+		insert_free(current);
+	}
+
+	bool can_alloc(std::size_t size)
+	{
+		if (size == 0)
+			return false;
+
+		if (!heap.initialised)
+			initialise();
+
+		return search(round_size(size)) != nullptr;
+	}
+
+	void out_of_memory()
+	{
+		// FAST_FAIL_FATAL_APP_EXIT, which needs no crt and cannot be caught
+		__fastfail(7u);
+	}
+
+	statistics stats()
+	{
+		if (!heap.initialised)
+			initialise();
+
+		auto result = heap.stats;
+		result.largest_free = 0;
+
+		// the largest free block lives in the highest non-empty list
+		if (heap.fl_bitmap)
+		{
+			const auto fl = std::bit_width(heap.fl_bitmap) - 1;
+			const auto sl = std::bit_width(heap.sl_bitmap[fl]) - 1;
+			for (auto current = heap.free_lists[fl][sl]; current; current = current->next_free)
+				if (current->get_size() > result.largest_free)
+					result.largest_free = current->get_size();
+		}
+
+		return result;
+	}
+
+	namespace frame
+	{
+		static_assert(footprint(1) == alignment);
+		alignas(alignment) std::uint8_t buffer[frame_buffer_size];
+
+		struct control
+		{
+			std::size_t top;
+			statistics stats;
+		} arena;
+
+		bool owns(void* data)
+		{
+			return data >= buffer && data < buffer + frame_buffer_size;
+		}
+
+		void* alloc(std::size_t size)
+		{
+			if (size == 0)
+				return nullptr;
+
+			size = footprint(size);
+			if (size > frame_buffer_size - arena.top)
+			{
+				++arena.stats.overflows;
+				const auto data = memory::alloc(size);
+				if (!data)
+					++arena.stats.failures;
+				return data;
+			}
+
+			auto data = buffer + arena.top;
+			arena.top += size;
+			if (arena.top > arena.stats.high_water)
+				arena.stats.high_water = arena.top;
+
+			return data;
+		}
+
+		void free(void* data)
+		{
+			// arena memory is only released by reset
+			if (data && !owns(data))
+				memory::free(data);
+		}
+
+		void reset()
+		{
+			arena.top = 0;
+		}
+
+		bool can_alloc(std::size_t size)
+		{
+			if (size == 0)
+				return false;
+
+			size = footprint(size);
+			return size <= frame_buffer_size - arena.top || memory::can_alloc(size);
+		}
+
+		statistics stats()
+		{
+			auto result = arena.stats;
+			result.capacity = frame_buffer_size;
+			result.used = arena.top;
+			return result;
+		}
 	}
 }
\ No newline at end of file
@@ -4,8 +4,82 @@
 namespace memory
 {
 	constexpr auto buffer_size = 0x10000;
+	// holds everything the default renderer reserves in a frame, see basic_renderer::frame_storage
+	constexpr auto frame_buffer_size = 0x30000;
 	void* alloc(std::size_t size);
 	void free(void* data);
+	// whether alloc(size) would find a block right now
+	bool can_alloc(std::size_t size);
+
+	struct statistics
+	{
+		std::size_t capacity;
+		std::size_t used;
+		std::size_t high_water;
+		std::size_t free;
+		std::size_t largest_free;
+		std::size_t free_blocks;
+		std::size_t allocations;
+		// every alloc call since start, and those that found no block
+		std::size_t alloc_calls;
+		std::size_t failures;
+
+		// 0 when all free memory is one block, approaching 1 as it is split up
+		float fragmentation() const
+		{
+			return free ? 1.f - static_cast<float>(largest_free) / static_cast<float>(free) : 0.f;
+		}
+	};
+	statistics stats();
+
+	// bump allocator for storage that only lives until the end of a frame.
+	// free is a no-op and reset releases everything at once. requests that
+	// do not fit in frame_buffer_size fall back to the static heap, and
+	// return nullptr if that is full too.
+	namespace frame
+	{
+		void* alloc(std::size_t size);
+		void free(void* data);
+		void reset();
+		// whether alloc(size) would succeed right now, from the arena or the heap
+		bool can_alloc(std::size_t size);
+		// what a request of size takes from the arena, which hands out 16 byte aligned blocks
+		constexpr std::size_t footprint(std::size_t size)
+		{
+			return (size + 15u) & ~static_cast<std::size_t>(15u);
+		}
+
+		struct statistics
+		{
+			std::size_t capacity;
+			std::size_t used;
+			std::size_t high_water;
+			// requests past the arena, and those the heap could not take either
+			std::size_t overflows;
+			std::size_t failures;
+		};
+		statistics stats();
+	}
+
+	// std::vector cannot be handed a nullptr, so the allocators below stop the process
+	// when they run out instead of corrupting memory
+	[[noreturn]] void out_of_memory();
+
+	// grows container to hold count elements if its allocator has room for them, otherwise
+	// leaves it untouched and returns false. anything that may not fit has to grow through
+	// this, so running out costs a dropped draw rather than out_of_memory()
+	template<typename Container>
+	bool reserve(Container& container, std::size_t count)
+	{
+		if (count <= container.capacity())
+			return true;
+
+		if (!Container::allocator_type::can_allocate(count))
+			return false;
+
+		container.reserve(count);
+		return true;
+	}
 
 	template<typename T>
 	class allocator
@@ -17,12 +91,57 @@ namespace memory
 
 		T* allocate(std::size_t size)
 		{
-			return reinterpret_cast<T*>(memory::alloc(size * sizeof(T)));
+			const auto data = memory::alloc(size * sizeof(T));
+			if (!data && size != 0)
+				out_of_memory();
+			return reinterpret_cast<T*>(data);
 		}
 
-		void deallocate(T* ptr, std::size_t size)
+		void deallocate(T* ptr, [[maybe_unused]] std::size_t size)
 		{
 			memory::free(ptr);
 		}
+
+		static bool can_allocate(std::size_t size)
+		{
+			return memory::can_alloc(size * sizeof(T));
+		}
+
+		bool operator==(const allocator&) const
+		{
+			return true;
+		}
+	};
+
+	template<typename T>
+	class frame_allocator
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+		T* allocate(std::size_t size)
+		{
+			const auto data = memory::frame::alloc(size * sizeof(T));
+			if (!data && size != 0)
+				out_of_memory();
+			return reinterpret_cast<T*>(data);
+		}
+
+		void deallocate(T* ptr, [[maybe_unused]] std::size_t size)
+		{
+			memory::frame::free(ptr);
+		}
+
+		static bool can_allocate(std::size_t size)
+		{
+			return memory::frame::can_alloc(size * sizeof(T));
+		}
+
+		bool operator==(const frame_allocator&) const
+		{
+			return true;
+		}
 	};
 }
\ No newline at end of file
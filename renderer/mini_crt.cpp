@@ -1,29 +1,192 @@
-#include <cstddef>
-#include "memory_manager.hpp"
-#pragma optimize( "", off )
+#include <cstdint>
+#include <intrin.h>
+#include "mini_crt.hpp"
+#include "mini_crt_vector.hpp"
+#pragma function(memset, memcpy)
+
+namespace crt
+{
+	// copies at least this large bypass the cache, they would only evict useful lines
+	constexpr std::size_t non_temporal_threshold = 0x40000;
+
+	enum class isa : std::uint8_t
+	{
+		unknown,
+		sse2,
+		avx2
+	};
+
+	isa detected;
+
+	isa detect()
+	{
+		int info[4];
+		__cpuid(info, 0);
+		const auto max_leaf = info[0];
+
+		__cpuid(info, 1);
+		const auto os_xsave = (info[2] & (1 << 27)) != 0;
+		const auto avx = (info[2] & (1 << 28)) != 0;
+
+		auto avx2 = false;
+		if (max_leaf >= 7 && os_xsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+		{
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+
+		return avx2 ? isa::avx2 : isa::sse2;
+	}
+
+	// the dll has no entry point, so the check runs on the first call and is cached
+	isa level()
+	{
+		if (detected == isa::unknown)
+			detected = detect();
+		return detected;
+	}
+
+	template<typename T>
+	T load(const std::uint8_t* src)
+	{
+		return *reinterpret_cast<const T*>(src);
+	}
+
+	template<typename T>
+	void store(std::uint8_t* dest, T value)
+	{
+		*reinterpret_cast<T*>(dest) = value;
+	}
+
+	// copies below one sse register. every load happens before any store so
+	// the head and tail may overlap each other and the source may overlap dest
+	void copy_small(std::uint8_t* dest, const std::uint8_t* src, std::size_t count)
+	{
+		if (count >= 8)
+		{
+			const auto head = load<std::uint64_t>(src);
+			const auto tail = load<std::uint64_t>(src + count - 8);
+			store(dest, head);
+			store(dest + count - 8, tail);
+		}
+		else if (count >= 4)
+		{
+			const auto head = load<std::uint32_t>(src);
+			const auto tail = load<std::uint32_t>(src + count - 4);
+			store(dest, head);
+			store(dest + count - 4, tail);
+		}
+		else if (count >= 2)
+		{
+			const auto head = load<std::uint16_t>(src);
+			const auto tail = load<std::uint16_t>(src + count - 2);
+			store(dest, head);
+			store(dest + count - 2, tail);
+		}
+		else if (count == 1)
+		{
+			*dest = *src;
+		}
+	}
+
+	void set_small(std::uint8_t* dest, std::uint8_t value, std::size_t count)
+	{
+		const auto pattern = value * 0x0101010101010101ull;
+		if (count >= 8)
+		{
+			store(dest, pattern);
+			store(dest + count - 8, pattern);
+		}
+		else if (count >= 4)
+		{
+			store(dest, static_cast<std::uint32_t>(pattern));
+			store(dest + count - 4, static_cast<std::uint32_t>(pattern));
+		}
+		else if (count >= 2)
+		{
+			store(dest, static_cast<std::uint16_t>(pattern));
+			store(dest + count - 2, static_cast<std::uint16_t>(pattern));
+		}
+		else if (count == 1)
+		{
+			*dest = value;
+		}
+	}
+
+	// between one and two sse registers, again loads before stores
+	void copy_medium(std::uint8_t* dest, const std::uint8_t* src, std::size_t count)
+	{
+		const auto head = sse2::load(src);
+		const auto tail = sse2::load(src + count - sse2::size);
+		sse2::store(dest, head);
+		sse2::store(dest + count - sse2::size, tail);
+	}
+
+	template<bool non_temporal>
+	void move(std::uint8_t* dest, const std::uint8_t* src, std::size_t count)
+	{
+		if (count < sse2::size)
+			return copy_small(dest, src, count);
+
+		if (count <= 2 * sse2::size)
+			return copy_medium(dest, src, count);
+
+		const auto backward = dest > src && dest < src + count;
+		if (level() == isa::avx2 && count >= 2 * avx2_size)
+		{
+			if (backward)
+				copy_backward_avx2(dest, src, count);
+			else
+				copy_forward_avx2(dest, src, count, non_temporal);
+		}
+		else
+		{
+			if (backward)
+				copy_backward<sse2>(dest, src, count);
+			else
+				copy_forward<sse2, non_temporal>(dest, src, count);
+		}
+	}
+
+	void* stream_copy(void* dest, const void* src, std::size_t count)
+	{
+		move<true>(reinterpret_cast<std::uint8_t*>(dest), reinterpret_cast<const std::uint8_t*>(src), count);
+		return dest;
+	}
+}
 
 extern "C" void* memset(void* dest, int ch, std::size_t count)
 {
-	for (auto i = 0ull; i < count; ++i)
-		reinterpret_cast<char*>(dest)[i] = ch;
+	using namespace crt;
+
+	auto bytes = reinterpret_cast<std::uint8_t*>(dest);
+	const auto value = static_cast<std::uint8_t>(ch);
+
+	if (count < sse2::size)
+		set_small(bytes, value, count);
+	else if (level() == isa::avx2 && count >= 2 * avx2_size)
+		set_avx2(bytes, value, count, count >= non_temporal_threshold);
+	else
+		count >= non_temporal_threshold ? set<sse2, true>(bytes, value, count) : set<sse2, false>(bytes, value, count);
+
 	return dest;
 }
 
 extern "C" void* memcpy(void* dest, const void* src, std::size_t count)
 {
-	for (auto i = 0ull; i < count; ++i)
-		reinterpret_cast<char*>(dest)[i] = reinterpret_cast<const char*>(src)[i];
+	using namespace crt;
+
+	auto to = reinterpret_cast<std::uint8_t*>(dest);
+	auto from = reinterpret_cast<const std::uint8_t*>(src);
+
+	count >= non_temporal_threshold ? move<true>(to, from, count) : move<false>(to, from, count);
 	return dest;
 }
 
 extern "C" void* memmove(void* dest, const void* src, std::size_t count)
 {
-	auto buf = memory::alloc(count);
-	memcpy(buf, src, count);
-	memcpy(dest, buf, count);
-	return dest;
+	// move already picks the copy direction from the overlap
+	return memcpy(dest, src, count);
 }
 
-namespace std { void _Xlength_error(char const* error) { } }
-
-#pragma optimize( "", on )
\ No newline at end of file
+namespace std { void _Xlength_error(char const* error) { } }
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+#include <cstddef>
+
+namespace crt
+{
+	// copies with non-temporal stores regardless of size. meant for writes into
+	// mapped gpu memory which is write-combined and never read back by the cpu
+	void* stream_copy(void* dest, const void* src, std::size_t count);
+}
\ No newline at end of file
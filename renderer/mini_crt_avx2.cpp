@@ -0,0 +1,38 @@
+#include <cstdint>
+#include <immintrin.h>
+#include "mini_crt_vector.hpp"
+
+// built with avx2 enabled where the compiler needs it, nothing here runs unless mini_crt.cpp
+// found avx2 at runtime
+namespace crt
+{
+	struct avx2
+	{
+		using type = __m256i;
+		static constexpr std::size_t size = sizeof(type);
+
+		static type load(const std::uint8_t* src) { return _mm256_loadu_si256(reinterpret_cast<const type*>(src)); }
+		static void store(std::uint8_t* dest, type value) { _mm256_storeu_si256(reinterpret_cast<type*>(dest), value); }
+		static void store_aligned(std::uint8_t* dest, type value) { _mm256_store_si256(reinterpret_cast<type*>(dest), value); }
+		static void stream(std::uint8_t* dest, type value) { _mm256_stream_si256(reinterpret_cast<type*>(dest), value); }
+		static type broadcast(std::uint8_t value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+		static void finish() { _mm256_zeroupper(); }
+	};
+
+	static_assert(avx2::size == avx2_size);
+
+	void copy_forward_avx2(std::uint8_t* dest, const std::uint8_t* src, std::size_t count, bool non_temporal)
+	{
+		non_temporal ? copy_forward<avx2, true>(dest, src, count) : copy_forward<avx2, false>(dest, src, count);
+	}
+
+	void copy_backward_avx2(std::uint8_t* dest, const std::uint8_t* src, std::size_t count)
+	{
+		copy_backward<avx2>(dest, src, count);
+	}
+
+	void set_avx2(std::uint8_t* dest, std::uint8_t value, std::size_t count, bool non_temporal)
+	{
+		non_temporal ? set<avx2, true>(dest, value, count) : set<avx2, false>(dest, value, count);
+	}
+}
\ No newline at end of file
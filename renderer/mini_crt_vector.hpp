@@ -0,0 +1,133 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// the vector loops behind mini_crt, shared by mini_crt.cpp and mini_crt_avx2.cpp. only the
+// latter is built for avx2, so the sse2 path never picks up vex encoded instructions
+namespace crt
+{
+	struct sse2
+	{
+		using type = __m128i;
+		static constexpr std::size_t size = sizeof(type);
+
+		static type load(const std::uint8_t* src) { return _mm_loadu_si128(reinterpret_cast<const type*>(src)); }
+		static void store(std::uint8_t* dest, type value) { _mm_storeu_si128(reinterpret_cast<type*>(dest), value); }
+		static void store_aligned(std::uint8_t* dest, type value) { _mm_store_si128(reinterpret_cast<type*>(dest), value); }
+		static void stream(std::uint8_t* dest, type value) { _mm_stream_si128(reinterpret_cast<type*>(dest), value); }
+		static type broadcast(std::uint8_t value) { return _mm_set1_epi8(static_cast<char>(value)); }
+		static void finish() { }
+	};
+
+	// count must be at least 2 * V::size. the unaligned head and tail are loaded
+	// up front and stored last so that the aligned body only ever reads source
+	// bytes it has not yet overwritten, which makes this safe when dest < src
+	template<typename V, bool non_temporal>
+	void copy_forward(std::uint8_t* dest, const std::uint8_t* src, std::size_t count)
+	{
+		const auto head = V::load(src);
+		const auto tail = V::load(src + count - V::size);
+
+		auto offset = V::size - (reinterpret_cast<std::uintptr_t>(dest) & (V::size - 1));
+		const auto end = count - V::size;
+
+		for (; offset + 4 * V::size <= end; offset += 4 * V::size)
+		{
+			const auto a = V::load(src + offset);
+			const auto b = V::load(src + offset + V::size);
+			const auto c = V::load(src + offset + 2 * V::size);
+			const auto d = V::load(src + offset + 3 * V::size);
+
+			if constexpr (non_temporal)
+			{
+				V::stream(dest + offset, a);
+				V::stream(dest + offset + V::size, b);
+				V::stream(dest + offset + 2 * V::size, c);
+				V::stream(dest + offset + 3 * V::size, d);
+			}
+			else
+			{
+				V::store_aligned(dest + offset, a);
+				V::store_aligned(dest + offset + V::size, b);
+				V::store_aligned(dest + offset + 2 * V::size, c);
+				V::store_aligned(dest + offset + 3 * V::size, d);
+			}
+		}
+
+		for (; offset < end; offset += V::size)
+		{
+			if constexpr (non_temporal)
+				V::stream(dest + offset, V::load(src + offset));
+			else
+				V::store_aligned(dest + offset, V::load(src + offset));
+		}
+
+		if constexpr (non_temporal)
+			_mm_sfence();
+
+		V::store(dest, head);
+		V::store(dest + count - V::size, tail);
+		V::finish();
+	}
+
+	// mirror of copy_forward for dest > src, walks the aligned body from the end
+	template<typename V>
+	void copy_backward(std::uint8_t* dest, const std::uint8_t* src, std::size_t count)
+	{
+		const auto head = V::load(src);
+		const auto tail = V::load(src + count - V::size);
+
+		constexpr auto step = static_cast<std::ptrdiff_t>(V::size);
+		auto offset = static_cast<std::ptrdiff_t>(count - (reinterpret_cast<std::uintptr_t>(dest + count) & (V::size - 1))) - step;
+
+		for (; offset > 3 * step; offset -= 4 * step)
+		{
+			const auto a = V::load(src + offset);
+			const auto b = V::load(src + offset - step);
+			const auto c = V::load(src + offset - 2 * step);
+			const auto d = V::load(src + offset - 3 * step);
+			V::store_aligned(dest + offset, a);
+			V::store_aligned(dest + offset - step, b);
+			V::store_aligned(dest + offset - 2 * step, c);
+			V::store_aligned(dest + offset - 3 * step, d);
+		}
+
+		for (; offset > 0; offset -= step)
+			V::store_aligned(dest + offset, V::load(src + offset));
+
+		V::store(dest, head);
+		V::store(dest + count - V::size, tail);
+		V::finish();
+	}
+
+	template<typename V, bool non_temporal>
+	void set(std::uint8_t* dest, std::uint8_t value, std::size_t count)
+	{
+		const auto pattern = V::broadcast(value);
+		V::store(dest, pattern);
+
+		auto offset = V::size - (reinterpret_cast<std::uintptr_t>(dest) & (V::size - 1));
+		const auto end = count - V::size;
+
+		for (; offset < end; offset += V::size)
+		{
+			if constexpr (non_temporal)
+				V::stream(dest + offset, pattern);
+			else
+				V::store_aligned(dest + offset, pattern);
+		}
+
+		if constexpr (non_temporal)
+			_mm_sfence();
+
+		V::store(dest + end, pattern);
+		V::finish();
+	}
+
+	// the loops above over avx2 registers, count must be at least 2 * avx2_size
+	constexpr std::size_t avx2_size = 32;
+	void copy_forward_avx2(std::uint8_t* dest, const std::uint8_t* src, std::size_t count, bool non_temporal);
+	void copy_backward_avx2(std::uint8_t* dest, const std::uint8_t* src, std::size_t count);
+	void set_avx2(std::uint8_t* dest, std::uint8_t value, std::size_t count, bool non_temporal);
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include <intrin.h>
+#include "profiler.hpp"
+
+namespace rendering
+{
+	template<bool Enabled>
+	std::uint64_t basic_profiler<Enabled>::now()
+	{
+		if constexpr (Enabled)
+			return __rdtsc();
+		else
+			return 0;
+	}
+
+	template<bool Enabled>
+	void basic_profiler<Enabled>::create(ID3D11Device* device)
+	{
+		D3D11_QUERY_DESC disjoint_desc = { D3D11_QUERY_TIMESTAMP_DISJOINT, 0u };
+		D3D11_QUERY_DESC timestamp_desc = { D3D11_QUERY_TIMESTAMP, 0u };
+
+		for (auto& frame : _gpu_frames)
+		{
+			device->CreateQuery(&disjoint_desc, &frame.disjoint);
+			device->CreateQuery(&timestamp_desc, &frame.start);
+			device->CreateQuery(&timestamp_desc, &frame.end);
+		}
+	}
+
+	template<bool Enabled>
+	void basic_profiler<Enabled>::release()
+	{
+		for (auto& frame : _gpu_frames)
+		{
+			frame.disjoint->Release();
+			frame.start->Release();
+			frame.end->Release();
+		}
+	}
+
+	template<bool Enabled>
+	void basic_profiler<Enabled>::begin_frame(ID3D11DeviceContext* device_context)
+	{
+		if (_gpu_frames.empty())
+			return;
+
+		// the slot is reused gpu_latency frames after it was issued, by then it has
+		// almost always finished. if not it is dropped rather than waited on
+		auto& frame = _gpu_frames[_gpu_frame];
+		if (frame.pending)
+			collect(device_context, frame);
+
+		device_context->Begin(frame.disjoint);
+		device_context->End(frame.start);
+	}
+
+	template<bool Enabled>
+	void basic_profiler<Enabled>::end_frame(ID3D11DeviceContext* device_context)
+	{
+		if constexpr (!Enabled)
+			return;
+
+		for (auto i = 0u; i < _current.size(); ++i)
+		{
+			_cpu[i].add(_current[i]);
+			_current[i] = 0;
+		}
+
+		if (_gpu_frames.empty())
+			return;
+
+		auto& frame = _gpu_frames[_gpu_frame];
+		device_context->End(frame.end);
+		device_context->End(frame.disjoint);
+		frame.pending = true;
+
+		_gpu_frame = (_gpu_frame + 1) % _gpu_frames.size();
+	}
+
+	template<bool Enabled>
+	void basic_profiler<Enabled>::collect(ID3D11DeviceContext* device_context, gpu_frame& frame)
+	{
+		frame.pending = false;
+
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+		if (device_context->GetData(frame.disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		{
+			++_stats.gpu_dropped;
+			return;
+		}
+
+		// the timestamps finish before the disjoint query that encloses them
+		UINT64 start, end;
+		if (disjoint.Disjoint || disjoint.Frequency == 0
+			|| device_context->GetData(frame.start, &start, sizeof(start), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK
+			|| device_context->GetData(frame.end, &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		{
+			++_stats.gpu_disjoint;
+			return;
+		}
+
+		_gpu.add((end - start) * 1000000000ull / disjoint.Frequency);
+	}
+
+	template<bool Enabled>
+	void basic_profiler<Enabled>::add(stage stage, std::uint64_t cycles)
+	{
+		if constexpr (Enabled)
+			_current[static_cast<std::size_t>(stage)] += cycles;
+	}
+
+	template<bool Enabled>
+	percentiles basic_profiler<Enabled>::cpu(stage stage) const
+	{
+		return _cpu[static_cast<std::size_t>(stage)].summarise();
+	}
+
+	template<bool Enabled>
+	percentiles basic_profiler<Enabled>::gpu() const
+	{
+		return _gpu.summarise();
+	}
+
+	template<bool Enabled>
+	const typename basic_profiler<Enabled>::statistics& basic_profiler<Enabled>::stats() const
+	{
+		return _stats;
+	}
+
+	template class basic_profiler<true>;
+	template class basic_profiler<false>;
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <d3d11.h>
+#include "config.hpp"
+
+namespace rendering
+{
+	struct percentiles
+	{
+		std::size_t samples;
+		std::uint64_t min;
+		std::uint64_t p50;
+		std::uint64_t p95;
+		std::uint64_t p99;
+		std::uint64_t max;
+		std::uint64_t mean;
+	};
+
+	// the last N values of something measured once per frame
+	template<std::size_t N>
+	class history
+	{
+	public:
+
+		void add(std::uint64_t value)
+		{
+			if constexpr (N == 0)
+				return;
+			else
+			{
+				_values[_next] = value;
+				_next = _next + 1 == N ? 0 : _next + 1;
+				if (_count < N)
+					++_count;
+			}
+		}
+
+		std::size_t count() const
+		{
+			return _count;
+		}
+
+		// nearest rank over the samples currently held, oldest ones have already dropped out
+		percentiles summarise() const
+		{
+			percentiles result = { };
+			if constexpr (N == 0)
+				return result;
+			else
+			{
+				if (_count == 0)
+					return result;
+
+				auto sorted = _values;
+				const auto first = sorted.begin();
+				const auto last = first + _count;
+
+				std::uint64_t total = 0;
+				for (auto it = first; it != last; ++it)
+					total += *it;
+
+				const auto rank = [&](std::size_t percent)
+				{
+					const auto nth = first + (_count * percent + 99) / 100 - 1;
+					std::nth_element(first, nth, last);
+					return *nth;
+				};
+
+				result.samples = _count;
+				result.p50 = rank(50);
+				result.p95 = rank(95);
+				result.p99 = rank(99);
+				result.min = *std::min_element(first, last);
+				result.max = *std::max_element(first, last);
+				result.mean = total / _count;
+				return result;
+			}
+		}
+	private:
+		std::array<std::uint64_t, N> _values;
+		std::size_t _next;
+		std::size_t _count;
+	};
+
+	// frame timings kept over the last profile_history frames. cpu times are in rdtsc cycles,
+	// gpu times in nanoseconds from timestamp queries read back gpu_latency frames later.
+	// everything here is a no-op unless Enabled and the histories take no space
+	template<bool Enabled>
+	class basic_profiler
+	{
+	public:
+		enum class stage
+		{
+			begin,
+			draw,
+			end,
+			count
+		};
+
+		using frame_history = history<Enabled ? profile_history : 0>;
+
+		struct statistics
+		{
+			// frames whose gpu queries were not back in time and were overwritten
+			std::size_t gpu_dropped;
+			// frames the gpu clock was unreliable for, such as across a power state change
+			std::size_t gpu_disjoint;
+		};
+
+		static std::uint64_t now();
+
+		void create(ID3D11Device* device);
+		void release();
+
+		// renderer::begin and end call these to bracket the frame on the gpu
+		void begin_frame(ID3D11DeviceContext* device_context);
+		void end_frame(ID3D11DeviceContext* device_context);
+
+		// adds cycles to a stage of the current frame, committed by end_frame
+		void add(stage stage, std::uint64_t cycles);
+
+		percentiles cpu(stage stage) const;
+		percentiles gpu() const;
+		const statistics& stats() const;
+	private:
+		struct gpu_frame
+		{
+			ID3D11Query* disjoint;
+			ID3D11Query* start;
+			ID3D11Query* end;
+			bool pending;
+		};
+
+		void collect(ID3D11DeviceContext* device_context, gpu_frame& frame);
+
+		std::array<std::uint64_t, static_cast<std::size_t>(stage::count)> _current;
+		std::array<frame_history, static_cast<std::size_t>(stage::count)> _cpu;
+		frame_history _gpu;
+		std::array<gpu_frame, Enabled && use_gpu_timing ? gpu_latency : 0> _gpu_frames;
+		std::size_t _gpu_frame;
+		statistics _stats;
+	};
+
+	using profiler = basic_profiler<use_profiling>;
+}
\ No newline at end of file
@@ -0,0 +1,758 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <d3d11.h>
+#include "config.hpp"
+#include "types.hpp"
+#include "instance.hpp"
+#include "tessellation.hpp"
+#include "clipping.hpp"
+#include "bulk.hpp"
+#include "stroke.hpp"
+
+namespace rendering
+{
+	struct batch
+	{
+		batch() = default;
+
+		explicit batch(std::size_t count, D3D11_PRIMITIVE_TOPOLOGY topology, shape_type shape = shape_type::none, std::uint8_t sort_layer = 0)
+			: count(count)
+			, topology(topology)
+			, shape(shape)
+			, sort_layer(sort_layer)
+		{ }
+
+		// indices, or instances if shape is not shape_type::none
+		std::size_t count;
+		D3D11_PRIMITIVE_TOPOLOGY topology;
+		shape_type shape;
+		std::uint8_t sort_layer;
+	};
+
+	// space in a vertex and index stream, indices are offset by base
+	struct geometry
+	{
+		vertex* vertices;
+		std::uint16_t* indices;
+		std::uint16_t base;
+	};
+
+	// backends built from a config name it T::config, the others record with the defaults
+	template<typename T>
+	struct config_of
+	{
+		using type = default_config;
+	};
+
+	template<typename T>
+	requires requires { typename T::config; }
+	struct config_of<T>
+	{
+		using type = typename T::config;
+	};
+
+	template<typename T>
+	constexpr bool has_feature(std::uint32_t feature)
+	{
+		return (config_of<T>::type::features & feature) != 0;
+	}
+
+	// the drawing interface shared by everything that records geometry. T provides
+	// allocate(vertex_count, index_count, geometry&), add_batch(index_count, topology)
+	// and add_instance(instance), and optionally scissor_changed(rect) to clip on the gpu
+	template<typename T>
+	class recorder
+	{
+	public:
+		enum class clip_mode
+		{
+			// lines and boxes are clipped exactly, anything else is only dropped when
+			// entirely outside
+			cpu,
+			// also scissors everything else, which costs a flush on every push and pop. the
+			// renderer then draws the sprites and text so far as well, under the scissor they
+			// were recorded with. backends without a scissor treat it like cpu
+			scissor
+		};
+
+		// clip rects nest, each one is intersected with the one below it. push and pop must
+		// balance before the frame ends
+		void push_clip_rect(vec2 pos, vec2 dimensions, clip_mode mode = clip_mode::cpu);
+		void pop_clip_rect();
+
+		// primitives dropped by culling and clipping since the last begin()
+		std::size_t culled() const
+		{
+			return _culled;
+		}
+
+		template<std::size_t N>
+		void add_vertices(std::array<vertex, N> vertices, D3D11_PRIMITIVE_TOPOLOGY topology)
+		{
+			add_vertices(vertices.data(), N, topology);
+		}
+
+		template<std::size_t V, std::size_t I>
+		void add_indexed(std::array<vertex, V> vertices, std::array<std::uint16_t, I> indices, D3D11_PRIMITIVE_TOPOLOGY topology)
+		{
+			add_indexed(vertices.data(), V, indices.data(), I, topology);
+		}
+
+		void add_vertices(const vertex* vertices, std::size_t count, D3D11_PRIMITIVE_TOPOLOGY topology);
+		// indices are relative to the first of the given vertices, topology must be a list
+		void add_indexed(const vertex* vertices, std::size_t vertex_count, const std::uint16_t* indices, std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology);
+
+		void draw_filled_box(vec2 pos, vec2 dimensions, colour colour);
+		void draw_box(vec2 pos, vec2 dimensions, colour colour);
+		void draw_line(vec2 start, vec2 end, colour colour);
+
+		// curves are tessellated to within circle_error pixels of the true shape
+		void draw_circle(vec2 pos, float radius, colour colour) requires (has_feature<T>(feature::curves));
+		void draw_filled_circle(vec2 pos, float radius, colour colour) requires (has_feature<T>(feature::curves));
+		void draw_arc(vec2 pos, float radius, float start, float end, colour colour) requires (has_feature<T>(feature::curves));
+		void draw_ellipse(vec2 pos, vec2 radii, colour colour) requires (has_feature<T>(feature::curves));
+		void draw_filled_ellipse(vec2 pos, vec2 radii, colour colour) requires (has_feature<T>(feature::curves));
+		// polygons of any size, those larger than one flush are drawn in pieces
+		void draw_polygon(const vec2* points, std::size_t count, colour colour) requires (has_feature<T>(feature::polygons));
+		void draw_filled_polygon(const vec2* points, std::size_t count, colour colour) requires (has_feature<T>(feature::polygons));
+
+		// many primitives at once, expanded with sse straight into the vertex storage as one
+		// batch per flush. they are culled and clipped like the single versions
+		void draw_filled_boxes(std::span<const bulk::box> boxes, colour colour) requires (has_feature<T>(feature::bulk));
+		void draw_filled_boxes(const bulk::box_columns& boxes, std::size_t count, colour colour) requires (has_feature<T>(feature::bulk));
+		void draw_lines(std::span<const bulk::line> lines, colour colour) requires (has_feature<T>(feature::bulk));
+		void draw_lines(const bulk::line_columns& lines, std::size_t count, colour colour) requires (has_feature<T>(feature::bulk));
+		void draw_polyline(std::span<const vec2> points, colour colour) requires (has_feature<T>(feature::bulk));
+
+		// lines of any thickness with anti-aliased edges, drawn as triangles. the polygon
+		// version closes the outline. strokes are culled but never cut
+		void draw_thick_line(vec2 start, vec2 end, const stroke::style& style, colour colour) requires (has_feature<T>(feature::strokes));
+		void draw_thick_polyline(std::span<const vec2> points, const stroke::style& style, colour colour) requires (has_feature<T>(feature::strokes));
+		void draw_thick_polygon(std::span<const vec2> points, const stroke::style& style, colour colour) requires (has_feature<T>(feature::strokes));
+	protected:
+		// the outermost clip rect, the viewport or render target
+		void set_bounds(const clipping::rect& bounds);
+		// empties the clip stack and resets culled()
+		void reset_clip();
+
+		const clipping::rect& clip_rect() const
+		{
+			return _clip_depth ? _clip_rects[(_clip_depth < max_clip_rects ? _clip_depth : max_clip_rects) - 1].rect : _bounds;
+		}
+
+		// counts bounds that are entirely outside the clip rect as culled
+		bool cull(const clipping::rect& bounds)
+		{
+			if (clipping::overlaps(bounds, clip_rect()))
+				return false;
+
+			++_culled;
+			return true;
+		}
+	private:
+		struct clip_entry
+		{
+			clipping::rect rect;
+			clip_mode mode;
+		};
+
+		T& self()
+		{
+			return static_cast<T&>(*this);
+		}
+
+		// the most one flush of T holds, shapes are chunked to fit
+		static constexpr std::size_t vertex_capacity()
+		{
+			return config_of<T>::type::max_vertices;
+		}
+
+		static constexpr std::size_t index_capacity()
+		{
+			return config_of<T>::type::max_indices;
+		}
+
+		// boxes, lines and circles go to add_instance instead of the vertex streams
+		static constexpr bool instanced()
+		{
+			return config_of<T>::type::instancing;
+		}
+
+		void record(const vertex* vertices, std::size_t vertex_count, const std::uint16_t* indices, std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology);
+		bool record_line(vec2 start, vec2 end, colour colour);
+		template<typename Boxes>
+		void record_boxes(const Boxes& boxes, std::size_t count, colour colour);
+		template<typename Lines>
+		void record_lines(const Lines& lines, std::size_t count, colour colour);
+		void record_stroke(std::span<const vec2> points, bool closed, const stroke::style& style, colour colour);
+		void update_scissor();
+
+		// pushes past max_clip_rects are counted but not applied
+		std::array<clip_entry, max_clip_rects> _clip_rects { };
+		std::size_t _clip_depth { };
+		clipping::rect _bounds { clipping::unbounded };
+		clipping::rect _scissor { clipping::unbounded };
+		std::size_t _culled { };
+	};
+
+	template<typename T>
+	void recorder<T>::push_clip_rect(vec2 pos, vec2 dimensions, clip_mode mode)
+	{
+		if (_clip_depth < max_clip_rects)
+			_clip_rects[_clip_depth] = { clipping::intersection(clipping::from(pos, dimensions), clip_rect()), mode };
+		++_clip_depth;
+
+		if (mode == clip_mode::scissor)
+			update_scissor();
+	}
+
+	template<typename T>
+	void recorder<T>::pop_clip_rect()
+	{
+		if (_clip_depth == 0)
+			return;
+
+		--_clip_depth;
+		if (_clip_depth < max_clip_rects && _clip_rects[_clip_depth].mode == clip_mode::scissor)
+			update_scissor();
+	}
+
+	template<typename T>
+	void recorder<T>::set_bounds(const clipping::rect& bounds)
+	{
+		_bounds = bounds;
+		_scissor = bounds;
+	}
+
+	template<typename T>
+	void recorder<T>::reset_clip()
+	{
+		_clip_depth = 0;
+		_scissor = _bounds;
+		_culled = 0;
+	}
+
+	template<typename T>
+	void recorder<T>::record_stroke(std::span<const vec2> points, bool closed, const stroke::style& style, colour colour)
+	{
+		const auto count = points.size();
+		if (count < 2 || !(style.thickness > 0.f))
+			return;
+
+		const auto reach = stroke::reach(style);
+		const auto bounds = clipping::bounds(points.data(), count);
+		if (cull({ { bounds.min.x - reach, bounds.min.y - reach }, { bounds.max.x + reach, bounds.max.y + reach } }))
+			return;
+
+		// pieces share the point they meet at and are joined as if written whole
+		constexpr std::size_t chunk = vertex_capacity() / 9 < (index_capacity() - 18) / 27 ? vertex_capacity() / 9 : (index_capacity() - 18) / 27;
+		const auto total = closed ? count + 1 : count;
+		for (auto first = 0ull; first + 1 < total; first += chunk - 1)
+		{
+			const auto last = total - first < chunk ? total - 1 : first + chunk - 1;
+			const auto size = stroke::measure(points.data(), count, closed, first, last, style);
+
+			geometry geometry;
+			if (!self().allocate(size.vertices, size.indices, geometry))
+				return;
+
+			stroke::write(geometry.vertices, geometry.indices, geometry.base, points.data(), count, closed, first, last, style, colour);
+			self().add_batch(size.indices, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		}
+	}
+
+	template<typename T>
+	void recorder<T>::update_scissor()
+	{
+		// the innermost scissor rect, already intersected with everything below it
+		auto scissor = _bounds;
+		for (auto i = _clip_depth < max_clip_rects ? _clip_depth : max_clip_rects; i > 0; --i)
+		{
+			if (_clip_rects[i - 1].mode == clip_mode::scissor)
+			{
+				scissor = _clip_rects[i - 1].rect;
+				break;
+			}
+		}
+
+		if (scissor.min.x == _scissor.min.x && scissor.min.y == _scissor.min.y && scissor.max.x == _scissor.max.x && scissor.max.y == _scissor.max.y)
+			return;
+
+		_scissor = scissor;
+		if constexpr (requires { self().scissor_changed(scissor); })
+			self().scissor_changed(scissor);
+	}
+
+	template<typename T>
+	void recorder<T>::add_vertices(const vertex* vertices, std::size_t count, D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		if (count == 0 || cull(clipping::bounds(vertices, count)))
+			return;
+
+		// strips cannot be concatenated, so they are indexed as lists instead
+		auto list_topology = topology;
+		auto index_count = count;
+		switch (topology)
+		{
+		case D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP:
+			list_topology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
+			index_count = count < 2 ? 0 : (count - 1) * 2;
+			break;
+		case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP:
+			list_topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+			index_count = count < 3 ? 0 : (count - 2) * 3;
+			break;
+		default:
+			break;
+		}
+
+		geometry geometry;
+		if (!self().allocate(count, index_count, geometry))
+			return;
+
+		std::memcpy(geometry.vertices, vertices, count * sizeof(vertex));
+		auto out = geometry.indices;
+		const auto base = geometry.base;
+
+		switch (topology)
+		{
+		case D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP:
+			for (auto i = 0u; i + 1 < count; ++i)
+			{
+				*out++ = base + i;
+				*out++ = base + i + 1;
+			}
+			break;
+		case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP:
+			// every odd strip triangle is flipped to keep the winding consistent
+			for (auto i = 0u; i + 2 < count; ++i)
+			{
+				*out++ = base + i + (i & 1);
+				*out++ = base + i + 1 - (i & 1);
+				*out++ = base + i + 2;
+			}
+			break;
+		default:
+			for (auto i = 0u; i < count; ++i)
+				*out++ = base + i;
+			break;
+		}
+
+		self().add_batch(index_count, list_topology);
+	}
+
+	template<typename T>
+	void recorder<T>::add_indexed(const vertex* vertices, std::size_t vertex_count, const std::uint16_t* indices, std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		if (vertex_count == 0 || cull(clipping::bounds(vertices, vertex_count)))
+			return;
+
+		record(vertices, vertex_count, indices, index_count, topology);
+	}
+
+	template<typename T>
+	void recorder<T>::record(const vertex* vertices, std::size_t vertex_count, const std::uint16_t* indices, std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		geometry geometry;
+		if (!self().allocate(vertex_count, index_count, geometry))
+			return;
+
+		std::memcpy(geometry.vertices, vertices, vertex_count * sizeof(vertex));
+		for (auto i = 0ull; i < index_count; ++i)
+			geometry.indices[i] = geometry.base + indices[i];
+
+		self().add_batch(index_count, topology);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_filled_box(vec2 pos, vec2 dimensions, colour colour)
+	{
+		// the part inside the clip rect is still a box
+		const auto box = clipping::intersection(clipping::from(pos, dimensions), clip_rect());
+		if (clipping::empty(box))
+		{
+			++_culled;
+			return;
+		}
+
+		const auto min = box.min;
+		const vec2 size = { box.max.x - box.min.x, box.max.y - box.min.y };
+
+		if constexpr (instanced())
+			return self().add_instance(make_filled_box(min, size, colour));
+
+		const auto c = vertex_colour(colour);
+		const std::array<vertex, 4> vertices
+		{{
+			{ min, c },
+			{ min.x + size.x, min.y, c },
+			{ min.x, min.y + size.y, c },
+			{ min + size, c },
+		}};
+		constexpr std::array<std::uint16_t, 6> indices = { 0, 1, 2, 2, 1, 3 };
+
+		record(vertices.data(), vertices.size(), indices.data(), indices.size(), D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_line(vec2 start, vec2 end, colour colour)
+	{
+		if (!record_line(start, end, colour))
+			++_culled;
+	}
+
+	template<typename T>
+	bool recorder<T>::record_line(vec2 start, vec2 end, colour colour)
+	{
+		if (!clipping::line(start, end, clip_rect()))
+			return false;
+
+		if constexpr (instanced())
+		{
+			self().add_instance(make_line(start, end, 1.f, colour));
+			return true;
+		}
+
+		const auto c = vertex_colour(colour);
+		const std::array<vertex, 2> vertices
+		{{
+			{ start, c },
+			{ end, c }
+		}};
+		constexpr std::array<std::uint16_t, 2> indices = { 0, 1 };
+
+		record(vertices.data(), vertices.size(), indices.data(), indices.size(), D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+		return true;
+	}
+
+	template<typename T>
+	void recorder<T>::draw_box(vec2 pos, vec2 dimensions, colour colour)
+	{
+		const auto box = clipping::from(pos, dimensions);
+		if (cull(box))
+			return;
+
+		// a partly visible outline is drawn as its clipped edges
+		if (!clipping::contains(clip_rect(), box))
+		{
+			record_line(pos, { pos.x, pos.y + dimensions.y }, colour);
+			record_line({ pos.x, pos.y + dimensions.y }, pos + dimensions, colour);
+			record_line(pos + dimensions, { pos.x + dimensions.x, pos.y }, colour);
+			record_line({ pos.x + dimensions.x, pos.y }, pos, colour);
+			return;
+		}
+
+		if constexpr (instanced())
+			return self().add_instance(make_box(pos, dimensions, 1.f, colour));
+
+		const auto c = vertex_colour(colour);
+		const std::array<vertex, 4> vertices
+		{{
+			{ pos, c },
+			{ pos.x, pos.y + dimensions.y, c },
+			{ pos + dimensions, c },
+			{ pos.x + dimensions.x, pos.y, c }
+		}};
+		constexpr std::array<std::uint16_t, 8> indices = { 0, 1, 1, 2, 2, 3, 3, 0 };
+
+		record(vertices.data(), vertices.size(), indices.data(), indices.size(), D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_circle(vec2 pos, float radius, colour colour) requires (has_feature<T>(feature::curves))
+	{
+		if constexpr (instanced())
+		{
+			if (!cull(clipping::from({ pos.x - radius, pos.y - radius }, { radius * 2.f, radius * 2.f })))
+				self().add_instance(make_circle(pos, radius, 1.f, colour));
+			return;
+		}
+
+		draw_ellipse(pos, { radius, radius }, colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_filled_circle(vec2 pos, float radius, colour colour) requires (has_feature<T>(feature::curves))
+	{
+		if constexpr (instanced())
+		{
+			if (!cull(clipping::from({ pos.x - radius, pos.y - radius }, { radius * 2.f, radius * 2.f })))
+				self().add_instance(make_circle(pos, radius, 0.f, colour));
+			return;
+		}
+
+		draw_filled_ellipse(pos, { radius, radius }, colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_arc(vec2 pos, float radius, float start, float end, colour colour) requires (has_feature<T>(feature::curves))
+	{
+		if (cull(clipping::from({ pos.x - radius, pos.y - radius }, { radius * 2.f, radius * 2.f })))
+			return;
+
+		// only the swept fraction of a full circle's segments is needed
+		const auto sweep = end > start ? end - start : start - end;
+		const auto full = tessellation::segments(radius, circle_error);
+		auto segments = static_cast<std::size_t>(static_cast<float>(full) * sweep / (2.f * pi<float>)) + 1;
+		if (segments > full)
+			segments = full;
+
+		geometry geometry;
+		if (!self().allocate(segments + 1, segments * 2, geometry))
+			return;
+
+		tessellation::arc(geometry.vertices, geometry.indices, geometry.base, pos, radius, start, end, segments, colour);
+		self().add_batch(segments * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_ellipse(vec2 pos, vec2 radii, colour colour) requires (has_feature<T>(feature::curves))
+	{
+		if (cull(clipping::from({ pos.x - radii.x, pos.y - radii.y }, { radii.x * 2.f, radii.y * 2.f })))
+			return;
+
+		const auto segments = tessellation::segments(radii.x > radii.y ? radii.x : radii.y, circle_error);
+
+		geometry geometry;
+		if (!self().allocate(segments, segments * 2, geometry))
+			return;
+
+		tessellation::ellipse(geometry.vertices, geometry.indices, geometry.base, pos, radii, segments, colour);
+		self().add_batch(segments * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_filled_ellipse(vec2 pos, vec2 radii, colour colour) requires (has_feature<T>(feature::curves))
+	{
+		if (cull(clipping::from({ pos.x - radii.x, pos.y - radii.y }, { radii.x * 2.f, radii.y * 2.f })))
+			return;
+
+		const auto segments = tessellation::segments(radii.x > radii.y ? radii.x : radii.y, circle_error);
+
+		geometry geometry;
+		if (!self().allocate(segments + 1, segments * 3, geometry))
+			return;
+
+		tessellation::filled_ellipse(geometry.vertices, geometry.indices, geometry.base, pos, radii, segments, colour);
+		self().add_batch(segments * 3, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_polygon(const vec2* points, std::size_t count, colour colour) requires (has_feature<T>(feature::polygons))
+	{
+		if (count < 2 || cull(clipping::bounds(points, count)))
+			return;
+
+		if (count <= vertex_capacity() && count * 2 <= index_capacity())
+		{
+			geometry geometry;
+			if (!self().allocate(count, count * 2, geometry))
+				return;
+
+			tessellation::polygon(geometry.vertices, geometry.indices, geometry.base, points, count, colour);
+			self().add_batch(count * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+			return;
+		}
+
+		// past one flush the outline is walked in pieces, the last one ending back at the first point
+		constexpr std::size_t chunk = vertex_capacity() < index_capacity() / 2 + 1 ? vertex_capacity() : index_capacity() / 2 + 1;
+		for (auto first = 0ull; first < count; first += chunk - 1)
+		{
+			const auto size = count + 1 - first < chunk ? count + 1 - first : chunk;
+
+			geometry geometry;
+			if (!self().allocate(size, (size - 1) * 2, geometry))
+				return;
+
+			tessellation::polygon_piece(geometry.vertices, geometry.indices, geometry.base, points, count, first, size, colour);
+			self().add_batch((size - 1) * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+		}
+	}
+
+	template<typename T>
+	void recorder<T>::draw_filled_polygon(const vec2* points, std::size_t count, colour colour) requires (has_feature<T>(feature::polygons))
+	{
+		if (count < 3 || cull(clipping::bounds(points, count)))
+			return;
+
+		if (count <= vertex_capacity() && (count - 2) * 3 <= index_capacity())
+		{
+			geometry geometry;
+			if (!self().allocate(count, (count - 2) * 3, geometry))
+				return;
+
+			tessellation::filled_polygon(geometry.vertices, geometry.indices, geometry.base, points, count, colour);
+			self().add_batch((count - 2) * 3, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			return;
+		}
+
+		// past one flush the fan is split into pieces that each start from the first point
+		// again and share the rim point they meet at
+		constexpr std::size_t chunk = vertex_capacity() - 1 < index_capacity() / 3 + 1 ? vertex_capacity() - 1 : index_capacity() / 3 + 1;
+		for (auto first = 1ull; first + 1 < count; first += chunk - 1)
+		{
+			const auto size = count - first < chunk ? count - first : chunk;
+
+			geometry geometry;
+			if (!self().allocate(size + 1, (size - 1) * 3, geometry))
+				return;
+
+			tessellation::fan_piece(geometry.vertices, geometry.indices, geometry.base, points[0], points + first, size, colour);
+			self().add_batch((size - 1) * 3, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		}
+	}
+
+	template<typename T>
+	void recorder<T>::draw_filled_boxes(std::span<const bulk::box> boxes, colour colour) requires (has_feature<T>(feature::bulk))
+	{
+		if constexpr (instanced())
+		{
+			for (const auto& box : boxes)
+				draw_filled_box(box.pos, box.dimensions, colour);
+			return;
+		}
+
+		record_boxes(boxes.data(), boxes.size(), colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_filled_boxes(const bulk::box_columns& boxes, std::size_t count, colour colour) requires (has_feature<T>(feature::bulk))
+	{
+		if constexpr (instanced())
+		{
+			for (auto i = 0ull; i < count; ++i)
+				draw_filled_box({ boxes.x[i], boxes.y[i] }, { boxes.width[i], boxes.height[i] }, colour);
+			return;
+		}
+
+		record_boxes(boxes, count, colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_lines(std::span<const bulk::line> lines, colour colour) requires (has_feature<T>(feature::bulk))
+	{
+		if constexpr (instanced())
+		{
+			for (const auto& line : lines)
+				draw_line(line.start, line.end, colour);
+			return;
+		}
+
+		record_lines(bulk::point_lines { reinterpret_cast<const vec2*>(lines.data()), 2 }, lines.size(), colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_lines(const bulk::line_columns& lines, std::size_t count, colour colour) requires (has_feature<T>(feature::bulk))
+	{
+		if constexpr (instanced())
+		{
+			for (auto i = 0ull; i < count; ++i)
+				draw_line({ lines.start_x[i], lines.start_y[i] }, { lines.end_x[i], lines.end_y[i] }, colour);
+			return;
+		}
+
+		record_lines(lines, count, colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_polyline(std::span<const vec2> points, colour colour) requires (has_feature<T>(feature::bulk))
+	{
+		const auto count = points.size();
+		if (count < 2)
+			return;
+
+		const auto bounds = clipping::bounds(points.data(), count);
+		if (cull(bounds))
+			return;
+
+		if constexpr (instanced())
+		{
+			for (auto i = 0ull; i + 1 < count; ++i)
+				draw_line(points[i], points[i + 1], colour);
+			return;
+		}
+
+		// segments can only share vertices when none of them needs clipping
+		if (!clipping::contains(clip_rect(), bounds))
+			return record_lines(bulk::point_lines { points.data(), 1 }, count - 1, colour);
+
+		// consecutive chunks share the point they meet at
+		constexpr std::size_t chunk = vertex_capacity() < index_capacity() / 2 + 1 ? vertex_capacity() : index_capacity() / 2 + 1;
+		for (auto first = 0ull; first + 1 < count; first += chunk - 1)
+		{
+			const auto size = count - first < chunk ? count - first : chunk;
+
+			geometry geometry;
+			if (!self().allocate(size, (size - 1) * 2, geometry))
+				return;
+
+			bulk::polyline(geometry.vertices, geometry.indices, geometry.base, points.data() + first, size, colour);
+			self().add_batch((size - 1) * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+		}
+	}
+
+	template<typename T>
+	void recorder<T>::draw_thick_line(vec2 start, vec2 end, const stroke::style& style, colour colour) requires (has_feature<T>(feature::strokes))
+	{
+		const std::array<vec2, 2> points = { start, end };
+		record_stroke(points, false, style, colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_thick_polyline(std::span<const vec2> points, const stroke::style& style, colour colour) requires (has_feature<T>(feature::strokes))
+	{
+		record_stroke(points, false, style, colour);
+	}
+
+	template<typename T>
+	void recorder<T>::draw_thick_polygon(std::span<const vec2> points, const stroke::style& style, colour colour) requires (has_feature<T>(feature::strokes))
+	{
+		if (points.size() >= 3)
+			record_stroke(points, true, style, colour);
+	}
+
+	template<typename T>
+	template<typename Boxes>
+	void recorder<T>::record_boxes(const Boxes& boxes, std::size_t count, colour colour)
+	{
+		// only the visible boxes are allocated, so they are counted before they are written
+		constexpr std::size_t chunk = vertex_capacity() / 4 < index_capacity() / 6 ? vertex_capacity() / 4 : index_capacity() / 6;
+		for (auto first = 0ull; first < count; first += chunk)
+		{
+			const auto size = count - first < chunk ? count - first : chunk;
+			const auto visible = bulk::visible(boxes, first, size, clip_rect());
+			_culled += size - visible;
+
+			geometry geometry;
+			if (visible == 0 || !self().allocate(visible * 4, visible * 6, geometry))
+				continue;
+
+			bulk::filled_boxes(geometry.vertices, geometry.indices, geometry.base, boxes, first, size, clip_rect(), colour);
+			self().add_batch(visible * 6, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		}
+	}
+
+	template<typename T>
+	template<typename Lines>
+	void recorder<T>::record_lines(const Lines& lines, std::size_t count, colour colour)
+	{
+		constexpr std::size_t chunk = vertex_capacity() / 2 < index_capacity() / 2 ? vertex_capacity() / 2 : index_capacity() / 2;
+		for (auto first = 0ull; first < count; first += chunk)
+		{
+			const auto size = count - first < chunk ? count - first : chunk;
+			const auto visible = bulk::visible(lines, first, size, clip_rect());
+			_culled += size - visible;
+
+			geometry geometry;
+			if (visible == 0 || !self().allocate(visible * 2, visible * 2, geometry))
+				continue;
+
+			bulk::lines(geometry.vertices, geometry.indices, geometry.base, lines, first, size, clip_rect(), colour);
+			self().add_batch(visible * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+		}
+	}
+}
\ No newline at end of file
@@ -1,39 +1,248 @@
 #include "renderer.hpp"
 #include "shaders.hpp"
+#include "mini_crt.hpp"
 #pragma comment (lib, "d3d11.lib")
 
 namespace rendering
 {
-	renderer::renderer(IDXGISwapChain* swapchain)
-		: renderer(swapchain, get_device(swapchain))
+	template<typename Config>
+	basic_renderer<Config>::basic_renderer(IDXGISwapChain* swapchain)
+		: basic_renderer(swapchain, get_device(swapchain))
 	{ }
 
-	renderer::renderer(IDXGISwapChain* swapchain, ID3D11Device* device)
-		: renderer(swapchain, device, get_device_context(device))
+	template<typename Config>
+	basic_renderer<Config>::basic_renderer(IDXGISwapChain* swapchain, ID3D11Device* device)
+		: basic_renderer(swapchain, device, get_device_context(device))
 	{ }
 
-	renderer::renderer(IDXGISwapChain* swapchain, ID3D11Device* device, ID3D11DeviceContext* device_context)
-		: _device_context(device_context)
+	template<typename Config>
+	constexpr std::size_t basic_renderer<Config>::frame_storage()
 	{
+		using memory::frame::footprint;
+		auto size = footprint(Config::max_vertices * sizeof(vertex)) + footprint(Config::max_indices * sizeof(std::uint16_t)) + footprint(max_batches * sizeof(batch));
+		if constexpr (Config::instancing)
+			size += footprint(Config::max_instances * sizeof(instance));
+		if constexpr (Config::batch_sorting)
+		{
+			size += footprint(max_batches * 2u * sizeof(std::uint64_t)) + footprint(Config::max_indices * sizeof(std::uint16_t)) + footprint(max_batches * sizeof(batch));
+			if constexpr (Config::instancing)
+				size += footprint(Config::max_instances * sizeof(instance));
+		}
+		if constexpr ((Config::features & feature::text) != 0)
+			size += footprint(Config::max_glyphs * 4u * sizeof(textured_vertex));
+		if constexpr ((Config::features & feature::sprites) != 0)
+			size += footprint(Config::max_sprites * sizeof(sprite)) + footprint(Config::max_sprites * 4u * sizeof(textured_vertex));
+		if constexpr ((Config::features & feature::shapes) != 0)
+			size += footprint(Config::max_shapes * 4u * sizeof(sdf::vertex));
+		return size;
+	}
+
+	template<typename Config>
+	basic_renderer<Config>::basic_renderer(IDXGISwapChain* swapchain, ID3D11Device* device, ID3D11DeviceContext* device_context)
+		: _device(device)
+		, _device_context(device_context)
+		, _instanced_vertex_shader()
+		, _instanced_input_layout()
+		, _vertex_buffer()
+		, _index_buffer()
+		, _instance_buffer()
+		, _glyph_buffer()
+		, _sprite_buffer()
+		, _shape_buffer()
+		, _sort_layer()
+		, _text_layout()
+		, _atlas()
+		, _profiler()
+		, _draw_lists()
+		, _draw_list_count()
+		, _stats()
+	{
+		// past the arena a frame spills into the static heap, which is too small to hold it
+		static_assert(!Config::frame_arena || frame_storage() <= memory::frame_buffer_size);
+
 		// create shaders
 		device->CreateVertexShader(shader::vertex, sizeof(shader::vertex), nullptr, &_vertex_shader);
 		device->CreatePixelShader(shader::pixel, sizeof(shader::pixel), nullptr, &_pixel_shader);
 
-		// create input layout
+		// create input layout. unorm colour is expanded to the float4 the shader reads by the input assembler
 		std::array<D3D11_INPUT_ELEMENT_DESC, 2> ied
 		{{
 			{"POSITION", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u},
-			{"COLOUR", 0u, DXGI_FORMAT_R32G32B32A32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u}
+			{"COLOUR", 0u, use_packed_vertices ? DXGI_FORMAT_R8G8B8A8_UNORM : DXGI_FORMAT_R32G32B32A32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u}
 		}};
 		device->CreateInputLayout(ied.data(), ied.size(), shader::vertex, sizeof(shader::vertex), &_input_layout);
 
-		// create vertex buffer
-		D3D11_BUFFER_DESC buffer_desc = { };
-		buffer_desc.Usage = D3D11_USAGE_DYNAMIC;
-		buffer_desc.ByteWidth = max_vertices * sizeof(vertex);
-		buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		buffer_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		device->CreateBuffer(&buffer_desc, nullptr, &_vertex_buffer);
+		if constexpr (Config::instancing)
+		{
+			device->CreateVertexShader(shader::instanced_vertex, sizeof(shader::instanced_vertex), nullptr, &_instanced_vertex_shader);
+
+			// one element per instance, the vertex id picks the corner
+			std::array<D3D11_INPUT_ELEMENT_DESC, 5> instance_ied
+			{{
+				{"A", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u},
+				{"B", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u},
+				{"THICKNESS", 0u, DXGI_FORMAT_R32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u},
+				{"COLOUR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u},
+				{"TYPE", 0u, DXGI_FORMAT_R32_UINT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u}
+			}};
+			device->CreateInputLayout(instance_ied.data(), instance_ied.size(), shader::instanced_vertex, sizeof(shader::instanced_vertex), &_instanced_input_layout);
+
+			_instance_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(instance), Config::max_instances * ring_flushes);
+		}
+
+		// text and the fringes of thick lines fade out through their alpha
+		D3D11_BLEND_DESC blend_desc = { };
+		blend_desc.RenderTarget[0].BlendEnable = TRUE;
+		blend_desc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+		blend_desc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+		blend_desc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+		blend_desc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+		blend_desc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+		blend_desc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		blend_desc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+		device->CreateBlendState(&blend_desc, &_alpha_blend_state);
+
+		// glyphs, sprites and sdf shapes are all quads. they share an index buffer holding the
+		// same pattern for every quad, glyphs and sprites also share the vertex shader and
+		// input layout since both carry unorm uvs into an atlas
+		constexpr std::size_t text_quads = (Config::features & feature::text) != 0 ? Config::max_glyphs : 0;
+		constexpr std::size_t sprite_quads = (Config::features & feature::sprites) != 0 ? Config::max_sprites : 0;
+		constexpr std::size_t shape_quads = (Config::features & feature::shapes) != 0 ? Config::max_shapes : 0;
+		constexpr auto quads = text_quads > sprite_quads ? (text_quads > shape_quads ? text_quads : shape_quads) : (sprite_quads > shape_quads ? sprite_quads : shape_quads);
+		if constexpr (text_quads != 0 || sprite_quads != 0)
+		{
+			device->CreateVertexShader(shader::text_vertex, sizeof(shader::text_vertex), nullptr, &_text_vertex_shader);
+
+			std::array<D3D11_INPUT_ELEMENT_DESC, 3> text_ied
+			{{
+				{"POSITION", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u},
+				{"TEXCOORD", 0u, DXGI_FORMAT_R16G16_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u},
+				{"COLOUR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u}
+			}};
+			device->CreateInputLayout(text_ied.data(), text_ied.size(), shader::text_vertex, sizeof(shader::text_vertex), &_text_input_layout);
+		}
+
+		if constexpr (quads != 0)
+		{
+			// written once in chunks small enough for the stack
+			D3D11_BUFFER_DESC quad_index_desc = { };
+			quad_index_desc.ByteWidth = static_cast<UINT>(quads * 6u * sizeof(std::uint16_t));
+			quad_index_desc.Usage = D3D11_USAGE_DEFAULT;
+			quad_index_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+			device->CreateBuffer(&quad_index_desc, nullptr, &_quad_index_buffer);
+
+			constexpr auto chunk_quads = 256u;
+			std::array<std::uint16_t, chunk_quads * 6u> quad_indices;
+			for (auto first = 0u; first < quads; first += chunk_quads)
+			{
+				for (auto i = 0u; i < chunk_quads; ++i)
+				{
+					const auto base = static_cast<std::uint16_t>((first + i) * 4u);
+					quad_indices[i * 6u + 0u] = base;
+					quad_indices[i * 6u + 1u] = base + 1u;
+					quad_indices[i * 6u + 2u] = base + 2u;
+					quad_indices[i * 6u + 3u] = base + 2u;
+					quad_indices[i * 6u + 4u] = base + 1u;
+					quad_indices[i * 6u + 5u] = base + 3u;
+				}
+
+				// the last chunk stops at the end of the buffer when quads is not a multiple of it
+				const auto left = static_cast<UINT>(first * 6u * sizeof(std::uint16_t));
+				const auto right = first + chunk_quads < quads ? left + static_cast<UINT>(sizeof(quad_indices)) : static_cast<UINT>(quads * 6u * sizeof(std::uint16_t));
+				const D3D11_BOX box = { left, 0u, 0u, right, 1u, 1u };
+				_device_context->UpdateSubresource(_quad_index_buffer, 0u, &box, quad_indices.data(), 0u, 0u);
+			}
+		}
+
+		// create the text pipeline, the atlas only holds coverage
+		if constexpr ((Config::features & feature::text) != 0)
+		{
+			device->CreatePixelShader(shader::text_pixel, sizeof(shader::text_pixel), nullptr, &_text_pixel_shader);
+
+			// upload the embedded font atlas
+			D3D11_TEXTURE2D_DESC font_desc = { };
+			font_desc.Width = font::atlas_width;
+			font_desc.Height = font::atlas_height;
+			font_desc.MipLevels = 1u;
+			font_desc.ArraySize = 1u;
+			font_desc.Format = DXGI_FORMAT_R8_UNORM;
+			font_desc.SampleDesc.Count = 1u;
+			font_desc.Usage = D3D11_USAGE_IMMUTABLE;
+			font_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+			D3D11_SUBRESOURCE_DATA font_data = { font::atlas.data(), font::atlas_width, 0u };
+			ID3D11Texture2D* font_texture;
+			device->CreateTexture2D(&font_desc, &font_data, &font_texture);
+			device->CreateShaderResourceView(font_texture, nullptr, &_font_view);
+			font_texture->Release();
+
+			// glyphs are snapped to whole pixels, so point sampling maps texels 1:1
+			D3D11_SAMPLER_DESC sampler_desc = { };
+			sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
+			sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+			sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+			sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+			sampler_desc.MaxLOD = 0.f;
+			device->CreateSamplerState(&sampler_desc, &_font_sampler);
+
+			_glyph_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(textured_vertex), Config::max_glyphs * 4u * 2u);
+		}
+
+		// create the sprite pipeline, rgba pages filled as images are packed
+		if constexpr ((Config::features & feature::sprites) != 0)
+		{
+			device->CreatePixelShader(shader::sprite_pixel, sizeof(shader::sprite_pixel), nullptr, &_sprite_pixel_shader);
+
+			D3D11_TEXTURE2D_DESC page_desc = { };
+			page_desc.Width = atlas_size;
+			page_desc.Height = atlas_size;
+			page_desc.MipLevels = 1u;
+			page_desc.ArraySize = 1u;
+			page_desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+			page_desc.SampleDesc.Count = 1u;
+			page_desc.Usage = D3D11_USAGE_DEFAULT;
+			page_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+			for (auto page = 0u; page < atlas_pages; ++page)
+			{
+				device->CreateTexture2D(&page_desc, nullptr, &_atlas_textures[page]);
+				device->CreateShaderResourceView(_atlas_textures[page], nullptr, &_atlas_views[page]);
+				device->CreateRenderTargetView(_atlas_textures[page], nullptr, &_atlas_targets[page]);
+			}
+
+			// sprites may be scaled, the padding the atlas leaves keeps neighbours out
+			D3D11_SAMPLER_DESC sampler_desc = { };
+			sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+			sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+			sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+			sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+			sampler_desc.MaxLOD = 0.f;
+			device->CreateSamplerState(&sampler_desc, &_sprite_sampler);
+
+			_sprite_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(textured_vertex), Config::max_sprites * 4u * 2u);
+		}
+
+		// create the sdf pipeline, the shape's parameters ride along on every corner
+		if constexpr ((Config::features & feature::shapes) != 0)
+		{
+			device->CreateVertexShader(shader::sdf_vertex, sizeof(shader::sdf_vertex), nullptr, &_sdf_vertex_shader);
+			device->CreatePixelShader(shader::sdf_pixel, sizeof(shader::sdf_pixel), nullptr, &_sdf_pixel_shader);
+
+			std::array<D3D11_INPUT_ELEMENT_DESC, 4> sdf_ied
+			{{
+				{"POSITION", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u},
+				{"LOCAL", 0u, DXGI_FORMAT_R32G32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u},
+				{"SHAPE", 0u, DXGI_FORMAT_R32G32B32A32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u},
+				{"COLOUR", 0u, DXGI_FORMAT_R8G8B8A8_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u}
+			}};
+			device->CreateInputLayout(sdf_ied.data(), sdf_ied.size(), shader::sdf_vertex, sizeof(shader::sdf_vertex), &_sdf_input_layout);
+
+			_shape_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(sdf::vertex), Config::max_shapes * 4u * ring_flushes);
+		}
+
+		// create vertex and index ring buffers
+		_vertex_buffer.create(device, D3D11_BIND_VERTEX_BUFFER, sizeof(vertex), Config::max_vertices * ring_flushes);
+		_index_buffer.create(device, D3D11_BIND_INDEX_BUFFER, sizeof(std::uint16_t), Config::max_indices * ring_flushes);
+		_profiler.create(device);
 
 		// create backbuffer view
 		ID3D11Texture2D* backbuffer;
@@ -72,166 +281,893 @@ namespace rendering
 		_device_context->Map(_projection_buffer, 0u, D3D11_MAP_WRITE_DISCARD, 0u, &ms);
 		std::memcpy(ms.pData, matrix.data(), sizeof(matrix));
 		_device_context->Unmap(_projection_buffer, 0u);
+
+		// geometry outside the viewport is culled before it is recorded
+		this->set_bounds(clipping::from({ viewport.TopLeftX, viewport.TopLeftY }, { viewport.Width, viewport.Height }));
+
+		// the scissor rect is always set, to the viewport unless a clip rect asks for less
+		D3D11_RASTERIZER_DESC rasterizer_desc = { };
+		rasterizer_desc.FillMode = D3D11_FILL_SOLID;
+		rasterizer_desc.CullMode = D3D11_CULL_NONE;
+		rasterizer_desc.DepthClipEnable = TRUE;
+		rasterizer_desc.ScissorEnable = TRUE;
+		device->CreateRasterizerState(&rasterizer_desc, &_rasterizer_state);
 	}
 
-	renderer::~renderer() noexcept
+	template<typename Config>
+	basic_renderer<Config>::~basic_renderer() noexcept
 	{
 		_input_layout->Release();
 		_vertex_shader->Release();
 		_pixel_shader->Release();
-		_vertex_buffer->Release();
+		_vertex_buffer.release();
+		_index_buffer.release();
+		_instance_buffer.release();
+		_profiler.release();
+		_alpha_blend_state->Release();
+		if constexpr ((Config::features & (feature::text | feature::sprites)) != 0)
+		{
+			_text_vertex_shader->Release();
+			_text_input_layout->Release();
+		}
+		if constexpr ((Config::features & (feature::text | feature::sprites | feature::shapes)) != 0)
+			_quad_index_buffer->Release();
+		if constexpr ((Config::features & feature::shapes) != 0)
+		{
+			_shape_buffer.release();
+			_sdf_vertex_shader->Release();
+			_sdf_pixel_shader->Release();
+			_sdf_input_layout->Release();
+		}
+		if constexpr ((Config::features & feature::text) != 0)
+		{
+			_glyph_buffer.release();
+			_text_pixel_shader->Release();
+			_font_view->Release();
+			_font_sampler->Release();
+		}
+		if constexpr ((Config::features & feature::sprites) != 0)
+		{
+			_sprite_buffer.release();
+			_sprite_pixel_shader->Release();
+			_sprite_sampler->Release();
+			for (auto page = 0u; page < atlas_pages; ++page)
+			{
+				_atlas_targets[page]->Release();
+				_atlas_views[page]->Release();
+				_atlas_textures[page]->Release();
+			}
+		}
+		_rasterizer_state->Release();
+		if (_instanced_vertex_shader) _instanced_vertex_shader->Release();
+		if (_instanced_input_layout) _instanced_input_layout->Release();
 	}
 
-	void* renderer::operator new(std::size_t size)
+	template<typename Config>
+	void* basic_renderer<Config>::operator new(std::size_t size)
 	{
 		return memory::alloc(size);
 	}
 
-	ID3D11Device* renderer::get_device(IDXGISwapChain* swapchain) const
+	template<typename Config>
+	ID3D11Device* basic_renderer<Config>::get_device(IDXGISwapChain* swapchain) const
 	{
 		ID3D11Device* device;
 		swapchain->GetDevice(__uuidof(ID3D11Device), reinterpret_cast<void**>(&device));
 		return device;
 	}
 
-	ID3D11DeviceContext* renderer::get_device_context(ID3D11Device* device) const
+	template<typename Config>
+	ID3D11DeviceContext* basic_renderer<Config>::get_device_context(ID3D11Device* device) const
 	{
 		ID3D11DeviceContext* context;
 		device->GetImmediateContext(&context);
 		return context;
 	}
 
-	void renderer::begin()
+	template<typename Config>
+	void basic_renderer<Config>::begin()
 	{
-		// backup render state
-		_state_saver.backup(_device_context);
+		const auto start = profiler::now();
 
-		// set shaders
-		_device_context->VSSetShader(_vertex_shader, nullptr, 0u);
-		_device_context->PSSetShader(_pixel_shader, nullptr, 0u);
+		// backup render state. nothing is bound until the first draw, and everything bound
+		// goes through the cache
+		_state.begin(_device_context);
 
-		// set projection buffer
-		_device_context->VSSetConstantBuffers(0u, 1u, &_projection_buffer);
+		// grow the ring buffers if the last frame did not fit
+		_stats = { };
+		_sort_layer = 0u;
+		_stats.grows += _vertex_buffer.new_frame(_device);
+		_stats.grows += _index_buffer.new_frame(_device);
+		if constexpr (Config::instancing)
+			_stats.grows += _instance_buffer.new_frame(_device);
+		if constexpr ((Config::features & feature::text) != 0)
+			_stats.grows += _glyph_buffer.new_frame(_device);
+		if constexpr ((Config::features & feature::shapes) != 0)
+			_stats.grows += _shape_buffer.new_frame(_device);
+		if constexpr ((Config::features & feature::sprites) != 0)
+		{
+			_stats.grows += _sprite_buffer.new_frame(_device);
+			// last frame's sprites were all drawn, its pages may be evicted again
+			_atlas.advance();
+		}
 
-		// set vertex buffer
-		UINT stride = sizeof(vertex);
-		UINT offset = 0u;
-		_device_context->IASetVertexBuffers(0u, 1u, &_vertex_buffer, &stride, &offset);
+		this->reset_clip();
+		set_scissor(this->clip_rect());
 
-		// set render target
-		_device_context->OMSetRenderTargets(1, &_backbuffer_view, nullptr);
+		// reserve the whole frame up front so the vectors never regrow. whatever does not
+		// fit is tried again by the first primitive, which is dropped if it still fails
+		memory::reserve(_vertices, Config::max_vertices);
+		memory::reserve(_indices, Config::max_indices);
+		if constexpr (Config::instancing)
+			memory::reserve(_instances, Config::max_instances);
+		memory::reserve(_batches, max_batches);
 
-		// set input layout
-		_device_context->IASetInputLayout(_input_layout);
+		_profiler.begin_frame(_device_context);
+		_profiler.add(profiler::stage::begin, profiler::now() - start);
 	}
 
-	void renderer::end()
+	template<typename Config>
+	void basic_renderer<Config>::end()
 	{
+		const auto start = profiler::now();
+
+		if constexpr ((Config::features & feature::draw_lists) != 0)
+			gather();
 		draw();
+		draw_overlays();
+
+		// release frame storage
+		if constexpr (Config::frame_arena)
+		{
+			decltype(_vertices)().swap(_vertices);
+			decltype(_indices)().swap(_indices);
+			decltype(_instances)().swap(_instances);
+			decltype(_batches)().swap(_batches);
+			if constexpr ((Config::features & feature::text) != 0)
+				decltype(_glyphs)().swap(_glyphs);
+			if constexpr ((Config::features & feature::sprites) != 0)
+			{
+				decltype(_sprites)().swap(_sprites);
+				decltype(_sprite_vertices)().swap(_sprite_vertices);
+			}
+			if constexpr ((Config::features & feature::shapes) != 0)
+				decltype(_shapes)().swap(_shapes);
+			if constexpr (Config::batch_sorting)
+			{
+				decltype(_sort_keys)().swap(_sort_keys);
+				decltype(_sorted_indices)().swap(_sorted_indices);
+				decltype(_sorted_instances)().swap(_sorted_instances);
+				decltype(_sorted_batches)().swap(_sorted_batches);
+			}
+			memory::frame::reset();
+		}
+
+		// the final draw is counted in both draw and end
+		_profiler.add(profiler::stage::end, profiler::now() - start);
+		_profiler.end_frame(_device_context);
+
+		_stats.state_changes = _state.stats().calls;
+		_stats.redundant_states = _state.stats().skipped;
 
 		// restore render state
-		_state_saver.restore();
+		_state.end();
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw()
+	{
+		const auto start = profiler::now();
+
+		if constexpr (Config::batch_sorting)
+			sort_batches();
+
+		render(_vertices.data(), _vertices.size(), _indices.data(), _indices.size(), _instances.data(), _instances.size(), _batches.data(), _batches.size());
+
+		// clear vertices and batches
+		_vertices.clear();
+		_indices.clear();
+		_instances.clear();
+		_batches.clear();
+
+		// shapes go over the geometry recorded with them
+		if constexpr ((Config::features & feature::shapes) != 0)
+			draw_shapes();
+
+		_profiler.add(profiler::stage::draw, profiler::now() - start);
 	}
 
-	void renderer::draw()
+	template<typename Config>
+	void basic_renderer<Config>::sort_batches() requires (Config::batch_sorting)
 	{
-		if (_vertices.size() <= 0u)
+		const auto count = _batches.size();
+		if (count < 2)
 			return;
 
-		// copy vertices to vram
-		D3D11_MAPPED_SUBRESOURCE ms;
-		_device_context->Map(_vertex_buffer, 0u, D3D11_MAP_WRITE_DISCARD, 0u, &ms);
-		memcpy(ms.pData, _vertices.data(), _vertices.size() * sizeof(vertex));
-		_device_context->Unmap(_vertex_buffer, 0u);
+		// keys and scratch share one allocation, both are reused by every flush of the frame.
+		// without room for them the batches are drawn as recorded
+		if (!memory::reserve(_sort_keys, max_batches * 2))
+			return;
+		_sort_keys.resize(count * 2);
+		const auto keys = _sort_keys.data();
+		for (auto i = 0ull; i < count; ++i)
+		{
+			const auto& batch = _batches[i];
+			if constexpr (Config::state_sorting)
+				keys[i] = sorting::make_key(batch.sort_layer, batch.shape, batch.topology, static_cast<std::uint32_t>(i));
+			else
+				keys[i] = sorting::make_key(batch.sort_layer, static_cast<std::uint32_t>(i));
+		}
 
-		// draw batches
-		std::size_t offset = 0ull;
-		for (auto batch : _batches)
+		const auto sorted = sorting::radix_sort(keys, keys + count, count);
+
+		auto in_order = true;
+		for (auto i = 0ull; i < count && in_order; ++i)
+			in_order = sorting::sequence(sorted[i]) == i;
+		if (in_order)
+			return;
+
+		// the half the sort finished out of holds where each batch starts in its stream
+		const auto starts = sorted == keys ? keys + count : keys;
+		std::size_t index = 0, instance_index = 0;
+		for (auto i = 0ull; i < count; ++i)
+		{
+			const auto& batch = _batches[i];
+			auto& position = batch.shape == shape_type::none ? index : instance_index;
+			starts[i] = position;
+			position += batch.count;
+		}
+
+		if (!memory::reserve(_sorted_indices, Config::max_indices) || !memory::reserve(_sorted_batches, max_batches))
+			return;
+		if constexpr (Config::instancing)
+			if (!memory::reserve(_sorted_instances, Config::max_instances))
+				return;
+
+		_sorted_indices.clear();
+		_sorted_instances.clear();
+		_sorted_batches.clear();
+
+		// rebuild the streams in key order, batches that now sit next to each other merge
+		for (auto i = 0ull; i < count; ++i)
 		{
-			_device_context->IASetPrimitiveTopology(batch.topology);
-			_device_context->Draw(batch.count, offset);
+			const auto& batch = _batches[sorting::sequence(sorted[i])];
+			const auto first = starts[sorting::sequence(sorted[i])];
+			if (batch.shape == shape_type::none)
+				_sorted_indices.insert(_sorted_indices.end(), _indices.begin() + first, _indices.begin() + first + batch.count);
+			else
+				_sorted_instances.insert(_sorted_instances.end(), _instances.begin() + first, _instances.begin() + first + batch.count);
 
-			offset += batch.count;
+			if (!_sorted_batches.empty() && _sorted_batches.back().topology == batch.topology && _sorted_batches.back().shape == batch.shape)
+				_sorted_batches.back().count += batch.count;
+			else
+				_sorted_batches.push_back(batch);
 		}
 
-		// clear vertices and batches
-		_vertices.clear();
-		_batches.clear();
+		_indices.swap(_sorted_indices);
+		_instances.swap(_sorted_instances);
+		_batches.swap(_sorted_batches);
 	}
 
-	void renderer::draw_filled_box(vec2 pos, vec2 dimensions, colour colour)
+	template<typename Config>
+	void basic_renderer<Config>::scissor_changed(const clipping::rect& scissor)
 	{
-		add_vertices<4>(
-		{{
-			{ pos, colour },
-			{ pos.x + dimensions.x, pos.y, colour },
-			{ pos.x, pos.y + dimensions.y, colour },
-			{ pos + dimensions, colour },
-		}},
-		D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+		// sprites and text too, they would otherwise be drawn under whatever scissor end() has
+		draw();
+		draw_overlays();
+		set_scissor(scissor);
 	}
 
-	void renderer::draw_line(vec2 start, vec2 end, colour colour)
+	template<typename Config>
+	void basic_renderer<Config>::draw_overlays()
 	{
-		add_vertices<2>(
-		{{
-			{ start, colour },
-			{ end, colour }
-		}},
-		D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+		if constexpr ((Config::features & feature::sprites) != 0)
+			draw_sprites();
+		if constexpr ((Config::features & feature::text) != 0)
+			draw_glyphs();
 	}
 
-	void renderer::draw_box(vec2 pos, vec2 dimensions, colour colour)
+	template<typename Config>
+	void basic_renderer<Config>::set_scissor(const clipping::rect& scissor)
 	{
-		add_vertices<5>(
-		{{
-			{ pos, colour },
-			{ pos.x, pos.y + dimensions.y, colour},
-			{ pos + dimensions, colour},
-			{ pos.x + dimensions.x, pos.y, colour},
-			{ pos, colour }
-		}},
-		D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP);
+		// whole pixels covering the rect
+		const auto left = static_cast<LONG>(scissor.min.x);
+		const auto top = static_cast<LONG>(scissor.min.y);
+		auto right = static_cast<LONG>(scissor.max.x);
+		auto bottom = static_cast<LONG>(scissor.max.y);
+		if (static_cast<float>(right) < scissor.max.x)
+			++right;
+		if (static_cast<float>(bottom) < scissor.max.y)
+			++bottom;
+
+		// applied with the rest of the pipeline at the next draw
+		_scissor_rect = { left, top, right > left ? right : left, bottom > top ? bottom : top };
 	}
 
-	/*void renderer::draw_circle(vec2 pos, float radius, colour colour)
+	template<typename Config>
+	void basic_renderer<Config>::bind_pipeline(ID3D11PixelShader* pixel_shader)
 	{
-		constexpr auto segments = 256u;
+		_state.set_render_target(_backbuffer_view);
+		// alpha blending stays set for the whole frame, end() restores the game's state
+		_state.set_blend_state(_alpha_blend_state);
+		_state.set_rasterizer_state(_rasterizer_state);
+		_state.set_scissor_rect(_scissor_rect);
+		_state.set_pixel_shader(pixel_shader);
+		_state.set_constant_buffer(_projection_buffer);
+	}
 
-		std::array<vertex, segments + 1> vertices;
-		for (auto i = 0u; i <= segments; ++i)
+	template<typename Config>
+	void basic_renderer<Config>::draw(const draw_list& list) requires ((Config::features & feature::draw_lists) != 0)
+	{
+		// keep the order everything was recorded in
+		draw();
+		for (auto i = 0ull; i < list.block_count(); ++i)
+			render(list.vertices(i), list.vertex_count(i), list.indices(i), list.index_count(i), list.instances(i), list.instance_count(i), list.batches(i), list.batch_count(i));
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::render(const vertex* vertices, std::size_t vertex_count, const std::uint16_t* indices, std::size_t index_count,
+		const instance* instances, std::size_t instance_count, const batch* batches, std::size_t batch_count)
+	{
+		if (batch_count == 0)
+			return;
+
+		// append vertices, indices and instances to the ring buffers
+		UINT base_vertex = 0u, start_index = 0u, start_instance = 0u;
+		const auto uploaded = (vertex_count == 0
+				|| (_vertex_buffer.upload(_device_context, vertices, static_cast<UINT>(vertex_count), base_vertex)
+				&& _index_buffer.upload(_device_context, indices, static_cast<UINT>(index_count), start_index)))
+			&& (instance_count == 0
+				|| _instance_buffer.upload(_device_context, instances, static_cast<UINT>(instance_count), start_instance));
+
+		if (!uploaded)
+			return;
+
+		++_stats.flushes;
+		_stats.bytes_uploaded += vertex_count * sizeof(vertex) + index_count * sizeof(std::uint16_t) + instance_count * sizeof(instance);
+		_stats.wraps = _vertex_buffer.stats().wraps + _index_buffer.stats().wraps + _instance_buffer.stats().wraps;
+
+		draw_batches(batches, batch_count, base_vertex, start_index, start_instance, _vertex_buffer, _index_buffer, _instance_buffer);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw(layer& layer) requires ((Config::features & feature::layers) != 0)
+	{
+		draw();
+
+		const auto bytes = layer.upload(_device, _device_context);
+		_stats.bytes_uploaded += bytes;
+		const auto& list = layer._list;
+		if (layer._dirty)
+			return;
+
+		// the layer's own buffers replace the rings while it is drawn
+		for (auto i = 0ull; i < list.block_count(); ++i)
 		{
-			float theta = 2.f * pi<float> * static_cast<float>(i) / static_cast<float>(segments);
-			vertices[i] = { pos.x + radius * std::cos(theta), pos.y + radius * std::sin(theta), colour };
+			if (list.batch_count(i) == 0)
+				continue;
+
+			if (!bytes)
+				_stats.bytes_retained += list.vertex_count(i) * sizeof(vertex) + list.index_count(i) * sizeof(std::uint16_t) + list.instance_count(i) * sizeof(instance);
+
+			draw_batches(list.batches(i), list.batch_count(i), layer._base_vertex[i], layer._start_index[i], layer._start_instance[i], layer._vertex_buffer, layer._index_buffer, layer._instance_buffer);
 		}
-		add_vertices(vertices, D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP);
-	}*/
+	}
 
-	void state_saver::backup(ID3D11DeviceContext* device_context)
+	template<typename Config>
+	void basic_renderer<Config>::draw_batches(const batch* batches, std::size_t batch_count, UINT base_vertex, UINT start_index, UINT start_instance,
+		const ring_buffer& vertex_buffer, const ring_buffer& index_buffer, const ring_buffer& instance_buffer)
 	{
-		_device_context = device_context;
+		bind_pipeline(_pixel_shader);
+		bind_geometry(false, vertex_buffer, index_buffer, instance_buffer);
 
-		_device_context->IAGetPrimitiveTopology(&_primitive_topology);
-		_device_context->VSGetShader(&_vertex_shader.shader, _vertex_shader.instances, &_vertex_shader.instance_count);
-		_device_context->PSGetShader(&_pixel_shader.shader, _pixel_shader.instances, &_pixel_shader.instance_count);
-		_device_context->VSGetConstantBuffers(0u, 1u, &_constant_buffer);
-		_device_context->IAGetVertexBuffers(0u, 1u, &_vertex_buffer.buffer, &_vertex_buffer.stride, &_vertex_buffer.offset);
-		_device_context->IAGetInputLayout(&_input_layout);
+		auto instanced = false;
+		std::size_t offset = start_index;
+		std::size_t instance_offset = start_instance;
+		for (auto i = 0ull; i < batch_count; ++i)
+		{
+			const auto& batch = batches[i];
+			if ((batch.shape != shape_type::none) != instanced)
+			{
+				instanced = !instanced;
+				bind_geometry(instanced, vertex_buffer, index_buffer, instance_buffer);
+			}
+
+			_state.set_topology(batch.topology);
+			if (instanced)
+			{
+				_device_context->DrawInstanced(vertices_per_instance(batch.shape), batch.count, 0u, instance_offset);
+				instance_offset += batch.count;
+			}
+			else
+			{
+				_device_context->DrawIndexed(batch.count, offset, base_vertex);
+				offset += batch.count;
+			}
+			++_stats.draw_calls;
+		}
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::bind_geometry(bool instanced, const ring_buffer& vertex_buffer, const ring_buffer& index_buffer, const ring_buffer& instance_buffer)
+	{
+		if (instanced)
+		{
+			_state.set_vertex_buffer(instance_buffer.buffer(), sizeof(instance));
+			_state.set_input_layout(_instanced_input_layout);
+			_state.set_vertex_shader(_instanced_vertex_shader);
+		}
+		else
+		{
+			_state.set_vertex_buffer(vertex_buffer.buffer(), sizeof(vertex));
+			_state.set_index_buffer(index_buffer.buffer());
+			_state.set_input_layout(_input_layout);
+			_state.set_vertex_shader(_vertex_shader);
+		}
+	}
+
+	template<typename Config>
+	bool basic_renderer<Config>::allocate(std::size_t vertex_count, std::size_t index_count, geometry& geometry)
+	{
+		if (vertex_count == 0 || index_count == 0 || vertex_count > Config::max_vertices || index_count > Config::max_indices)
+			return false;
+
+		if (_vertices.size() + vertex_count > Config::max_vertices || _indices.size() + index_count > Config::max_indices || _batches.size() == max_batches)
+		{
+			++_stats.overflow_flushes;
+			draw();
+		}
+
+		if (!memory::reserve(_vertices, Config::max_vertices) || !memory::reserve(_indices, Config::max_indices) || !memory::reserve(_batches, max_batches))
+		{
+			++_stats.dropped;
+			return false;
+		}
+
+		_stats.vertices_recorded += vertex_count;
+
+		const auto first_vertex = _vertices.size();
+		_vertices.resize(first_vertex + vertex_count);
+
+		const auto first_index = _indices.size();
+		_indices.resize(first_index + index_count);
+
+		geometry.vertices = &_vertices[first_vertex];
+		geometry.indices = &_indices[first_index];
+		geometry.base = static_cast<std::uint16_t>(first_vertex);
+		return true;
 	}
-	
-	void state_saver::restore()
+
+	template<typename Config>
+	void basic_renderer<Config>::add_batch(std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology)
 	{
-		_device_context->IASetPrimitiveTopology(_primitive_topology);
-		_device_context->VSSetShader(_vertex_shader.shader, _vertex_shader.instances, _vertex_shader.instance_count);
-		_device_context->PSSetShader(_pixel_shader.shader, _pixel_shader.instances, _pixel_shader.instance_count);
-		_device_context->VSSetConstantBuffers(0u, 1u, &_constant_buffer);
-		_device_context->IASetVertexBuffers(0u, 1u, &_vertex_buffer.buffer, &_vertex_buffer.stride, &_vertex_buffer.offset);
-		_device_context->IASetInputLayout(_input_layout);
+		++_stats.batches_recorded;
+
+		const auto mergeable = topology == D3D11_PRIMITIVE_TOPOLOGY_POINTLIST
+			|| topology == D3D11_PRIMITIVE_TOPOLOGY_LINELIST
+			|| topology == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-		if (_vertex_shader.shader) _vertex_shader.shader->Release();
-		if (_pixel_shader.shader) _pixel_shader.shader->Release();
-		if (_constant_buffer) _constant_buffer->Release();
-		if (_vertex_buffer.buffer) _vertex_buffer.buffer->Release();
-		if (_input_layout) _input_layout->Release();
+		// consecutive lists of the same kind share one draw call
+		if (mergeable && !_batches.empty() && _batches.back().topology == topology && _batches.back().shape == shape_type::none && _batches.back().sort_layer == _sort_layer)
+			_batches.back().count += index_count;
+		else
+			_batches.emplace_back(index_count, topology, shape_type::none, _sort_layer);
 	}
+
+	template<typename Config>
+	void basic_renderer<Config>::add_instance(const instance& instance)
+	{
+		// no instanced pipeline exists to draw it with
+		if constexpr (!Config::instancing)
+			return;
+
+		if (_instances.size() + 1 > Config::max_instances || _batches.size() == max_batches)
+		{
+			++_stats.overflow_flushes;
+			draw();
+		}
+
+		if (!memory::reserve(_instances, Config::max_instances) || !memory::reserve(_batches, max_batches))
+		{
+			++_stats.dropped;
+			return;
+		}
+
+		_instances.push_back(instance);
+		++_stats.batches_recorded;
+
+		// consecutive instances of the same shape share one draw call
+		if (!_batches.empty() && _batches.back().shape == instance.type && _batches.back().sort_layer == _sort_layer)
+			++_batches.back().count;
+		else
+			_batches.emplace_back(1u, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, instance.type, _sort_layer);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::set_sort_layer(std::uint8_t sort_layer)
+	{
+		_sort_layer = sort_layer;
+	}
+
+	template<typename Config>
+	bool basic_renderer<Config>::add_draw_list(draw_list* list) requires ((Config::features & feature::draw_lists) != 0)
+	{
+		if (_draw_list_count == _draw_lists.size())
+			return false;
+
+		_draw_lists[_draw_list_count++] = list;
+		return true;
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::gather()
+	{
+		// always in the order the lists were added, whichever thread finished first
+		for (auto i = 0u; i < _draw_list_count; ++i)
+		{
+			const auto list = _draw_lists[i];
+			if (!list->submitted())
+				continue;
+
+			for (auto block = 0ull; block < list->block_count(); ++block)
+				append(*list, block);
+			_stats.dropped += list->stats().dropped;
+			list->release();
+			++_stats.draw_lists;
+		}
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::append(const draw_list& list, std::size_t block)
+	{
+		const auto vertex_count = list.vertex_count(block);
+		const auto index_count = list.index_count(block);
+		const auto instance_count = list.instance_count(block);
+		const auto batch_count = list.batch_count(block);
+
+		// a block never holds more than one flush, so flushing once makes room for all of it
+		if (_vertices.size() + vertex_count > Config::max_vertices || _indices.size() + index_count > Config::max_indices || _instances.size() + instance_count > Config::max_instances || _batches.size() + batch_count > max_batches)
+		{
+			++_stats.overflow_flushes;
+			draw();
+		}
+
+		if (!memory::reserve(_vertices, Config::max_vertices) || !memory::reserve(_indices, Config::max_indices) || !memory::reserve(_instances, Config::max_instances) || !memory::reserve(_batches, max_batches))
+		{
+			++_stats.dropped;
+			return;
+		}
+
+		_stats.vertices_recorded += vertex_count;
+
+		const auto base = static_cast<std::uint16_t>(_vertices.size());
+		_vertices.insert(_vertices.end(), list.vertices(block), list.vertices(block) + vertex_count);
+		_instances.insert(_instances.end(), list.instances(block), list.instances(block) + instance_count);
+
+		const auto first_index = _indices.size();
+		_indices.resize(first_index + index_count);
+		for (auto i = 0ull; i < index_count; ++i)
+			_indices[first_index + i] = base + list.indices(block)[i];
+
+		// batches keep their order, so indexed and instanced runs still line up in draw()
+		for (auto i = 0ull; i < batch_count; ++i)
+		{
+			const auto& batch = list.batches(block)[i];
+			if (batch.shape == shape_type::none)
+			{
+				add_batch(batch.count, batch.topology);
+			}
+			else
+			{
+				_stats.batches_recorded += batch.count;
+				if (!_batches.empty() && _batches.back().shape == batch.shape && _batches.back().sort_layer == _sort_layer)
+					_batches.back().count += batch.count;
+				else
+					_batches.emplace_back(batch.count, batch.topology, batch.shape, _sort_layer);
+			}
+		}
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_text(vec2 pos, const char* text, colour colour) requires ((Config::features & feature::text) != 0)
+	{
+		std::size_t count;
+		vec2 size;
+		const auto glyphs = _text_layout.layout(text, count, size);
+		if (count == 0 || this->cull(clipping::from(pos, size)))
+			return;
+
+		// reserved on first use so frames without text leave the arena alone
+		if (!memory::reserve(_glyphs, Config::max_glyphs * 4u))
+		{
+			++_stats.dropped;
+			return;
+		}
+		// full, so the frame so far is drawn the way end() draws it and the text stays over
+		// everything recorded before it
+		if (_glyphs.size() + count * 4u > Config::max_glyphs * 4u)
+		{
+			++_stats.overflow_flushes;
+			draw();
+			draw_overlays();
+		}
+
+		// the origin is snapped too so every texel lands on a pixel
+		const auto x = static_cast<float>(static_cast<std::int32_t>(pos.x + 0.5f));
+		const auto y = static_cast<float>(static_cast<std::int32_t>(pos.y + 0.5f));
+		const auto c = pack(colour);
+
+		for (auto i = 0u; i < count; ++i)
+		{
+			const auto& placed = glyphs[i];
+			const auto& glyph = font::glyphs[placed.index];
+
+			const auto left = x + placed.x;
+			const auto top = y + placed.y;
+			const auto right = left + glyph.width;
+			const auto bottom = top + glyph.height;
+
+			const auto u0 = glyph.x * 0xffffu / font::atlas_width;
+			const auto v0 = glyph.y * 0xffffu / font::atlas_height;
+			const auto u1 = (glyph.x + glyph.width) * 0xffffu / font::atlas_width;
+			const auto v1 = (glyph.y + glyph.height) * 0xffffu / font::atlas_height;
+
+			_glyphs.push_back({ { left, top }, u0 | v0 << 16, c });
+			_glyphs.push_back({ { right, top }, u1 | v0 << 16, c });
+			_glyphs.push_back({ { left, bottom }, u0 | v1 << 16, c });
+			_glyphs.push_back({ { right, bottom }, u1 | v1 << 16, c });
+		}
+
+		_stats.glyphs += count;
+	}
+
+	template<typename Config>
+	vec2 basic_renderer<Config>::measure_text(const char* text) requires ((Config::features & feature::text) != 0)
+	{
+		return _text_layout.measure(text);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_rounded_box(vec2 pos, vec2 dimensions, float radius, float thickness, colour colour) requires ((Config::features & feature::shapes) != 0)
+	{
+		const vec2 half_size = { dimensions.x * 0.5f, dimensions.y * 0.5f };
+		add_shape({ pos.x + half_size.x, pos.y + half_size.y }, sdf::rounded_box(half_size, radius, thickness), colour);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_filled_rounded_box(vec2 pos, vec2 dimensions, float radius, colour colour) requires ((Config::features & feature::shapes) != 0)
+	{
+		const vec2 half_size = { dimensions.x * 0.5f, dimensions.y * 0.5f };
+		add_shape({ pos.x + half_size.x, pos.y + half_size.y }, sdf::rounded_box(half_size, radius, 0.f), colour);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_smooth_circle(vec2 pos, float radius, float thickness, colour colour) requires ((Config::features & feature::shapes) != 0)
+	{
+		add_shape(pos, sdf::circle(radius, thickness), colour);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_filled_smooth_circle(vec2 pos, float radius, colour colour) requires ((Config::features & feature::shapes) != 0)
+	{
+		add_shape(pos, sdf::circle(radius, 0.f), colour);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_ring(vec2 pos, float inner_radius, float outer_radius, colour colour) requires ((Config::features & feature::shapes) != 0)
+	{
+		// an inner radius of 0 would be a filled circle, not an outline as thick as the radius
+		if (outer_radius > inner_radius)
+			add_shape(pos, sdf::circle(outer_radius, inner_radius > 0.f ? outer_radius - inner_radius : 0.f), colour);
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::add_shape(vec2 centre, const sdf::shape& shape, colour colour) requires ((Config::features & feature::shapes) != 0)
+	{
+		const auto x = shape.half_size.x + sdf::fringe;
+		const auto y = shape.half_size.y + sdf::fringe;
+		if (shape.half_size.x <= 0.f || shape.half_size.y <= 0.f || this->cull(clipping::from({ centre.x - x, centre.y - y }, { x * 2.f, y * 2.f })))
+			return;
+
+		// reserved on first use so frames without shapes leave the arena alone
+		if (!memory::reserve(_shapes, Config::max_shapes * 4u))
+		{
+			++_stats.dropped;
+			return;
+		}
+		if (_shapes.size() + 4u > Config::max_shapes * 4u)
+		{
+			++_stats.overflow_flushes;
+			draw();
+		}
+
+		const auto first = _shapes.size();
+		_shapes.resize(first + 4u);
+		sdf::write(&_shapes[first], centre, shape, colour);
+		++_stats.shapes;
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_shapes() requires ((Config::features & feature::shapes) != 0)
+	{
+		if (_shapes.empty())
+			return;
+
+		UINT base_vertex;
+		if (_shape_buffer.upload(_device_context, _shapes.data(), static_cast<UINT>(_shapes.size()), base_vertex))
+		{
+			_stats.bytes_uploaded += _shapes.size() * sizeof(sdf::vertex);
+
+			bind_pipeline(_sdf_pixel_shader);
+			_state.set_vertex_buffer(_shape_buffer.buffer(), sizeof(sdf::vertex));
+			_state.set_index_buffer(_quad_index_buffer);
+			_state.set_input_layout(_sdf_input_layout);
+			_state.set_topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			_state.set_vertex_shader(_sdf_vertex_shader);
+
+			_device_context->DrawIndexed(static_cast<UINT>(_shapes.size() / 4u * 6u), 0u, static_cast<INT>(base_vertex));
+			++_stats.draw_calls;
+		}
+
+		_shapes.clear();
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_sprite(vec2 pos, vec2 size, const image& image, colour tint) requires ((Config::features & feature::sprites) != 0)
+	{
+		if (this->cull(clipping::from(pos, size)))
+			return;
+
+		// reserved on first use so frames without sprites leave the arena alone. they are all
+		// drawn in end(), so the storage doubles whenever it is full
+		if (_sprites.size() == _sprites.capacity() && !memory::reserve(_sprites, _sprites.empty() ? Config::max_sprites : _sprites.size() * 2u))
+		{
+			++_stats.dropped;
+			return;
+		}
+
+		bool placed;
+		const auto region = _atlas.acquire(image, placed);
+		if (!region)
+		{
+			++_stats.dropped;
+			return;
+		}
+
+		// packing only ever takes space nothing recorded this frame samples from. a page packed
+		// from empty is cleared first, so the padding around its new images is transparent
+		if (placed)
+		{
+			constexpr FLOAT transparent[4] = { };
+			const auto cleared = _atlas.take_cleared();
+			for (auto page = 0u; page < atlas_pages; ++page)
+				if (cleared & (1u << page))
+					_device_context->ClearRenderTargetView(_atlas_targets[page], transparent);
+
+			const D3D11_BOX box = { region->x, region->y, 0u, static_cast<UINT>(region->x + region->width), static_cast<UINT>(region->y + region->height), 1u };
+			_device_context->UpdateSubresource(_atlas_textures[region->page], 0u, &box, image.pixels, image.width * 4u, 0u);
+		}
+
+		const auto u0 = region->x * 0xffffu / atlas_size;
+		const auto v0 = region->y * 0xffffu / atlas_size;
+		const auto u1 = (region->x + region->width) * 0xffffu / atlas_size;
+		const auto v1 = (region->y + region->height) * 0xffffu / atlas_size;
+		_sprites.push_back({ pos, { pos.x + size.x, pos.y + size.y }, u0 | v0 << 16, u1 | v1 << 16, pack(tint), region->page });
+		++_stats.sprites;
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_sprites() requires ((Config::features & feature::sprites) != 0)
+	{
+		if (_sprites.empty())
+			return;
+
+		if (!memory::reserve(_sprite_vertices, Config::max_sprites * 4u))
+		{
+			_stats.dropped += _sprites.size();
+			_sprites.clear();
+			return;
+		}
+
+		// every page is one pass over the frame's sprites, so they keep their order within it
+		for (std::uint16_t page = 0u; page < atlas_pages; ++page)
+		{
+			auto next = _sprites.begin();
+			while (next != _sprites.end())
+			{
+				_sprite_vertices.clear();
+				for (; next != _sprites.end() && _sprite_vertices.size() < Config::max_sprites * 4u; ++next)
+				{
+					const auto& sprite = *next;
+					if (sprite.page != page)
+						continue;
+
+					const auto uv_max_min = (sprite.uv_max & 0xffffu) | (sprite.uv_min & 0xffff0000u);
+					const auto uv_min_max = (sprite.uv_min & 0xffffu) | (sprite.uv_max & 0xffff0000u);
+					_sprite_vertices.push_back({ sprite.min, sprite.uv_min, sprite.colour });
+					_sprite_vertices.push_back({ { sprite.max.x, sprite.min.y }, uv_max_min, sprite.colour });
+					_sprite_vertices.push_back({ { sprite.min.x, sprite.max.y }, uv_min_max, sprite.colour });
+					_sprite_vertices.push_back({ sprite.max, sprite.uv_max, sprite.colour });
+				}
+
+				if (_sprite_vertices.empty())
+					break;
+
+				UINT base_vertex;
+				if (!_sprite_buffer.upload(_device_context, _sprite_vertices.data(), static_cast<UINT>(_sprite_vertices.size()), base_vertex))
+					continue;
+
+				_stats.bytes_uploaded += _sprite_vertices.size() * sizeof(textured_vertex);
+
+				bind_pipeline(_sprite_pixel_shader);
+				_state.set_vertex_buffer(_sprite_buffer.buffer(), sizeof(textured_vertex));
+				_state.set_index_buffer(_quad_index_buffer);
+				_state.set_input_layout(_text_input_layout);
+				_state.set_topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+				_state.set_vertex_shader(_text_vertex_shader);
+				_state.set_shader_resource(_atlas_views[page]);
+				_state.set_sampler(_sprite_sampler);
+
+				_device_context->DrawIndexed(static_cast<UINT>(_sprite_vertices.size() / 4u * 6u), 0u, static_cast<INT>(base_vertex));
+				++_stats.draw_calls;
+			}
+		}
+
+		_sprites.clear();
+	}
+
+	template<typename Config>
+	void basic_renderer<Config>::draw_glyphs() requires ((Config::features & feature::text) != 0)
+	{
+		if (_glyphs.empty())
+			return;
+
+		UINT base_vertex;
+		if (_glyph_buffer.upload(_device_context, _glyphs.data(), static_cast<UINT>(_glyphs.size()), base_vertex))
+		{
+			_stats.bytes_uploaded += _glyphs.size() * sizeof(textured_vertex);
+
+			bind_pipeline(_text_pixel_shader);
+			_state.set_vertex_buffer(_glyph_buffer.buffer(), sizeof(textured_vertex));
+			_state.set_index_buffer(_quad_index_buffer);
+			_state.set_input_layout(_text_input_layout);
+			_state.set_topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			_state.set_vertex_shader(_text_vertex_shader);
+			_state.set_shader_resource(_font_view);
+			_state.set_sampler(_font_sampler);
+
+			_device_context->DrawIndexed(static_cast<UINT>(_glyphs.size() / 4u * 6u), 0u, static_cast<INT>(base_vertex));
+			++_stats.draw_calls;
+		}
+
+		_glyphs.clear();
+	}
+
+	template<typename Config>
+	const typename basic_renderer<Config>::statistics& basic_renderer<Config>::stats() const
+	{
+		return _stats;
+	}
+
+	template<typename Config>
+	const text_layout::statistics& basic_renderer<Config>::text_stats() const requires ((Config::features & feature::text) != 0)
+	{
+		return _text_layout.stats();
+	}
+
+	template<typename Config>
+	const sprite_atlas& basic_renderer<Config>::atlas() const requires ((Config::features & feature::sprites) != 0)
+	{
+		return _atlas;
+	}
+
+	template<typename Config>
+	const typename basic_renderer<Config>::profiler& basic_renderer<Config>::profile() const
+	{
+		return _profiler;
+	}
+
+	template class basic_renderer<default_config>;
+	template class basic_renderer<compact_config>;
+	template class basic_renderer<instanced_config>;
 }
\ No newline at end of file
@@ -1,85 +1,76 @@
 #pragma once
 #include <array>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
 #include <vector>
 #include <d3d11.h>
+#include "config.hpp"
 #include "memory_manager.hpp"
+#include "ring_buffer.hpp"
+#include "types.hpp"
+#include "instance.hpp"
+#include "recorder.hpp"
+#include "draw_list.hpp"
+#include "layer.hpp"
+#include "text.hpp"
+#include "atlas.hpp"
+#include "sdf.hpp"
+#include "profiler.hpp"
+#include "sorting.hpp"
+#include "state_cache.hpp"
 
 namespace rendering
 {
-	constexpr auto max_vertices = 1000;
-	template<typename T> constexpr T pi = 3.14159265359;
-
 	using matrix4x4 = std::array<std::array<float, 4>, 4>;
 
-	struct colour
-	{
-		float r, g, b, a;
-	};
-
-	struct vec2
-	{
-		float x, y;
-
-		vec2 operator+(vec2 vec) const
-		{
-			return { x + vec.x, y + vec.y };
-		}
-	};
-
-	struct vertex
+	// sizes, allocator, features and profiling come from Config, see default_config. parts a
+	// config leaves out are neither compiled nor created on the gpu
+	template<typename Config = default_config>
+	class basic_renderer : public recorder<basic_renderer<Config>>
 	{
-		vec2 pos;
-		colour colour;
-	};
+		friend class recorder<basic_renderer>;
 
-	struct batch
-	{
-		explicit batch(std::size_t count, D3D11_PRIMITIVE_TOPOLOGY topology)
-			: count(count)
-			, topology(topology)
-		{ }
-
-		std::size_t count;
-		D3D11_PRIMITIVE_TOPOLOGY topology;
-	};
-
-	class state_saver
-	{
+		// indices are 16 bit, and draw lists and layers are recorded with default_config
+		static constexpr auto gathers_lists = (Config::features & (feature::draw_lists | feature::layers)) != 0;
+		static_assert(Config::max_vertices <= 0x10000 && Config::max_indices >= 6);
+		static_assert(!gathers_lists || (Config::max_vertices >= max_vertices && Config::max_indices >= max_indices));
+		static_assert(!gathers_lists || (Config::instancing == default_config::instancing && Config::max_instances >= default_config::max_instances));
 	public:
-		void backup(ID3D11DeviceContext* device_context);
-		void restore();
-	private:
-		template<typename T>
-		struct shader
-		{
-			T* shader;
-			ID3D11ClassInstance* instances[256];
-			UINT instance_count;
-		};
+		using config = Config;
+		using profiler = basic_profiler<Config::profiling>;
 
-		struct vertex_buffer
+		struct statistics
 		{
-			ID3D11Buffer* buffer;
-			UINT stride;
-			UINT offset;
+			std::size_t vertices_recorded;
+			std::size_t batches_recorded;
+			std::size_t draw_calls;
+			std::size_t flushes;
+			// flushes forced mid-frame because max_vertices, max_indices, max_instances or
+			// max_glyphs was reached
+			std::size_t overflow_flushes;
+			std::size_t bytes_uploaded;
+			std::size_t wraps;
+			std::size_t grows;
+			std::size_t draw_lists;
+			// layer geometry drawn from its own buffers without uploading it again
+			std::size_t bytes_retained;
+			std::size_t glyphs;
+			std::size_t sprites;
+			std::size_t shapes;
+			// pipeline state calls made, and those dropped because the state was already bound
+			std::size_t state_changes;
+			std::size_t redundant_states;
+			// primitives and draw list blocks left out because frame storage could not hold
+			// them, primitives the gathered draw lists could not hold and sprites the atlas
+			// could not pack
+			std::size_t dropped;
 		};
 
-		ID3D11DeviceContext* _device_context;
-		D3D11_PRIMITIVE_TOPOLOGY _primitive_topology;
-		shader<ID3D11VertexShader> _vertex_shader;
-		shader<ID3D11PixelShader> _pixel_shader;
-		ID3D11InputLayout* _input_layout;
-		ID3D11Buffer* _constant_buffer;
-		vertex_buffer _vertex_buffer;
-	};
-
-	class renderer
-	{
-	public:
-		explicit renderer(IDXGISwapChain* swapchain);
-		explicit renderer(IDXGISwapChain* swapchain, ID3D11Device* device);
-		explicit renderer(IDXGISwapChain* swapchain, ID3D11Device* device, ID3D11DeviceContext* device_context);
-		~renderer() noexcept;
+		explicit basic_renderer(IDXGISwapChain* swapchain);
+		explicit basic_renderer(IDXGISwapChain* swapchain, ID3D11Device* device);
+		explicit basic_renderer(IDXGISwapChain* swapchain, ID3D11Device* device, ID3D11DeviceContext* device_context);
+		~basic_renderer() noexcept;
 
 		void* operator new(std::size_t size);
 
@@ -87,36 +78,171 @@ namespace rendering
 		void draw();
 		void end();
 
-		template<std::size_t N>
-		void add_vertices(std::array<vertex, N> vertices, D3D11_PRIMITIVE_TOPOLOGY topology)
-		{
-			if (_vertices.size() + N > max_vertices)
-				draw();
-
-			_vertices.resize(_vertices.size() + N);
-			memcpy(&_vertices[_vertices.size() - N], vertices.data(), N * sizeof(vertex));
-
-			_batches.emplace_back(N, topology);
-		}
-
-		void draw_filled_box(vec2 pos, vec2 dimensions, colour colour);
-		void draw_box(vec2 pos, vec2 dimensions, colour colour);
-		//void draw_circle(vec2 pos, float radius, colour colour);
-		void draw_line(vec2 start, vec2 end, colour colour);
+		// uploads and draws a finished list straight from its storage, without copying it
+		// into the frame first. the list must not be recorded into until this returns
+		void draw(const draw_list& list) requires ((Config::features & feature::draw_lists) != 0);
+		// uploads the layer only if it changed since it was last drawn
+		void draw(layer& layer) requires ((Config::features & feature::layers) != 0);
+
+		void add_instance(const instance& instance);
+
+		// geometry recorded after this is drawn after everything in lower sort layers. within a
+		// layer it is grouped by state when Config::state_sorting, and keeps the order it was
+		// recorded in otherwise. resets to 0 in begin(), gathered draw lists go into the layer
+		// current at end().
+		// batches are only sorted within one flush. anything that flushes early draws what came
+		// before it first, whatever its layer: a full buffer, a new clip rect, a draw list or
+		// layer drawn directly, or text past max_glyphs. sdf shapes, sprites and text have no
+		// sort layer
+		void set_sort_layer(std::uint8_t sort_layer);
+
+		// lists are gathered in end() in the order they were added, after the frame's own
+		// geometry. a list is added once and gathered in every frame it was submitted for,
+		// add them from the thread that calls end()
+		bool add_draw_list(draw_list* list) requires ((Config::features & feature::draw_lists) != 0);
+
+		// anti-aliased from one quad each, however large. outlines lie inside the edge. they are
+		// drawn after the geometry recorded before them, whenever that is flushed
+		void draw_rounded_box(vec2 pos, vec2 dimensions, float radius, float thickness, colour colour) requires ((Config::features & feature::shapes) != 0);
+		void draw_filled_rounded_box(vec2 pos, vec2 dimensions, float radius, colour colour) requires ((Config::features & feature::shapes) != 0);
+		void draw_smooth_circle(vec2 pos, float radius, float thickness, colour colour) requires ((Config::features & feature::shapes) != 0);
+		void draw_filled_smooth_circle(vec2 pos, float radius, colour colour) requires ((Config::features & feature::shapes) != 0);
+		void draw_ring(vec2 pos, float inner_radius, float outer_radius, colour colour) requires ((Config::features & feature::shapes) != 0);
+
+		// text is drawn over the rest of the frame, all of it in one draw call. past
+		// Config::max_glyphs or when the scissor changes the frame so far is drawn first,
+		// geometry and sprites recorded after that can then cover the text before it. pos is
+		// the top left of the first line
+		void draw_text(vec2 pos, const char* text, colour colour) requires ((Config::features & feature::text) != 0);
+		vec2 measure_text(const char* text) requires ((Config::features & feature::text) != 0);
+
+		// image stretched over pos to pos + size and multiplied by tint. it is packed into the
+		// sprite atlas when first drawn and stays there until its page is evicted. sprites are
+		// drawn in end() over the frame's geometry and under its text, or earlier when the
+		// scissor changes, one draw call per atlas page for every Config::max_sprites of them
+		void draw_sprite(vec2 pos, vec2 size, const image& image, colour tint) requires ((Config::features & feature::sprites) != 0);
+
+		// counters for the current frame, reset in begin()
+		const statistics& stats() const;
+		// layout cache counters since creation
+		const text_layout::statistics& text_stats() const requires ((Config::features & feature::text) != 0);
+		// the sprite atlas, for its counters and occupancy
+		const sprite_atlas& atlas() const requires ((Config::features & feature::sprites) != 0);
+		// timings of the last frames, empty unless Config::profiling is set. memory::stats()
+		// and memory::frame::stats() cover the allocators
+		const profiler& profile() const;
 	private:
 		ID3D11Device* get_device(IDXGISwapChain* swapchain) const;
 		ID3D11DeviceContext* get_device_context(ID3D11Device* device) const;
 
-		state_saver _state_saver;
+		// space in the frame's vertex and index streams, flushing first if it does not fit
+		bool allocate(std::size_t vertex_count, std::size_t index_count, geometry& geometry);
+		void add_batch(std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology);
+		void render(const vertex* vertices, std::size_t vertex_count, const std::uint16_t* indices, std::size_t index_count,
+			const instance* instances, std::size_t instance_count, const batch* batches, std::size_t batch_count);
+		void draw_batches(const batch* batches, std::size_t batch_count, UINT base_vertex, UINT start_index, UINT start_instance,
+			const ring_buffer& vertex_buffer, const ring_buffer& index_buffer, const ring_buffer& instance_buffer);
+		void bind_geometry(bool instanced, const ring_buffer& vertex_buffer, const ring_buffer& index_buffer, const ring_buffer& instance_buffer);
+		void sort_batches() requires (Config::batch_sorting);
+		// flushes what was recorded under the previous scissor rect
+		void scissor_changed(const clipping::rect& scissor);
+		// sprites and then text recorded so far, over the geometry already drawn
+		void draw_overlays();
+		void set_scissor(const clipping::rect& scissor);
+		// state every draw needs besides the geometry
+		void bind_pipeline(ID3D11PixelShader* pixel_shader);
+		void draw_glyphs() requires ((Config::features & feature::text) != 0);
+		void draw_sprites() requires ((Config::features & feature::sprites) != 0);
+		void add_shape(vec2 centre, const sdf::shape& shape, colour colour) requires ((Config::features & feature::shapes) != 0);
+		void draw_shapes() requires ((Config::features & feature::shapes) != 0);
+		void gather();
+		void append(const draw_list& list, std::size_t block);
+
+		// per-frame storage is bump allocated from memory::frame and released in end()
+		template<typename T>
+		using frame_allocator = std::conditional_t<Config::frame_arena, memory::frame_allocator<T>, memory::allocator<T>>;
+		template<typename T>
+		using frame_vector = std::vector<T, frame_allocator<T>>;
+		// members only a part the config leaves out uses are empty
+		template<std::uint32_t Feature, typename T>
+		using feature_storage = std::conditional_t<(Config::features & Feature) != 0, T, std::monostate>;
+		template<typename T>
+		using sorting_storage = std::conditional_t<Config::batch_sorting, T, std::monostate>;
+		// merged batches are far fewer than primitives, a flush is forced if they are not
+		static constexpr auto max_batches = Config::max_vertices / 4;
+		// the most a frame reserves from memory::frame, before sprites past Config::max_sprites
+		static constexpr std::size_t frame_storage();
+
+		// half the size of its quad, which only exists while its page is drawn
+		struct sprite
+		{
+			vec2 min;
+			vec2 max;
+			std::uint32_t uv_min;
+			std::uint32_t uv_max;
+			std::uint32_t colour;
+			std::uint16_t page;
+		};
+
+		basic_state_cache<Config::lazy_state_backup> _state;
 		ID3D11RenderTargetView* _backbuffer_view;
+		ID3D11Device* _device;
 		ID3D11DeviceContext* _device_context;
 		ID3D11VertexShader* _vertex_shader;
 		ID3D11PixelShader* _pixel_shader;
 		ID3D11InputLayout* _input_layout;
+		ID3D11VertexShader* _instanced_vertex_shader;
+		ID3D11InputLayout* _instanced_input_layout;
 		ID3D11Buffer* _projection_buffer;
-		ID3D11Buffer* _vertex_buffer;
-
-		std::vector<vertex, memory::allocator<vertex>> _vertices;
-		std::vector<batch, memory::allocator<batch>> _batches;
+		ID3D11RasterizerState* _rasterizer_state;
+		// the text vertex shader and layout draw sprites too, both are textured quads
+		ID3D11VertexShader* _text_vertex_shader;
+		ID3D11PixelShader* _text_pixel_shader;
+		ID3D11InputLayout* _text_input_layout;
+		ID3D11ShaderResourceView* _font_view;
+		ID3D11SamplerState* _font_sampler;
+		ID3D11PixelShader* _sprite_pixel_shader;
+		ID3D11SamplerState* _sprite_sampler;
+		feature_storage<feature::sprites, std::array<ID3D11Texture2D*, atlas_pages>> _atlas_textures;
+		feature_storage<feature::sprites, std::array<ID3D11ShaderResourceView*, atlas_pages>> _atlas_views;
+		// only ever cleared through, when a page is packed from empty
+		feature_storage<feature::sprites, std::array<ID3D11RenderTargetView*, atlas_pages>> _atlas_targets;
+		ID3D11VertexShader* _sdf_vertex_shader;
+		ID3D11PixelShader* _sdf_pixel_shader;
+		ID3D11InputLayout* _sdf_input_layout;
+		ID3D11BlendState* _alpha_blend_state;
+		ID3D11Buffer* _quad_index_buffer;
+		ring_buffer _vertex_buffer;
+		ring_buffer _index_buffer;
+		ring_buffer _instance_buffer;
+		ring_buffer _glyph_buffer;
+		ring_buffer _sprite_buffer;
+		ring_buffer _shape_buffer;
+		D3D11_RECT _scissor_rect;
+
+		frame_vector<vertex> _vertices;
+		frame_vector<std::uint16_t> _indices;
+		frame_vector<instance> _instances;
+		frame_vector<batch> _batches;
+		feature_storage<feature::text, frame_vector<textured_vertex>> _glyphs;
+		// sprites waiting for end(), expanded into quads one atlas page at a time
+		feature_storage<feature::sprites, frame_vector<sprite>> _sprites;
+		feature_storage<feature::sprites, frame_vector<textured_vertex>> _sprite_vertices;
+		// sdf quads since the last flush
+		feature_storage<feature::shapes, frame_vector<sdf::vertex>> _shapes;
+		// keys and scratch for the radix sort, then the streams rebuilt in sorted order
+		sorting_storage<frame_vector<std::uint64_t>> _sort_keys;
+		sorting_storage<frame_vector<std::uint16_t>> _sorted_indices;
+		sorting_storage<frame_vector<instance>> _sorted_instances;
+		sorting_storage<frame_vector<batch>> _sorted_batches;
+		std::uint8_t _sort_layer;
+		std::conditional_t<(Config::features & feature::text) != 0, text_layout, std::monostate> _text_layout;
+		std::conditional_t<(Config::features & feature::sprites) != 0, sprite_atlas, std::monostate> _atlas;
+		profiler _profiler;
+		std::array<draw_list*, (Config::features & feature::draw_lists) != 0 ? max_draw_lists : 0> _draw_lists;
+		std::size_t _draw_list_count;
+		statistics _stats;
 	};
+
+	using renderer = basic_renderer<default_config>;
 }
\ No newline at end of file
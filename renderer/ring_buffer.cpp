@@ -0,0 +1,130 @@
+#include <bit>
+#include <cstdint>
+#include "ring_buffer.hpp"
+#include "mini_crt.hpp"
+
+namespace rendering
+{
+	bool ring_buffer::create(ID3D11Device* device, UINT bind_flags, UINT stride, UINT capacity)
+	{
+		// a byte width past what a UINT holds would wrap around to a smaller buffer
+		if (capacity > ~0u / stride)
+			return false;
+
+		D3D11_BUFFER_DESC buffer_desc = { };
+		buffer_desc.Usage = D3D11_USAGE_DYNAMIC;
+		buffer_desc.ByteWidth = capacity * stride;
+		buffer_desc.BindFlags = bind_flags;
+		buffer_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		// nothing changes unless the buffer exists, uploads size their copies by _capacity
+		ID3D11Buffer* buffer;
+		if (FAILED(device->CreateBuffer(&buffer_desc, nullptr, &buffer)))
+			return false;
+
+		_buffer = buffer;
+		_bind_flags = bind_flags;
+		_stride = stride;
+		_capacity = capacity;
+		_position = 0u;
+		_frame_usage = 0u;
+		_stats = { };
+		return true;
+	}
+
+	void ring_buffer::release()
+	{
+		if (_buffer)
+			_buffer->Release();
+		_buffer = nullptr;
+	}
+
+	bool ring_buffer::new_frame(ID3D11Device* device)
+	{
+		const auto usage = _frame_usage;
+		_frame_usage = 0u;
+		_stats = { };
+
+		if (usage <= _capacity || !grow(device, usage))
+			return false;
+
+		_stats.grows = 1u;
+		return true;
+	}
+
+	bool ring_buffer::grow(ID3D11Device* device, UINT count)
+	{
+		if (count <= _capacity)
+			return true;
+
+		// the old buffer and its capacity stay if the larger one cannot be created
+		// bit_ceil has no result past the highest power of two a UINT holds
+		const auto old_buffer = _buffer;
+		if (count > 0x80000000u || !create(device, _bind_flags, _stride, std::bit_ceil(count)))
+			return false;
+
+		if (old_buffer)
+			old_buffer->Release();
+		return true;
+	}
+
+	void ring_buffer::rewind()
+	{
+		_position = 0u;
+	}
+
+	bool ring_buffer::upload(ID3D11DeviceContext* device_context, const void* data, UINT count, UINT& start)
+	{
+		// more than the whole buffer is refused, but counted so the next frame grows to fit it
+		if (count > _capacity)
+		{
+			_frame_usage += count;
+			return false;
+		}
+
+		// the gpu may still be reading everything behind _position, so appending
+		// never overwrites it. only a wrap needs a fresh buffer from the driver
+		auto map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+		if (_position + count > _capacity)
+		{
+			map_type = D3D11_MAP_WRITE_DISCARD;
+			_position = 0u;
+			++_stats.wraps;
+		}
+		else if (_position == 0u)
+		{
+			map_type = D3D11_MAP_WRITE_DISCARD;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE ms;
+		if (FAILED(device_context->Map(_buffer, 0u, map_type, 0u, &ms)))
+			return false;
+
+		crt::stream_copy(reinterpret_cast<std::uint8_t*>(ms.pData) + _position * _stride, data, count * _stride);
+		device_context->Unmap(_buffer, 0u);
+
+		start = _position;
+		_position += count;
+		_frame_usage += count;
+
+		++_stats.uploads;
+		_stats.bytes_uploaded += count * _stride;
+
+		return true;
+	}
+
+	ID3D11Buffer* ring_buffer::buffer() const
+	{
+		return _buffer;
+	}
+
+	UINT ring_buffer::capacity() const
+	{
+		return _capacity;
+	}
+
+	const ring_buffer::statistics& ring_buffer::stats() const
+	{
+		return _stats;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#include <d3d11.h>
+
+namespace rendering
+{
+	// dynamic gpu buffer that is appended to with D3D11_MAP_WRITE_NO_OVERWRITE and
+	// only discarded when it wraps. if a frame uploads more than fits, the buffer
+	// is recreated larger at the start of the next frame.
+	class ring_buffer
+	{
+	public:
+		struct statistics
+		{
+			UINT uploads;
+			UINT bytes_uploaded;
+			UINT wraps;
+			UINT grows;
+		};
+
+		bool create(ID3D11Device* device, UINT bind_flags, UINT stride, UINT capacity);
+		void release();
+
+		// grows the buffer if the previous frame did not fit and resets the frame statistics.
+		// returns true if the buffer was recreated and has to be bound again
+		bool new_frame(ID3D11Device* device);
+		// recreates the buffer empty if it holds fewer than count elements. false if that
+		// failed, the old buffer then stays
+		bool grow(ID3D11Device* device, UINT count);
+		// the next upload starts at the front of a discarded buffer
+		void rewind();
+
+		// copies count elements into the buffer, start receives the element they begin at.
+		// false if the map failed or count is more than the whole buffer holds
+		bool upload(ID3D11DeviceContext* device_context, const void* data, UINT count, UINT& start);
+
+		ID3D11Buffer* buffer() const;
+		UINT capacity() const;
+		const statistics& stats() const;
+	private:
+		ID3D11Buffer* _buffer;
+		UINT _bind_flags;
+		UINT _stride;
+		UINT _capacity;
+		UINT _position;
+		UINT _frame_usage;
+		statistics _stats;
+	};
+}
\ No newline at end of file
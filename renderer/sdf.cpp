@@ -0,0 +1,77 @@
+#include <xmmintrin.h>
+#include "sdf.hpp"
+
+namespace rendering
+{
+	namespace sdf
+	{
+		namespace
+		{
+			float min(float a, float b)
+			{
+				return a < b ? a : b;
+			}
+
+			float max(float a, float b)
+			{
+				return a > b ? a : b;
+			}
+
+			float abs(float value)
+			{
+				return value < 0.f ? -value : value;
+			}
+
+			float sqrt(float value)
+			{
+				return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(value)));
+			}
+		}
+
+		shape rounded_box(vec2 half_size, float radius, float thickness)
+		{
+			half_size = { abs(half_size.x), abs(half_size.y) };
+			const auto limit = min(half_size.x, half_size.y);
+			return { half_size, min(max(radius, 0.f), limit), min(max(thickness, 0.f), limit) };
+		}
+
+		shape circle(float radius, float thickness)
+		{
+			radius = abs(radius);
+			return rounded_box({ radius, radius }, radius, thickness);
+		}
+
+		float distance(vec2 local, const shape& shape)
+		{
+			// the corner's circle centre is radius in from each edge, past it the distance
+			// is to that circle, before it to the nearer straight edge
+			const auto qx = abs(local.x) - shape.half_size.x + shape.radius;
+			const auto qy = abs(local.y) - shape.half_size.y + shape.radius;
+			const auto outside_x = max(qx, 0.f);
+			const auto outside_y = max(qy, 0.f);
+			auto d = sqrt(outside_x * outside_x + outside_y * outside_y) + min(max(qx, qy), 0.f) - shape.radius;
+
+			// an outline is the band from the edge inwards, measured from its middle
+			if (shape.thickness > 0.f)
+				d = abs(d + shape.thickness * 0.5f) - shape.thickness * 0.5f;
+			return d;
+		}
+
+		float coverage(vec2 local, const shape& shape)
+		{
+			return min(max(0.5f - distance(local, shape), 0.f), 1.f);
+		}
+
+		void write(vertex* vertices, vec2 centre, const shape& shape, colour colour)
+		{
+			const auto x = shape.half_size.x + fringe;
+			const auto y = shape.half_size.y + fringe;
+			const auto c = pack(colour);
+
+			vertices[0] = { { centre.x - x, centre.y - y }, { -x, -y }, shape, c };
+			vertices[1] = { { centre.x + x, centre.y - y }, { x, -y }, shape, c };
+			vertices[2] = { { centre.x - x, centre.y + y }, { -x, y }, shape, c };
+			vertices[3] = { { centre.x + x, centre.y + y }, { x, y }, shape, c };
+		}
+	}
+}
\ No newline at end of file
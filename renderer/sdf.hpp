@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include "types.hpp"
+
+namespace rendering
+{
+	// circles, rounded boxes and rings drawn as one quad each. the pixel shader measures how
+	// far every pixel is from the shape's edge and fades it out over one pixel, so a shape
+	// costs 4 vertices whatever its size. keep in sync with sdf_vertex.hlsl and sdf_pixel.hlsl
+	namespace sdf
+	{
+		// a box with rounded corners centred on the origin. a circle is a box whose radius is
+		// half its size. with a thickness only the band that far inside the edge is drawn
+		struct shape
+		{
+			vec2 half_size;
+			float radius;
+			float thickness;
+		};
+
+		// local is the corner relative to the shape's centre, interpolated for the pixel shader
+		struct vertex
+		{
+			vec2 pos;
+			vec2 local;
+			sdf::shape shape;
+			std::uint32_t colour;
+		};
+		static_assert(sizeof(vertex) == 36);
+
+		// the quad reaches this far past the edge so the fade outside it is drawn
+		constexpr auto fringe = 1.f;
+
+		// radius and thickness clamped to what the size allows
+		shape rounded_box(vec2 half_size, float radius, float thickness);
+		shape circle(float radius, float thickness);
+
+		// signed distance from the edge, negative inside. the same sums as sdf_pixel.hlsl
+		float distance(vec2 local, const shape& shape);
+		// share of the pixel centred on local that the shape covers, as the shader draws it
+		float coverage(vec2 local, const shape& shape);
+
+		// the quad's 4 corners, indexed 0 1 2 2 1 3 like a glyph
+		void write(vertex* vertices, vec2 centre, const shape& shape, colour colour);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+// shape is half width, half height, corner radius and outline thickness, 0 when filled.
+// keep in sync with sdf::distance
+float rounded_box(float2 local, float4 shape)
+{
+	float2 q = abs(local) - shape.xy + shape.z;
+	float d = length(max(q, 0.f)) + min(max(q.x, q.y), 0.f) - shape.z;
+	return shape.w > 0.f ? abs(d + shape.w * 0.5f) - shape.w * 0.5f : d;
+}
+
+// one pixel wide fade centred on the edge
+float4 main(float4 position : SV_POSITION, float4 colour : COLOUR, float2 local : LOCAL, nointerpolation float4 shape : SHAPE) : SV_TARGET
+{
+	return float4(colour.rgb, colour.a * saturate(0.5f - rounded_box(local, shape)));
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+cbuffer projection_buffer : register(b0)
+{
+	float4x4 projection;
+};
+
+struct vs_input
+{
+	float2 position : POSITION;
+	float2 local : LOCAL;
+	float4 shape : SHAPE;
+	float4 colour : COLOUR;
+};
+
+struct vs_output
+{
+	float4 position : SV_POSITION;
+	float4 colour : COLOUR;
+	float2 local : LOCAL;
+	nointerpolation float4 shape : SHAPE;
+};
+
+vs_output main(vs_input input)
+{
+	vs_output output;
+	output.position = mul(projection, float4(input.position, 0.f, 1.f));
+	output.colour = input.colour;
+	output.local = input.local;
+	output.shape = input.shape;
+	return output;
+}
\ No newline at end of file
@@ -0,0 +1,616 @@
+#include <type_traits>
+#include <emmintrin.h>
+#include "software_renderer.hpp"
+
+namespace rendering
+{
+	namespace
+	{
+		enum primitive_kind : std::uint8_t
+		{
+			kind_point,
+			kind_line,
+			kind_triangle
+		};
+
+		// a template so the branch for the other vertex format is discarded
+		template<typename T>
+		std::uint32_t packed_colour(const T& vertex)
+		{
+			if constexpr (std::is_same_v<T, packed_vertex>)
+				return vertex.colour;
+			else
+				return pack(vertex.colour);
+		}
+
+		std::int32_t floor_int(float value)
+		{
+			const auto whole = static_cast<std::int32_t>(value);
+			return value < static_cast<float>(whole) ? whole - 1 : whole;
+		}
+
+		// source over destination with src alpha, four pixels at once. exact to within one step of 255
+		__m128i blend(__m128i dst, __m128i src)
+		{
+			const auto zero = _mm_setzero_si128();
+			const auto full = _mm_set1_epi16(255);
+			const auto round = _mm_set1_epi16(128);
+
+			auto blend_half = [&](__m128i d, __m128i s)
+			{
+				auto alpha = _mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3));
+				alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+				auto value = _mm_add_epi16(_mm_mullo_epi16(s, alpha), _mm_mullo_epi16(d, _mm_sub_epi16(full, alpha)));
+				value = _mm_add_epi16(value, round);
+				return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+			};
+
+			const auto low = blend_half(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(src, zero));
+			const auto high = blend_half(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(src, zero));
+			return _mm_packus_epi16(low, high);
+		}
+
+		void blend_pixel(std::uint32_t& dst, std::uint32_t src)
+		{
+			dst = static_cast<std::uint32_t>(_mm_cvtsi128_si32(blend(_mm_cvtsi32_si128(static_cast<int>(dst)), _mm_cvtsi32_si128(static_cast<int>(src)))));
+		}
+
+		std::uint32_t lerp_colour(std::uint32_t a, std::uint32_t b, float t)
+		{
+			std::uint32_t result = 0u;
+			for (auto shift = 0u; shift < 32u; shift += 8u)
+			{
+				const auto from = static_cast<float>((a >> shift) & 0xff);
+				const auto to = static_cast<float>((b >> shift) & 0xff);
+				result |= static_cast<std::uint32_t>(from + (to - from) * t + 0.5f) << shift;
+			}
+			return result;
+		}
+	}
+
+	void software_renderer::set_target(std::uint32_t* framebuffer, std::uint32_t width, std::uint32_t height, std::uint32_t pitch)
+	{
+		_framebuffer = framebuffer;
+		_width = width;
+		_height = height;
+		_pitch = pitch;
+		_tiles_x = (width + tile_size - 1) / tile_size;
+		_tiles_y = (height + tile_size - 1) / tile_size;
+		set_bounds(clipping::from({ 0.f, 0.f }, { static_cast<float>(width), static_cast<float>(height) }));
+	}
+
+	void software_renderer::clear(colour colour)
+	{
+		const auto value = pack(colour);
+		for (auto y = 0u; y < _height; ++y)
+			for (auto x = 0u; x < _width; ++x)
+				_framebuffer[y * _pitch + x] = value;
+	}
+
+	void software_renderer::begin()
+	{
+		reset_clip();
+		_stats = { };
+		_vertex_count = 0u;
+		_index_count = 0u;
+		_batch_count = 0u;
+	}
+
+	void software_renderer::end()
+	{
+		flush();
+	}
+
+	void software_renderer::draw(const draw_list& list)
+	{
+		// keep the order everything was recorded in
+		flush();
+
+		for (auto block = 0ull; block < list.block_count(); ++block)
+		{
+			const auto tiles = bin(list.vertices(block), list.indices(block), list.batches(block), list.batch_count(block));
+			rasterize(0u, tiles);
+
+			// instances are not kept in the list unless instancing is on, expand them here
+			if constexpr (default_config::instancing)
+			{
+				for (auto i = 0ull; i < list.instance_count(block); ++i)
+					add_instance(list.instances(block)[i]);
+				flush();
+			}
+		}
+	}
+
+	std::size_t software_renderer::bin()
+	{
+		return bin(_vertices.data(), _indices.data(), _batches.data(), _batch_count);
+	}
+
+	void software_renderer::finish()
+	{
+		_vertex_count = 0u;
+		_index_count = 0u;
+		_batch_count = 0u;
+		_primitive_count = 0u;
+	}
+
+	void software_renderer::flush()
+	{
+		if (_batch_count == 0)
+			return;
+
+		const auto tiles = bin();
+		rasterize(0u, tiles);
+		finish();
+	}
+
+	std::size_t software_renderer::bin(const vertex* vertices, const std::uint16_t* indices, const batch* batches, std::size_t batch_count)
+	{
+		_source_vertices = vertices;
+		_source_indices = indices;
+		_primitive_count = 0u;
+
+		if (!_framebuffer || batch_count == 0)
+			return 0u;
+
+		++_stats.flushes;
+
+		std::size_t first = 0u;
+		for (auto i = 0ull; i < batch_count; ++i)
+		{
+			// an instanced batch counts instances, which draw(const draw_list&) expands itself.
+			// none of them are in the index stream, so first stays put
+			const auto& batch = batches[i];
+			if (batch.shape != shape_type::none)
+				continue;
+
+			const auto end = first + batch.count;
+
+			std::size_t stride;
+			std::uint8_t kind;
+			switch (batch.topology)
+			{
+			case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST:
+				stride = 3u;
+				kind = kind_triangle;
+				_stats.triangles += batch.count / 3;
+				break;
+			case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:
+				stride = 2u;
+				kind = kind_line;
+				_stats.lines += batch.count / 2;
+				break;
+			case D3D11_PRIMITIVE_TOPOLOGY_POINTLIST:
+				stride = 1u;
+				kind = kind_point;
+				_stats.points += batch.count;
+				break;
+			default:
+				// the recorders only ever produce lists
+				first = end;
+				continue;
+			}
+
+			for (auto index = first; index + stride <= end; index += stride)
+			{
+				// bounds in pixels, widened by one so lines and points on an edge reach both tiles
+				auto min_x = _source_vertices[indices[index]].pos.x, max_x = min_x;
+				auto min_y = _source_vertices[indices[index]].pos.y, max_y = min_y;
+				for (auto k = 1u; k < stride; ++k)
+				{
+					const auto pos = _source_vertices[indices[index + k]].pos;
+					min_x = pos.x < min_x ? pos.x : min_x;
+					max_x = pos.x > max_x ? pos.x : max_x;
+					min_y = pos.y < min_y ? pos.y : min_y;
+					max_y = pos.y > max_y ? pos.y : max_y;
+				}
+
+				auto left = floor_int(min_x) - 1, right = floor_int(max_x) + 1;
+				auto top = floor_int(min_y) - 1, bottom = floor_int(max_y) + 1;
+				if (right < 0 || bottom < 0 || left >= static_cast<std::int32_t>(_width) || top >= static_cast<std::int32_t>(_height))
+					continue;
+
+				left = left < 0 ? 0 : left;
+				top = top < 0 ? 0 : top;
+				right = right >= static_cast<std::int32_t>(_width) ? _width - 1 : right;
+				bottom = bottom >= static_cast<std::int32_t>(_height) ? _height - 1 : bottom;
+
+				auto& primitive = _primitives[_primitive_count++];
+				primitive.first = static_cast<std::uint16_t>(index);
+				primitive.kind = kind;
+				primitive.tile_left = static_cast<std::uint16_t>(left / tile_size);
+				primitive.tile_top = static_cast<std::uint16_t>(top / tile_size);
+				primitive.tile_right = static_cast<std::uint16_t>(right / tile_size);
+				primitive.tile_bottom = static_cast<std::uint16_t>(bottom / tile_size);
+			}
+
+			first = end;
+		}
+
+		const auto tiles = static_cast<std::size_t>(_tiles_x) * _tiles_y;
+		_binned = false;
+		if (tiles > max_tiles)
+			return tiles;
+
+		std::size_t total = 0u;
+		for (auto i = 0ull; i < _primitive_count; ++i)
+		{
+			const auto& primitive = _primitives[i];
+			total += (primitive.tile_right - primitive.tile_left + 1u) * (primitive.tile_bottom - primitive.tile_top + 1u);
+		}
+		if (total > max_bin_entries)
+			return tiles;
+
+		// counting sort. counts become bin ends, then filling backwards from each end
+		// leaves every bin in submission order and its offset at the bin's start
+		for (auto tile = 0ull; tile <= tiles; ++tile)
+			_bin_offsets[tile] = 0u;
+
+		for (auto i = 0ull; i < _primitive_count; ++i)
+		{
+			const auto& primitive = _primitives[i];
+			for (auto y = primitive.tile_top; y <= primitive.tile_bottom; ++y)
+				for (auto x = primitive.tile_left; x <= primitive.tile_right; ++x)
+					++_bin_offsets[y * _tiles_x + x];
+		}
+
+		for (auto tile = 1ull; tile <= tiles; ++tile)
+			_bin_offsets[tile] += _bin_offsets[tile - 1];
+
+		for (auto i = _primitive_count; i-- > 0;)
+		{
+			const auto& primitive = _primitives[i];
+			for (auto y = primitive.tile_top; y <= primitive.tile_bottom; ++y)
+				for (auto x = primitive.tile_left; x <= primitive.tile_right; ++x)
+					_bin_entries[--_bin_offsets[y * _tiles_x + x]] = static_cast<std::uint16_t>(i);
+		}
+
+		_binned = true;
+		return tiles;
+	}
+
+	void software_renderer::rasterize(std::size_t first_tile, std::size_t tile_count)
+	{
+		for (auto tile = first_tile; tile < first_tile + tile_count; ++tile)
+		{
+			const auto tile_x = static_cast<std::uint32_t>(tile % _tiles_x);
+			const auto tile_y = static_cast<std::uint32_t>(tile / _tiles_x);
+
+			// pixel rect of the tile, right and bottom exclusive
+			const auto left = static_cast<std::int32_t>(tile_x * tile_size);
+			const auto top = static_cast<std::int32_t>(tile_y * tile_size);
+			const auto right = static_cast<std::int32_t>(tile_x * tile_size + tile_size > _width ? _width : tile_x * tile_size + tile_size);
+			const auto bottom = static_cast<std::int32_t>(tile_y * tile_size + tile_size > _height ? _height : tile_y * tile_size + tile_size);
+
+			// primitives stay in submission order within a tile so blending matches the gpu
+			const auto first = _binned ? _bin_offsets[tile] : 0u;
+			const auto last = _binned ? _bin_offsets[tile + 1] : _primitive_count;
+			for (auto i = first; i < last; ++i)
+			{
+				const auto& primitive = _primitives[_binned ? _bin_entries[i] : i];
+				if (tile_x < primitive.tile_left || tile_x > primitive.tile_right || tile_y < primitive.tile_top || tile_y > primitive.tile_bottom)
+					continue;
+
+				switch (primitive.kind)
+				{
+				case kind_triangle:
+					triangle(primitive, left, top, right, bottom);
+					break;
+				case kind_line:
+					line(primitive, left, top, right, bottom);
+					break;
+				default:
+					point(primitive, left, top, right, bottom);
+					break;
+				}
+			}
+		}
+	}
+
+	void software_renderer::triangle(const primitive& primitive, std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom)
+	{
+		const vertex* v[3] =
+		{
+			&_source_vertices[_source_indices[primitive.first]],
+			&_source_vertices[_source_indices[primitive.first + 1]],
+			&_source_vertices[_source_indices[primitive.first + 2]]
+		};
+
+		auto area = (v[1]->pos.x - v[0]->pos.x) * (v[2]->pos.y - v[0]->pos.y) - (v[1]->pos.y - v[0]->pos.y) * (v[2]->pos.x - v[0]->pos.x);
+		if (area == 0.f)
+			return;
+
+		// no culling, either winding is turned into a positive area
+		if (area < 0.f)
+		{
+			const auto swap = v[1];
+			v[1] = v[2];
+			v[2] = swap;
+			area = -area;
+		}
+
+		// edge i is opposite vertex i, e(p) = a * x + b * y + c is positive inside
+		float a[3], b[3], c[3];
+		bool top_left[3];
+		for (auto i = 0u; i < 3u; ++i)
+		{
+			const auto from = v[(i + 1) % 3]->pos;
+			const auto to = v[(i + 2) % 3]->pos;
+			a[i] = from.y - to.y;
+			b[i] = to.x - from.x;
+			c[i] = -(a[i] * from.x + b[i] * from.y);
+
+			// pixels exactly on a shared edge belong to the top or left triangle only
+			top_left[i] = (a[i] == 0.f && b[i] > 0.f) || a[i] > 0.f;
+		}
+
+		// pixel centres inside the bounds and the tile
+		auto min_x = v[0]->pos.x, max_x = min_x, min_y = v[0]->pos.y, max_y = min_y;
+		for (auto i = 1u; i < 3u; ++i)
+		{
+			min_x = v[i]->pos.x < min_x ? v[i]->pos.x : min_x;
+			max_x = v[i]->pos.x > max_x ? v[i]->pos.x : max_x;
+			min_y = v[i]->pos.y < min_y ? v[i]->pos.y : min_y;
+			max_y = v[i]->pos.y > max_y ? v[i]->pos.y : max_y;
+		}
+
+		// centres on the min bounds are kept, the edge functions decide who owns them
+		auto x0 = -floor_int(0.5f - min_x), x1 = floor_int(max_x - 0.5f) + 1;
+		auto y0 = -floor_int(0.5f - min_y), y1 = floor_int(max_y - 0.5f) + 1;
+		x0 = x0 < left ? left : x0;
+		y0 = y0 < top ? top : y0;
+		x1 = x1 > right ? right : x1;
+		y1 = y1 > bottom ? bottom : y1;
+		if (x0 >= x1 || y0 >= y1)
+			return;
+
+		const std::uint32_t colours[3] = { packed_colour(*v[0]), packed_colour(*v[1]), packed_colour(*v[2]) };
+		const auto flat = colours[0] == colours[1] && colours[1] == colours[2];
+
+		// per channel colours pre-divided by the area so the edge values weight them directly
+		__m128 channels[3][4];
+		if (!flat)
+		{
+			const auto inverse_area = 1.f / area;
+			for (auto i = 0u; i < 3u; ++i)
+				for (auto k = 0u; k < 4u; ++k)
+					channels[i][k] = _mm_set1_ps(static_cast<float>((colours[i] >> (k * 8u)) & 0xff) * inverse_area);
+		}
+
+		const auto lane = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+		const auto lane_index = _mm_setr_epi32(0, 1, 2, 3);
+		const auto zero = _mm_setzero_ps();
+		const auto flat_colour = _mm_set1_epi32(static_cast<int>(colours[0]));
+
+		// edge values are stepped across the span instead of evaluated per pixel
+		__m128 step[3], row_start[3];
+		const auto first_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(x0)), lane);
+		for (auto i = 0u; i < 3u; ++i)
+		{
+			step[i] = _mm_set1_ps(a[i] * 4.f);
+			row_start[i] = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[i]), first_x), _mm_set1_ps(b[i] * (static_cast<float>(y0) + 0.5f) + c[i]));
+		}
+
+		for (auto y = y0; y < y1; ++y)
+		{
+			auto row = _framebuffer + static_cast<std::size_t>(y) * _pitch;
+			__m128 w[3] = { row_start[0], row_start[1], row_start[2] };
+
+			for (auto x = x0; x < x1; x += 4)
+			{
+				auto inside = top_left[0] ? _mm_cmpge_ps(w[0], zero) : _mm_cmpgt_ps(w[0], zero);
+				inside = _mm_and_ps(inside, top_left[1] ? _mm_cmpge_ps(w[1], zero) : _mm_cmpgt_ps(w[1], zero));
+				inside = _mm_and_ps(inside, top_left[2] ? _mm_cmpge_ps(w[2], zero) : _mm_cmpgt_ps(w[2], zero));
+
+				// lanes past the end of the span
+				const auto remaining = x1 - x;
+				if (remaining < 4)
+					inside = _mm_and_ps(inside, _mm_castsi128_ps(_mm_cmplt_epi32(lane_index, _mm_set1_epi32(remaining))));
+
+				if (_mm_movemask_ps(inside))
+				{
+					auto src = flat_colour;
+					if (!flat)
+					{
+						__m128i channel[4];
+						for (auto k = 0u; k < 4u; ++k)
+						{
+							const auto value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w[0], channels[0][k]), _mm_mul_ps(w[1], channels[1][k])), _mm_mul_ps(w[2], channels[2][k]));
+							channel[k] = _mm_cvtps_epi32(value);
+						}
+						src = _mm_or_si128(_mm_or_si128(channel[0], _mm_slli_epi32(channel[1], 8)), _mm_or_si128(_mm_slli_epi32(channel[2], 16), _mm_slli_epi32(channel[3], 24)));
+					}
+
+					// partial spans go through a copy so nothing past the row end is touched
+					alignas(16) std::uint32_t span[4];
+					const auto target = remaining < 4 ? span : row + x;
+					if (remaining < 4)
+						for (auto i = 0; i < remaining; ++i)
+							span[i] = row[x + i];
+
+					const auto mask = _mm_castps_si128(inside);
+					const auto dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(target));
+					const auto result = _mm_or_si128(_mm_and_si128(mask, blend(dst, src)), _mm_andnot_si128(mask, dst));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(target), result);
+
+					if (remaining < 4)
+						for (auto i = 0; i < remaining; ++i)
+							row[x + i] = span[i];
+				}
+
+				w[0] = _mm_add_ps(w[0], step[0]);
+				w[1] = _mm_add_ps(w[1], step[1]);
+				w[2] = _mm_add_ps(w[2], step[2]);
+			}
+
+			for (auto i = 0u; i < 3u; ++i)
+				row_start[i] = _mm_add_ps(row_start[i], _mm_set1_ps(b[i]));
+		}
+	}
+
+	void software_renderer::line(const primitive& primitive, std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom)
+	{
+		const auto& from = _source_vertices[_source_indices[primitive.first]];
+		const auto& to = _source_vertices[_source_indices[primitive.first + 1]];
+		const auto from_colour = packed_colour(from);
+		const auto to_colour = packed_colour(to);
+
+		const auto dx = to.pos.x - from.pos.x;
+		const auto dy = to.pos.y - from.pos.y;
+		const auto x_major = (dx < 0.f ? -dx : dx) >= (dy < 0.f ? -dy : dy);
+		const auto length = x_major ? dx : dy;
+		if (length == 0.f)
+			return;
+
+		// one pixel per column or row whose centre lies within [start, end) along the major axis
+		const auto start = x_major ? from.pos.x : from.pos.y;
+		const auto lower = length > 0.f ? start : start + length;
+		const auto upper = length > 0.f ? start + length : start;
+		auto first = floor_int(lower - 0.5f) + 1;
+		auto last = floor_int(upper - 0.5f) + 1;
+
+		const auto minor_lo = x_major ? top : left;
+		const auto minor_hi = x_major ? bottom : right;
+		first = first < (x_major ? left : top) ? (x_major ? left : top) : first;
+		last = last > (x_major ? right : bottom) ? (x_major ? right : bottom) : last;
+
+		const auto slope = (x_major ? dy : dx) / length;
+		const auto minor_start = x_major ? from.pos.y : from.pos.x;
+
+		for (auto major = first; major < last; ++major)
+		{
+			const auto t = (static_cast<float>(major) + 0.5f - start) / length;
+			const auto minor = floor_int(minor_start + slope * (static_cast<float>(major) + 0.5f - start));
+			if (minor < minor_lo || minor >= minor_hi)
+				continue;
+
+			const auto x = x_major ? major : minor;
+			const auto y = x_major ? minor : major;
+			const auto colour = from_colour == to_colour ? from_colour : lerp_colour(from_colour, to_colour, t);
+			blend_pixel(_framebuffer[static_cast<std::size_t>(y) * _pitch + x], colour);
+		}
+	}
+
+	void software_renderer::point(const primitive& primitive, std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom)
+	{
+		const auto& vertex = _source_vertices[_source_indices[primitive.first]];
+		const auto x = floor_int(vertex.pos.x);
+		const auto y = floor_int(vertex.pos.y);
+		if (x < left || x >= right || y < top || y >= bottom)
+			return;
+
+		blend_pixel(_framebuffer[static_cast<std::size_t>(y) * _pitch + x], packed_colour(vertex));
+	}
+
+	bool software_renderer::allocate(std::size_t vertex_count, std::size_t index_count, geometry& geometry)
+	{
+		if (vertex_count == 0 || index_count == 0 || vertex_count > _vertices.size() || index_count > _indices.size())
+			return false;
+
+		if (_vertex_count + vertex_count > _vertices.size() || _index_count + index_count > _indices.size() || _batch_count == _batches.size())
+			flush();
+
+		geometry.vertices = &_vertices[_vertex_count];
+		geometry.indices = &_indices[_index_count];
+		geometry.base = static_cast<std::uint16_t>(_vertex_count);
+
+		_vertex_count += vertex_count;
+		_index_count += index_count;
+		return true;
+	}
+
+	void software_renderer::add_batch(std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		const auto mergeable = topology == D3D11_PRIMITIVE_TOPOLOGY_POINTLIST
+			|| topology == D3D11_PRIMITIVE_TOPOLOGY_LINELIST
+			|| topology == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+
+		const auto last = _batch_count ? &_batches[_batch_count - 1] : nullptr;
+		if (mergeable && last && last->topology == topology)
+			last->count += index_count;
+		else
+			_batches[_batch_count++] = batch(index_count, topology);
+	}
+
+	void software_renderer::add_instance(const instance& instance)
+	{
+		// there is no vertex shader to expand instances, so they become triangles here
+		const colour colour = { (instance.colour & 0xff) / 255.f, ((instance.colour >> 8) & 0xff) / 255.f, ((instance.colour >> 16) & 0xff) / 255.f, ((instance.colour >> 24) & 0xff) / 255.f };
+		const auto c = vertex_colour(colour);
+		geometry geometry;
+
+		auto quad = [&](vec2 p0, vec2 p1, vec2 p2, vec2 p3)
+		{
+			if (!allocate(4, 6, geometry))
+				return;
+
+			geometry.vertices[0] = { p0, c };
+			geometry.vertices[1] = { p1, c };
+			geometry.vertices[2] = { p2, c };
+			geometry.vertices[3] = { p3, c };
+
+			const std::uint16_t indices[6] = { 0, 1, 2, 2, 1, 3 };
+			for (auto i = 0u; i < 6u; ++i)
+				geometry.indices[i] = geometry.base + indices[i];
+			add_batch(6, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		};
+
+		auto rect = [&](vec2 pos, vec2 size)
+		{
+			quad(pos, { pos.x + size.x, pos.y }, { pos.x, pos.y + size.y }, pos + size);
+		};
+
+		const auto a = instance.a;
+		const auto b = instance.b;
+		const auto t = instance.thickness;
+
+		switch (instance.type)
+		{
+		case shape_type::filled_box:
+			rect(a, b);
+			break;
+		case shape_type::box:
+			// same edge split as instanced_vertex.hlsl
+			rect(a, { b.x, t });
+			rect({ a.x, a.y + b.y - t }, { b.x, t });
+			rect({ a.x, a.y + t }, { t, b.y - 2.f * t });
+			rect({ a.x + b.x - t, a.y + t }, { t, b.y - 2.f * t });
+			break;
+		case shape_type::line:
+		{
+			const auto dx = b.x - a.x, dy = b.y - a.y;
+			const auto length = _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(dx * dx + dy * dy)));
+			const auto nx = length > 0.f ? -dy / length * t * 0.5f : 0.f;
+			const auto ny = length > 0.f ? dx / length * t * 0.5f : t * 0.5f;
+			quad({ a.x - nx, a.y - ny }, { b.x - nx, b.y - ny }, { a.x + nx, a.y + ny }, { b.x + nx, b.y + ny });
+			break;
+		}
+		case shape_type::circle:
+		{
+			const auto segments = tessellation::segments(b.x, circle_error);
+			if (t > 0.f)
+			{
+				if (!allocate(segments, segments * 2, geometry))
+					return;
+				tessellation::ellipse(geometry.vertices, geometry.indices, geometry.base, a, { b.x, b.x }, segments, colour);
+				add_batch(segments * 2, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+			}
+			else
+			{
+				if (!allocate(segments + 1, segments * 3, geometry))
+					return;
+				tessellation::filled_ellipse(geometry.vertices, geometry.indices, geometry.base, a, { b.x, b.x }, segments, colour);
+				add_batch(segments * 3, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	const software_renderer::statistics& software_renderer::stats() const
+	{
+		return _stats;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "recorder.hpp"
+#include "draw_list.hpp"
+
+namespace rendering
+{
+	// cpu backend behind the same begin/draw_*/end interface, rasterizing into a caller owned
+	// RGBA8 framebuffer laid out like pack(). primitives are binned to 64x64 pixel tiles and
+	// triangles are filled four pixels at a time with sse edge functions. it is large, so like
+	// draw_list it belongs in static storage
+	class software_renderer : public recorder<software_renderer>
+	{
+		friend class recorder<software_renderer>;
+	public:
+		static constexpr std::uint32_t tile_size = 64u;
+
+		struct statistics
+		{
+			std::size_t flushes;
+			std::size_t triangles;
+			std::size_t lines;
+			std::size_t points;
+		};
+
+		// pitch is in pixels
+		void set_target(std::uint32_t* framebuffer, std::uint32_t width, std::uint32_t height, std::uint32_t pitch);
+		void clear(colour colour);
+
+		void begin();
+		void end();
+
+		// rasterizes a finished list after everything recorded so far
+		void draw(const draw_list& list);
+
+		// end() in parts so the host can spread tiles over its own threads. bin() returns the
+		// tile count, rasterize() may then run concurrently on disjoint tile ranges, and
+		// finish() clears the recorded geometry once they are all done
+		std::size_t bin();
+		void rasterize(std::size_t first_tile, std::size_t tile_count);
+		void finish();
+
+		void add_instance(const instance& instance);
+
+		// counters for the current frame, reset in begin()
+		const statistics& stats() const;
+	private:
+		static constexpr auto max_batches = max_vertices / 4;
+		static constexpr auto max_primitives = max_indices;
+		// enough for 4k at 64 pixel tiles. past either limit a flush scans every primitive per tile
+		static constexpr auto max_tiles = 4096;
+		static constexpr auto max_bin_entries = 16384;
+
+		// a primitive's first index and the range of tiles its bounds touch
+		struct primitive
+		{
+			std::uint16_t first;
+			std::uint8_t kind;
+			std::uint16_t tile_left;
+			std::uint16_t tile_top;
+			std::uint16_t tile_right;
+			std::uint16_t tile_bottom;
+		};
+
+		bool allocate(std::size_t vertex_count, std::size_t index_count, geometry& geometry);
+		void add_batch(std::size_t index_count, D3D11_PRIMITIVE_TOPOLOGY topology);
+
+		std::size_t bin(const vertex* vertices, const std::uint16_t* indices, const batch* batches, std::size_t batch_count);
+		void flush();
+
+		void triangle(const primitive& primitive, std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom);
+		void line(const primitive& primitive, std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom);
+		void point(const primitive& primitive, std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom);
+
+		std::uint32_t* _framebuffer;
+		std::uint32_t _width;
+		std::uint32_t _height;
+		std::uint32_t _pitch;
+		std::uint32_t _tiles_x;
+		std::uint32_t _tiles_y;
+
+		// the stream being rasterized, either the recorded geometry or a draw_list
+		const vertex* _source_vertices;
+		const std::uint16_t* _source_indices;
+		std::size_t _primitive_count;
+		std::array<primitive, max_primitives> _primitives;
+
+		// primitive indices grouped by tile in submission order, tile t owns [offsets[t], offsets[t + 1])
+		bool _binned;
+		std::array<std::uint32_t, max_tiles + 1> _bin_offsets;
+		std::array<std::uint16_t, max_bin_entries> _bin_entries;
+
+		std::size_t _vertex_count;
+		std::size_t _index_count;
+		std::size_t _batch_count;
+		std::array<vertex, max_vertices> _vertices;
+		std::array<std::uint16_t, max_indices> _indices;
+		std::array<batch, max_batches> _batches;
+		statistics _stats;
+	};
+}
\ No newline at end of file
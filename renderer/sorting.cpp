@@ -0,0 +1,46 @@
+#include <array>
+#include "sorting.hpp"
+
+namespace rendering
+{
+	namespace sorting
+	{
+		std::uint64_t* radix_sort(std::uint64_t* keys, std::uint64_t* scratch, std::size_t count)
+		{
+			if (count < 2)
+				return keys;
+
+			// bytes that differ between any two keys, the rest are already in order
+			auto differ = 0ull;
+			for (auto i = 1ull; i < count; ++i)
+				differ |= keys[i] ^ keys[0];
+
+			for (auto shift = 0u; shift < 64u; shift += 8u)
+			{
+				if (!((differ >> shift) & 0xff))
+					continue;
+
+				std::array<std::uint32_t, 256> offsets = { };
+				for (auto i = 0ull; i < count; ++i)
+					++offsets[(keys[i] >> shift) & 0xff];
+
+				auto total = 0u;
+				for (auto& offset : offsets)
+				{
+					const auto bucket = offset;
+					offset = total;
+					total += bucket;
+				}
+
+				for (auto i = 0ull; i < count; ++i)
+					scratch[offsets[(keys[i] >> shift) & 0xff]++] = keys[i];
+
+				const auto sorted = scratch;
+				scratch = keys;
+				keys = sorted;
+			}
+
+			return keys;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <d3d11.h>
+#include "instance.hpp"
+
+namespace rendering
+{
+	namespace sorting
+	{
+		// triangles first so outlines drawn in the same layer stay on top of fills
+		constexpr std::uint8_t topology_rank(D3D11_PRIMITIVE_TOPOLOGY topology)
+		{
+			switch (topology)
+			{
+			case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST:
+				return 0;
+			case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:
+				return 1;
+			case D3D11_PRIMITIVE_TOPOLOGY_POINTLIST:
+				return 2;
+			default:
+				return 3;
+			}
+		}
+
+		// most significant first: sort layer, pipeline (indexed or an instanced shape), topology,
+		// a byte reserved for textures and shaders, then the submission sequence so equal state
+		// keeps its recorded order
+		constexpr std::uint64_t make_key(std::uint8_t sort_layer, shape_type shape, D3D11_PRIMITIVE_TOPOLOGY topology, std::uint32_t sequence)
+		{
+			return static_cast<std::uint64_t>(sort_layer) << 56
+				| static_cast<std::uint64_t>(static_cast<std::uint8_t>(shape)) << 48
+				| static_cast<std::uint64_t>(topology_rank(topology)) << 40
+				| sequence;
+		}
+
+		// the state bytes left at 0, so a layer keeps its submission order
+		constexpr std::uint64_t make_key(std::uint8_t sort_layer, std::uint32_t sequence)
+		{
+			return static_cast<std::uint64_t>(sort_layer) << 56 | sequence;
+		}
+
+		constexpr std::uint32_t sequence(std::uint64_t key)
+		{
+			return static_cast<std::uint32_t>(key);
+		}
+
+		// lsd radix sort a byte at a time, skipping bytes every key shares. scratch must hold
+		// count keys, returns whichever of the two buffers ends up holding the result
+		std::uint64_t* radix_sort(std::uint64_t* keys, std::uint64_t* scratch, std::size_t count);
+	}
+}
\ No newline at end of file
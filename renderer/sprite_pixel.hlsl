@@ -0,0 +1,8 @@
+Texture2D atlas : register(t0);
+SamplerState atlas_sampler : register(s0);
+
+// the atlas page holds the image, the vertex colour tints it
+float4 main(float4 position : SV_POSITION, float4 colour : COLOUR, float2 uv : TEXCOORD) : SV_TARGET
+{
+	return atlas.Sample(atlas_sampler, uv) * colour;
+}
\ No newline at end of file
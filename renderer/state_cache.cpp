@@ -0,0 +1,263 @@
+#include "state_cache.hpp"
+
+namespace rendering
+{
+	void state_saver::backup(ID3D11DeviceContext* device_context, std::uint32_t pieces)
+	{
+		_device_context = device_context;
+		pieces &= ~_saved;
+		_saved |= pieces;
+
+		if (pieces & topology)
+			_device_context->IAGetPrimitiveTopology(&_primitive_topology);
+		if (pieces & vertex_shader)
+		{
+			_vertex_shader.instance_count = 256u;
+			_device_context->VSGetShader(&_vertex_shader.shader, _vertex_shader.instances, &_vertex_shader.instance_count);
+		}
+		if (pieces & pixel_shader)
+		{
+			_pixel_shader.instance_count = 256u;
+			_device_context->PSGetShader(&_pixel_shader.shader, _pixel_shader.instances, &_pixel_shader.instance_count);
+		}
+		if (pieces & constant_buffer)
+			_device_context->VSGetConstantBuffers(0u, 1u, &_constant_buffer);
+		if (pieces & vertex_buffer)
+			_device_context->IAGetVertexBuffers(0u, 1u, &_vertex_buffer.buffer, &_vertex_buffer.stride, &_vertex_buffer.offset);
+		if (pieces & index_buffer)
+			_device_context->IAGetIndexBuffer(&_index_buffer.buffer, &_index_buffer.format, &_index_buffer.offset);
+		if (pieces & input_layout)
+			_device_context->IAGetInputLayout(&_input_layout);
+		if (pieces & blend_state)
+			_device_context->OMGetBlendState(&_blend_state.state, _blend_state.factor, &_blend_state.sample_mask);
+		if (pieces & shader_resource)
+			_device_context->PSGetShaderResources(0u, 1u, &_shader_resource);
+		if (pieces & sampler)
+			_device_context->PSGetSamplers(0u, 1u, &_sampler);
+		if (pieces & rasterizer_state)
+			_device_context->RSGetState(&_rasterizer_state);
+		if (pieces & scissor_rects)
+		{
+			_scissor_rect_count = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+			_device_context->RSGetScissorRects(&_scissor_rect_count, _scissor_rects);
+		}
+		if (pieces & render_targets)
+			_device_context->OMGetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, _render_targets.views, &_render_targets.depth_stencil);
+	}
+
+	void state_saver::restore()
+	{
+		auto release = [](auto* object)
+		{
+			if (object)
+				object->Release();
+		};
+
+		if (_saved & topology)
+			_device_context->IASetPrimitiveTopology(_primitive_topology);
+		if (_saved & vertex_shader)
+		{
+			_device_context->VSSetShader(_vertex_shader.shader, _vertex_shader.instances, _vertex_shader.instance_count);
+			release(_vertex_shader.shader);
+			for (auto i = 0u; i < _vertex_shader.instance_count; ++i)
+				release(_vertex_shader.instances[i]);
+		}
+		if (_saved & pixel_shader)
+		{
+			_device_context->PSSetShader(_pixel_shader.shader, _pixel_shader.instances, _pixel_shader.instance_count);
+			release(_pixel_shader.shader);
+			for (auto i = 0u; i < _pixel_shader.instance_count; ++i)
+				release(_pixel_shader.instances[i]);
+		}
+		if (_saved & constant_buffer)
+		{
+			_device_context->VSSetConstantBuffers(0u, 1u, &_constant_buffer);
+			release(_constant_buffer);
+		}
+		if (_saved & vertex_buffer)
+		{
+			_device_context->IASetVertexBuffers(0u, 1u, &_vertex_buffer.buffer, &_vertex_buffer.stride, &_vertex_buffer.offset);
+			release(_vertex_buffer.buffer);
+		}
+		if (_saved & index_buffer)
+		{
+			_device_context->IASetIndexBuffer(_index_buffer.buffer, _index_buffer.format, _index_buffer.offset);
+			release(_index_buffer.buffer);
+		}
+		if (_saved & input_layout)
+		{
+			_device_context->IASetInputLayout(_input_layout);
+			release(_input_layout);
+		}
+		if (_saved & blend_state)
+		{
+			_device_context->OMSetBlendState(_blend_state.state, _blend_state.factor, _blend_state.sample_mask);
+			release(_blend_state.state);
+		}
+		if (_saved & shader_resource)
+		{
+			_device_context->PSSetShaderResources(0u, 1u, &_shader_resource);
+			release(_shader_resource);
+		}
+		if (_saved & sampler)
+		{
+			_device_context->PSSetSamplers(0u, 1u, &_sampler);
+			release(_sampler);
+		}
+		if (_saved & rasterizer_state)
+		{
+			_device_context->RSSetState(_rasterizer_state);
+			release(_rasterizer_state);
+		}
+		if (_saved & scissor_rects)
+			_device_context->RSSetScissorRects(_scissor_rect_count, _scissor_rects);
+		if (_saved & render_targets)
+		{
+			_device_context->OMSetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, _render_targets.views, _render_targets.depth_stencil);
+			for (auto* view : _render_targets.views)
+				release(view);
+			release(_render_targets.depth_stencil);
+		}
+
+		_saved = 0u;
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::begin(ID3D11DeviceContext* device_context)
+	{
+		_device_context = device_context;
+		_bound = 0u;
+		_stats = { };
+
+		if constexpr (!Lazy)
+			_state_saver.backup(device_context, state_saver::all);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::end()
+	{
+		_state_saver.restore();
+	}
+
+	template<bool Lazy>
+	template<typename T>
+	bool basic_state_cache<Lazy>::changed(T& current, const T& value, state_saver::piece piece)
+	{
+		if ((_bound & piece) && current == value)
+		{
+			++_stats.skipped;
+			return false;
+		}
+
+		if constexpr (Lazy)
+			_state_saver.backup(_device_context, piece);
+
+		current = value;
+		_bound |= piece;
+		++_stats.calls;
+		return true;
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_topology(D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		if (changed(_topology, topology, state_saver::topology))
+			_device_context->IASetPrimitiveTopology(topology);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_vertex_shader(ID3D11VertexShader* shader)
+	{
+		if (changed(_vertex_shader, shader, state_saver::vertex_shader))
+			_device_context->VSSetShader(shader, nullptr, 0u);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_pixel_shader(ID3D11PixelShader* shader)
+	{
+		if (changed(_pixel_shader, shader, state_saver::pixel_shader))
+			_device_context->PSSetShader(shader, nullptr, 0u);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_input_layout(ID3D11InputLayout* input_layout)
+	{
+		if (changed(_input_layout, input_layout, state_saver::input_layout))
+			_device_context->IASetInputLayout(input_layout);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_vertex_buffer(ID3D11Buffer* buffer, UINT stride)
+	{
+		if (changed(_vertex_buffer, { buffer, stride }, state_saver::vertex_buffer))
+		{
+			UINT offset = 0u;
+			_device_context->IASetVertexBuffers(0u, 1u, &buffer, &stride, &offset);
+		}
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_index_buffer(ID3D11Buffer* buffer)
+	{
+		if (changed(_index_buffer, buffer, state_saver::index_buffer))
+			_device_context->IASetIndexBuffer(buffer, DXGI_FORMAT_R16_UINT, 0u);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_constant_buffer(ID3D11Buffer* buffer)
+	{
+		if (changed(_constant_buffer, buffer, state_saver::constant_buffer))
+			_device_context->VSSetConstantBuffers(0u, 1u, &buffer);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_blend_state(ID3D11BlendState* state)
+	{
+		if (changed(_blend_state, state, state_saver::blend_state))
+			_device_context->OMSetBlendState(state, nullptr, 0xffffffffu);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_shader_resource(ID3D11ShaderResourceView* view)
+	{
+		if (changed(_shader_resource, view, state_saver::shader_resource))
+			_device_context->PSSetShaderResources(0u, 1u, &view);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_sampler(ID3D11SamplerState* sampler)
+	{
+		if (changed(_sampler, sampler, state_saver::sampler))
+			_device_context->PSSetSamplers(0u, 1u, &sampler);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_rasterizer_state(ID3D11RasterizerState* state)
+	{
+		if (changed(_rasterizer_state, state, state_saver::rasterizer_state))
+			_device_context->RSSetState(state);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_scissor_rect(const D3D11_RECT& rect)
+	{
+		if (changed(_scissor_rect, { rect }, state_saver::scissor_rects))
+			_device_context->RSSetScissorRects(1u, &rect);
+	}
+
+	template<bool Lazy>
+	void basic_state_cache<Lazy>::set_render_target(ID3D11RenderTargetView* view)
+	{
+		if (changed(_render_target, view, state_saver::render_targets))
+			_device_context->OMSetRenderTargets(1u, &view, nullptr);
+	}
+
+	template<bool Lazy>
+	const typename basic_state_cache<Lazy>::statistics& basic_state_cache<Lazy>::stats() const
+	{
+		return _stats;
+	}
+
+	template class basic_state_cache<true>;
+	template class basic_state_cache<false>;
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <d3d11.h>
+#include "config.hpp"
+
+namespace rendering
+{
+	// the game's pipeline state, read before the renderer changes it and put back afterwards
+	class state_saver
+	{
+	public:
+		enum piece : std::uint32_t
+		{
+			topology = 1u << 0,
+			vertex_shader = 1u << 1,
+			pixel_shader = 1u << 2,
+			input_layout = 1u << 3,
+			vertex_buffer = 1u << 4,
+			index_buffer = 1u << 5,
+			constant_buffer = 1u << 6,
+			blend_state = 1u << 7,
+			shader_resource = 1u << 8,
+			sampler = 1u << 9,
+			rasterizer_state = 1u << 10,
+			scissor_rects = 1u << 11,
+			render_targets = 1u << 12,
+			all = (1u << 13) - 1u
+		};
+
+		// pieces already saved since the last restore() are kept as they were
+		void backup(ID3D11DeviceContext* device_context, std::uint32_t pieces);
+		// sets and releases only what was saved
+		void restore();
+	private:
+		template<typename T>
+		struct shader
+		{
+			T* shader;
+			ID3D11ClassInstance* instances[256];
+			UINT instance_count;
+		};
+
+		struct saved_vertex_buffer
+		{
+			ID3D11Buffer* buffer;
+			UINT stride;
+			UINT offset;
+		};
+
+		struct saved_index_buffer
+		{
+			ID3D11Buffer* buffer;
+			DXGI_FORMAT format;
+			UINT offset;
+		};
+
+		struct saved_blend_state
+		{
+			ID3D11BlendState* state;
+			float factor[4];
+			UINT sample_mask;
+		};
+
+		struct saved_render_targets
+		{
+			ID3D11RenderTargetView* views[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT];
+			ID3D11DepthStencilView* depth_stencil;
+		};
+
+		ID3D11DeviceContext* _device_context;
+		std::uint32_t _saved { };
+		D3D11_PRIMITIVE_TOPOLOGY _primitive_topology;
+		shader<ID3D11VertexShader> _vertex_shader;
+		shader<ID3D11PixelShader> _pixel_shader;
+		ID3D11InputLayout* _input_layout;
+		ID3D11Buffer* _constant_buffer;
+		saved_vertex_buffer _vertex_buffer;
+		saved_index_buffer _index_buffer;
+		saved_blend_state _blend_state;
+		ID3D11ShaderResourceView* _shader_resource;
+		ID3D11SamplerState* _sampler;
+		ID3D11RasterizerState* _rasterizer_state;
+		D3D11_RECT _scissor_rects[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+		UINT _scissor_rect_count;
+		saved_render_targets _render_targets;
+	};
+
+	// everything the renderer binds goes through here. it remembers what it bound during the
+	// frame and drops calls that would bind the same thing again. when Lazy each piece of the
+	// game's state is only saved the first time the frame changes it, so end() puts back
+	// exactly what was touched
+	template<bool Lazy>
+	class basic_state_cache
+	{
+	public:
+		struct statistics
+		{
+			// calls made to the device context, and calls dropped because nothing changed
+			std::size_t calls;
+			std::size_t skipped;
+		};
+
+		// saves the game's state, or nothing yet when lazy, and forgets what was bound
+		void begin(ID3D11DeviceContext* device_context);
+		void end();
+
+		void set_topology(D3D11_PRIMITIVE_TOPOLOGY topology);
+		void set_vertex_shader(ID3D11VertexShader* shader);
+		void set_pixel_shader(ID3D11PixelShader* shader);
+		void set_input_layout(ID3D11InputLayout* input_layout);
+		void set_vertex_buffer(ID3D11Buffer* buffer, UINT stride);
+		void set_index_buffer(ID3D11Buffer* buffer);
+		// vertex shader slot 0
+		void set_constant_buffer(ID3D11Buffer* buffer);
+		void set_blend_state(ID3D11BlendState* state);
+		// pixel shader slot 0
+		void set_shader_resource(ID3D11ShaderResourceView* view);
+		void set_sampler(ID3D11SamplerState* sampler);
+		void set_rasterizer_state(ID3D11RasterizerState* state);
+		void set_scissor_rect(const D3D11_RECT& rect);
+		// a single render target without depth
+		void set_render_target(ID3D11RenderTargetView* view);
+
+		// counters since the last begin()
+		const statistics& stats() const;
+	private:
+		// true if value differs from what piece last bound, which it then becomes
+		template<typename T>
+		bool changed(T& current, const T& value, state_saver::piece piece);
+
+		struct vertex_buffer_binding
+		{
+			ID3D11Buffer* buffer;
+			UINT stride;
+
+			bool operator==(const vertex_buffer_binding&) const = default;
+		};
+
+		struct rect_binding
+		{
+			D3D11_RECT rect;
+
+			bool operator==(const rect_binding& other) const
+			{
+				return rect.left == other.rect.left && rect.top == other.rect.top && rect.right == other.rect.right && rect.bottom == other.rect.bottom;
+			}
+		};
+
+		state_saver _state_saver;
+		ID3D11DeviceContext* _device_context;
+		// pieces bound since begin(), the rest hold whatever the game left there
+		std::uint32_t _bound { };
+		D3D11_PRIMITIVE_TOPOLOGY _topology;
+		ID3D11VertexShader* _vertex_shader;
+		ID3D11PixelShader* _pixel_shader;
+		ID3D11InputLayout* _input_layout;
+		vertex_buffer_binding _vertex_buffer;
+		ID3D11Buffer* _index_buffer;
+		ID3D11Buffer* _constant_buffer;
+		ID3D11BlendState* _blend_state;
+		ID3D11ShaderResourceView* _shader_resource;
+		ID3D11SamplerState* _sampler;
+		ID3D11RasterizerState* _rasterizer_state;
+		rect_binding _scissor_rect;
+		ID3D11RenderTargetView* _render_target;
+		statistics _stats { };
+	};
+
+	using state_cache = basic_state_cache<use_lazy_state_backup>;
+}
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include <xmmintrin.h>
+#include "stroke.hpp"
+
+namespace rendering
+{
+	namespace stroke
+	{
+		namespace
+		{
+			struct joint
+			{
+				// offsets of one half width for the incoming and outgoing sides, the same
+				// miter vector unless the joint is bevelled
+				vec2 in;
+				vec2 out;
+				bool bevel;
+				// side the bevel fills, the outside of the turn
+				bool right;
+			};
+
+			// writes nothing when Write is false, so counting and writing can never disagree
+			template<bool Write>
+			class walker
+			{
+			public:
+				walker(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, bool closed, const style& style, colour colour)
+					: _vertices(vertices)
+					, _indices(indices)
+					, _base(base)
+					, _points(points)
+					, _count(count)
+					, _closed(closed)
+					, _style(style)
+				{
+					// thinner than the fringe fades out instead of getting narrower
+					const auto half = style.thickness * 0.5f;
+					_core = half > fringe * 0.5f ? half - fringe * 0.5f : 0.f;
+					_outer = _core + fringe;
+
+					if constexpr (Write)
+					{
+						auto solid = colour;
+						if (style.thickness < fringe)
+							solid.a *= style.thickness / fringe;
+						_solid = vertex_colour(solid);
+						_clear = vertex_colour({ colour.r, colour.g, colour.b, 0.f });
+					}
+				}
+
+				size run(std::size_t first, std::size_t last)
+				{
+					const auto total = _closed ? _count + 1 : _count;
+
+					// start of the incoming segment, the previous point's outgoing row
+					std::size_t previous = 0;
+					for (auto i = first; i <= last; ++i)
+					{
+						const auto pos = at(i);
+
+						// open ends get a cap and a transparent row past it
+						if (!_closed && (i == 0 || i + 1 == total))
+						{
+							const auto start = i == 0;
+							const auto d = start ? direction(0) : direction(total - 2);
+							const auto outward = start ? vec2 { -d.x, -d.y } : d;
+							const auto extend = _style.cap == cap::square ? _style.thickness * 0.5f : 0.f;
+
+							// the rows straddle the end so the fade is centred on it
+							const auto end = vec2 { pos.x + outward.x * extend, pos.y + outward.y * extend };
+							const auto inner = vec2 { end.x - outward.x * fringe * 0.5f, end.y - outward.y * fringe * 0.5f };
+							const auto outer = vec2 { end.x + outward.x * fringe * 0.5f, end.y + outward.y * fringe * 0.5f };
+							const auto n = normal(d);
+
+							const auto row = row_at(inner, n, false);
+							const auto cap_row = row_at(outer, n, true);
+							quads(row, cap_row);
+
+							if (!start)
+								quads(previous, row);
+							previous = row;
+							continue;
+						}
+
+						const auto joint = joint_at(i);
+						if (!joint.bevel)
+						{
+							const auto row = row_at(pos, joint.in, false);
+							if (i != first)
+								quads(previous, row);
+							previous = row;
+							continue;
+						}
+
+						// a piece that starts on a bevel only needs the outgoing row, the piece
+						// before it wrote the rest
+						if (i == first)
+						{
+							previous = row_at(pos, joint.out, false);
+							continue;
+						}
+
+						const auto in = row_at(pos, joint.in, false);
+						const auto out = row_at(pos, joint.out, false);
+						const auto centre = vertex_at(pos, true);
+						quads(previous, in);
+
+						// a core triangle and a fringe quad across the outside of the turn
+						const auto core = joint.right ? 2u : 1u;
+						const auto edge = joint.right ? 3u : 0u;
+						triangle(centre, in + core, out + core);
+						triangle(in + core, in + edge, out + core);
+						triangle(out + core, in + edge, out + edge);
+
+						previous = out;
+					}
+
+					return { _vertex_count, _index_count };
+				}
+			private:
+				vec2 at(std::size_t i) const
+				{
+					return _points[i < _count ? i : i - _count];
+				}
+
+				// unit direction of the segment starting at point i. repeated points borrow the
+				// direction of a nearby segment so they neither split nor twist the stroke
+				vec2 direction(std::size_t i) const
+				{
+					const auto segments = _closed ? _count : _count - 1;
+					vec2 d;
+					for (auto step = 0u; step < 8u; ++step)
+					{
+						if (unit((i + step) % segments, d) || unit((i + segments - step % segments) % segments, d))
+							return d;
+					}
+					return { 1.f, 0.f };
+				}
+
+				bool unit(std::size_t segment, vec2& d) const
+				{
+					const auto from = at(segment);
+					const auto to = at(segment + 1);
+					const auto dx = to.x - from.x;
+					const auto dy = to.y - from.y;
+					const auto length_squared = dx * dx + dy * dy;
+					if (length_squared <= 1e-12f)
+						return false;
+
+					const auto inverse = 1.f / _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(length_squared)));
+					d = { dx * inverse, dy * inverse };
+					return true;
+				}
+
+				static vec2 normal(vec2 d)
+				{
+					return { -d.y, d.x };
+				}
+
+				joint joint_at(std::size_t i) const
+				{
+					const auto segments = _closed ? _count : _count - 1;
+					const auto in_direction = direction(i == 0 ? segments - 1 : i - 1);
+					const auto out_direction = direction(i == segments ? 0 : i);
+					const auto in = normal(in_direction);
+					const auto out = normal(out_direction);
+					const auto cosine = in.x * out.x + in.y * out.y;
+
+					// nearly straight, nothing to fill
+					if (cosine > 0.9999f)
+						return { in, in, false, false };
+
+					// the miter is (in + out) / (1 + cos), sqrt(2 / (1 + cos)) half widths long
+					const auto within_limit = 2.f < miter_limit * miter_limit * (1.f + cosine);
+					if (_style.join == join::miter && within_limit)
+					{
+						const auto scale = 1.f / (1.f + cosine);
+						const vec2 miter = { (in.x + out.x) * scale, (in.y + out.y) * scale };
+						return { miter, miter, false, false };
+					}
+
+					// turning towards the normal leaves the outside on the right
+					const auto cross = in_direction.x * out_direction.y - in_direction.y * out_direction.x;
+					return { in, out, true, cross > 0.f };
+				}
+
+				std::size_t vertex_at(vec2 pos, bool solid)
+				{
+					if constexpr (Write)
+						_vertices[_vertex_count] = { pos, solid ? _solid : _clear };
+					return _vertex_count++;
+				}
+
+				// left fringe, left core, right core, right fringe
+				std::size_t row_at(vec2 pos, vec2 offset, bool clear)
+				{
+					const auto first = vertex_at({ pos.x + offset.x * _outer, pos.y + offset.y * _outer }, false);
+					vertex_at({ pos.x + offset.x * _core, pos.y + offset.y * _core }, !clear);
+					vertex_at({ pos.x - offset.x * _core, pos.y - offset.y * _core }, !clear);
+					vertex_at({ pos.x - offset.x * _outer, pos.y - offset.y * _outer }, false);
+					return first;
+				}
+
+				void triangle(std::size_t a, std::size_t b, std::size_t c)
+				{
+					if constexpr (Write)
+					{
+						_indices[_index_count] = static_cast<std::uint16_t>(_base + a);
+						_indices[_index_count + 1] = static_cast<std::uint16_t>(_base + b);
+						_indices[_index_count + 2] = static_cast<std::uint16_t>(_base + c);
+					}
+					_index_count += 3;
+				}
+
+				// the fringe, core and fringe strips between two rows
+				void quads(std::size_t from, std::size_t to)
+				{
+					for (auto k = 0u; k < 3u; ++k)
+					{
+						triangle(from + k, from + k + 1, to + k);
+						triangle(to + k, from + k + 1, to + k + 1);
+					}
+				}
+
+				vertex* _vertices;
+				std::uint16_t* _indices;
+				std::uint16_t _base;
+				const vec2* _points;
+				std::size_t _count;
+				bool _closed;
+				const style& _style;
+
+				float _core;
+				float _outer;
+				decltype(vertex_colour(colour { })) _solid { };
+				decltype(vertex_colour(colour { })) _clear { };
+
+				std::size_t _vertex_count { };
+				std::size_t _index_count { };
+			};
+		}
+
+		float reach(const style& style)
+		{
+			const auto half = style.thickness * 0.5f;
+			const auto outer = (half > fringe * 0.5f ? half : fringe * 0.5f) + fringe * 0.5f;
+			const auto extend = style.cap == cap::square ? half + fringe : fringe;
+			const auto miter = outer * miter_limit;
+			return miter > outer + extend ? miter : outer + extend;
+		}
+
+		size measure(const vec2* points, std::size_t count, bool closed, std::size_t first, std::size_t last, const style& style)
+		{
+			return walker<false>(nullptr, nullptr, 0, points, count, closed, style, { }).run(first, last);
+		}
+
+		void write(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, bool closed, std::size_t first, std::size_t last, const style& style, colour colour)
+		{
+			walker<true>(vertices, indices, base, points, count, closed, style, colour).run(first, last);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "types.hpp"
+
+namespace rendering
+{
+	// lines of any width extruded into triangles. every edge has a one pixel fringe whose
+	// outer vertices are transparent, so blending the interpolated alpha anti-aliases it
+	namespace stroke
+	{
+		enum class join
+		{
+			// sharp corners, bevelled once the miter would reach past miter_limit half widths
+			miter,
+			bevel
+		};
+
+		enum class cap
+		{
+			// ends at the end point
+			butt,
+			// extends past the end point by half the thickness
+			square
+		};
+
+		constexpr auto miter_limit = 4.f;
+		constexpr auto fringe = 1.f;
+
+		struct style
+		{
+			float thickness;
+			stroke::join join { join::miter };
+			stroke::cap cap { cap::butt };
+		};
+
+		struct size
+		{
+			std::size_t vertices;
+			std::size_t indices;
+		};
+
+		// furthest any vertex lies from the points it was extruded from
+		float reach(const style& style);
+
+		// a closed stroke visits count + 1 points, the last being the first again. a long stroke
+		// can be written as pieces [first, last] that share their end points, pieces join up as
+		// if the stroke had been written whole. a piece holds at most 9 vertices per point and
+		// 27 indices per point plus 18
+		size measure(const vec2* points, std::size_t count, bool closed, std::size_t first, std::size_t last, const style& style);
+		// triangle list, exactly the counts measure() reports
+		void write(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, bool closed, std::size_t first, std::size_t last, const style& style, colour colour);
+	}
+}
\ No newline at end of file
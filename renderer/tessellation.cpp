@@ -0,0 +1,155 @@
+#include <xmmintrin.h>
+#include "tessellation.hpp"
+
+namespace rendering
+{
+	namespace tessellation
+	{
+		float sin(float angle)
+		{
+			// scale to table entries and wrap, the mask also handles negative angles
+			const auto position = angle * static_cast<float>(table_size / (2.0 * pi<double>));
+			auto whole = static_cast<std::int64_t>(position);
+			if (position < static_cast<float>(whole))
+				--whole;
+
+			const auto fraction = position - static_cast<float>(whole);
+			const auto index = static_cast<std::size_t>(whole) & (table_size - 1);
+			return sin_table[index] + (sin_table[index + 1] - sin_table[index]) * fraction;
+		}
+
+		float cos(float angle)
+		{
+			return sin(angle + pi<float> * 0.5f);
+		}
+
+		std::size_t segments(float radius, float max_error)
+		{
+			// leave room for the table's own error, which scales with the radius
+			max_error -= radius * 1e-5f;
+			if (max_error <= 0.f)
+				return max_segments;
+			if (radius <= max_error)
+				return min_segments;
+
+			// the sagitta of a segment spanning theta is r * (1 - cos(theta / 2)) ~ r * theta^2 / 8,
+			// solving for error <= max_error gives n >= pi * sqrt(r / (2 * max_error))
+			const auto root = _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(radius / (2.f * max_error))));
+			const auto count = static_cast<std::size_t>(pi<float> * root) + 1;
+
+			if (count < min_segments)
+				return min_segments;
+			if (count > max_segments)
+				return max_segments;
+			return count;
+		}
+
+		void ellipse(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 pos, vec2 radii, std::size_t segments, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+			const auto step = 2.f * pi<float> / static_cast<float>(segments);
+
+			for (auto i = 0u; i < segments; ++i)
+			{
+				const auto angle = step * static_cast<float>(i);
+				vertices[i] = { pos.x + radii.x * cos(angle), pos.y + radii.y * sin(angle), c };
+
+				indices[i * 2] = base + i;
+				indices[i * 2 + 1] = base + (i + 1 == segments ? 0 : i + 1);
+			}
+		}
+
+		void filled_ellipse(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 pos, vec2 radii, std::size_t segments, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+			const auto step = 2.f * pi<float> / static_cast<float>(segments);
+
+			vertices[0] = { pos, c };
+			for (auto i = 0u; i < segments; ++i)
+			{
+				const auto angle = step * static_cast<float>(i);
+				vertices[i + 1] = { pos.x + radii.x * cos(angle), pos.y + radii.y * sin(angle), c };
+
+				indices[i * 3] = base;
+				indices[i * 3 + 1] = base + 1 + i;
+				indices[i * 3 + 2] = base + 1 + (i + 1 == segments ? 0 : i + 1);
+			}
+		}
+
+		void arc(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 pos, float radius, float start, float end, std::size_t segments, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+			const auto step = (end - start) / static_cast<float>(segments);
+
+			for (auto i = 0u; i <= segments; ++i)
+			{
+				const auto angle = start + step * static_cast<float>(i);
+				vertices[i] = { pos.x + radius * cos(angle), pos.y + radius * sin(angle), c };
+
+				if (i < segments)
+				{
+					indices[i * 2] = base + i;
+					indices[i * 2 + 1] = base + i + 1;
+				}
+			}
+		}
+
+		void polygon(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+
+			for (auto i = 0u; i < count; ++i)
+			{
+				vertices[i] = { points[i], c };
+
+				indices[i * 2] = base + i;
+				indices[i * 2 + 1] = base + (i + 1 == count ? 0 : i + 1);
+			}
+		}
+
+		void filled_polygon(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+
+			for (auto i = 0u; i < count; ++i)
+				vertices[i] = { points[i], c };
+
+			for (auto i = 0u; i + 2 < count; ++i)
+			{
+				indices[i * 3] = base;
+				indices[i * 3 + 1] = base + i + 1;
+				indices[i * 3 + 2] = base + i + 2;
+			}
+		}
+
+		void polygon_piece(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, std::size_t first, std::size_t size, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+
+			for (auto i = 0u; i < size; ++i)
+				vertices[i] = { points[(first + i) % count], c };
+
+			for (auto i = 0u; i + 1 < size; ++i)
+			{
+				indices[i * 2] = base + i;
+				indices[i * 2 + 1] = base + i + 1;
+			}
+		}
+
+		void fan_piece(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 apex, const vec2* rim, std::size_t count, colour colour)
+		{
+			const auto c = vertex_colour(colour);
+
+			vertices[0] = { apex, c };
+			for (auto i = 0u; i < count; ++i)
+				vertices[i + 1] = { rim[i], c };
+
+			for (auto i = 0u; i + 1 < count; ++i)
+			{
+				indices[i * 3] = base;
+				indices[i * 3 + 1] = base + i + 1;
+				indices[i * 3 + 2] = base + i + 2;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "types.hpp"
+
+namespace rendering
+{
+	namespace tessellation
+	{
+		constexpr std::size_t table_size = 1024;
+		constexpr std::size_t min_segments = 8;
+		constexpr std::size_t max_segments = 512;
+
+		// taylor series, only valid for |x| <= pi which is all the table needs
+		constexpr double taylor_sin(double x)
+		{
+			auto term = x;
+			auto sum = x;
+			for (auto i = 1; i < 14; ++i)
+			{
+				term *= -x * x / ((2.0 * i) * (2.0 * i + 1.0));
+				sum += term;
+			}
+			return sum;
+		}
+
+		// one full turn plus a wrap entry so lookups can always interpolate to the next
+		constexpr auto sin_table = []
+		{
+			std::array<float, table_size + 1> table { };
+			for (auto i = 0u; i <= table_size; ++i)
+			{
+				auto angle = 2.0 * pi<double> * i / table_size;
+				if (angle > pi<double>)
+					angle -= 2.0 * pi<double>;
+				table[i] = static_cast<float>(taylor_sin(angle));
+			}
+			return table;
+		}();
+
+		// table lookups with linear interpolation, error is below 5e-6 within a turn of 0
+		float sin(float angle);
+		float cos(float angle);
+
+		// fewest segments that keep the polygon within max_error pixels of the true circle
+		std::size_t segments(float radius, float max_error);
+
+		// each writer fills exactly the vertex and index counts noted next to it.
+		// indices are offset by base so they can go straight into the frame's stream
+
+		// closed line list, segments vertices and 2 * segments indices
+		void ellipse(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 pos, vec2 radii, std::size_t segments, colour colour);
+		// triangle fan around the centre, segments + 1 vertices and 3 * segments indices
+		void filled_ellipse(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 pos, vec2 radii, std::size_t segments, colour colour);
+		// open line list from start to end in radians, segments + 1 vertices and 2 * segments indices
+		void arc(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 pos, float radius, float start, float end, std::size_t segments, colour colour);
+		// closed line list, count vertices and 2 * count indices
+		void polygon(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, colour colour);
+		// triangle fan, points must be convex, count vertices and 3 * (count - 2) indices
+		void filled_polygon(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, colour colour);
+
+		// pieces of a polygon too large for one flush. consecutive pieces share the point they
+		// meet at, so together they draw what the whole versions above would
+
+		// open line list through size of the count points from first, wrapping from the last point
+		// to the first. size vertices and 2 * (size - 1) indices
+		void polygon_piece(vertex* vertices, std::uint16_t* indices, std::uint16_t base, const vec2* points, std::size_t count, std::size_t first, std::size_t size, colour colour);
+		// triangle fan from apex over count rim points, count + 1 vertices and 3 * (count - 1) indices
+		void fan_piece(vertex* vertices, std::uint16_t* indices, std::uint16_t base, vec2 apex, const vec2* rim, std::size_t count, colour colour);
+	}
+}
\ No newline at end of file
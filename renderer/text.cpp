@@ -0,0 +1,104 @@
+#include "text.hpp"
+
+namespace rendering
+{
+	const text_layout::placed_glyph* text_layout::layout(const char* text, std::size_t& count, vec2& size)
+	{
+		// fnv-1a over the characters, which also finds the length
+		std::uint64_t hash = 0xcbf29ce484222325ull;
+		std::size_t length = 0u;
+		for (; text[length] && length < max_length; ++length)
+			hash = (hash ^ static_cast<std::uint8_t>(text[length])) * 0x100000001b3ull;
+
+		// four way set associative, the set is picked by the hash
+		constexpr auto ways = 4u;
+		const auto set = &_entries[(hash % (cache_size / ways)) * ways];
+		++_clock;
+
+		auto victim = set;
+		for (auto way = set; way != set + ways; ++way)
+		{
+			auto match = way->hash == hash && way->length == length;
+			for (auto i = 0u; match && i < length; ++i)
+				match = way->text[i] == text[i];
+
+			if (match)
+			{
+				++_stats.hits;
+				way->last_used = _clock;
+				count = way->glyph_count;
+				size = way->size;
+				return way->glyphs;
+			}
+
+			if (way->last_used < victim->last_used)
+				victim = way;
+		}
+
+		++_stats.misses;
+		victim->hash = hash;
+		victim->last_used = _clock;
+		victim->length = static_cast<std::uint8_t>(length);
+		for (auto i = 0u; i < length; ++i)
+			victim->text[i] = text[i];
+		victim->glyph_count = static_cast<std::uint8_t>(place(text, length, victim->glyphs, victim->size));
+
+		count = victim->glyph_count;
+		size = victim->size;
+		return victim->glyphs;
+	}
+
+	vec2 text_layout::measure(const char* text)
+	{
+		std::size_t count;
+		vec2 size;
+		layout(text, count, size);
+		return size;
+	}
+
+	std::size_t text_layout::place(const char* text, std::size_t length, placed_glyph* glyphs, vec2& size)
+	{
+		// the pen moves in fractional pixels, glyphs are snapped so the atlas maps 1:1 to the screen
+		auto pen = 0.f;
+		auto baseline = font::ascent;
+		auto width = 0.f;
+		std::size_t count = 0u;
+
+		for (auto i = 0u; i < length; ++i)
+		{
+			auto character = text[i];
+			if (character == '\n')
+			{
+				pen = 0.f;
+				baseline += font::line_height;
+				continue;
+			}
+
+			if (character < font::first_char || character > font::last_char)
+				character = '?';
+
+			const auto index = static_cast<std::uint8_t>(character - font::first_char);
+			const auto& glyph = font::glyphs[index];
+			if (glyph.width)
+			{
+				glyphs[count++] =
+				{
+					static_cast<std::int16_t>(static_cast<std::int32_t>(pen + 0.5f) + glyph.bearing_x),
+					static_cast<std::int16_t>(static_cast<std::int32_t>(baseline + 0.5f) + glyph.bearing_y),
+					index
+				};
+			}
+
+			pen += glyph.advance;
+			width = pen > width ? pen : width;
+		}
+
+		size = { width, baseline - font::ascent + font::line_height };
+		return count;
+	}
+
+	const text_layout::statistics& text_layout::stats() const
+	{
+		return _stats;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "types.hpp"
+#include "font.hpp"
+
+namespace rendering
+{
+	// lays strings out against the embedded font and remembers recent results, so a label
+	// drawn every frame is only laid out once
+	class text_layout
+	{
+	public:
+		static constexpr std::size_t max_length = 48;
+		static constexpr std::size_t cache_size = 32;
+
+		// top left of a glyph's box relative to the top left of the string
+		struct placed_glyph
+		{
+			std::int16_t x;
+			std::int16_t y;
+			std::uint8_t index;
+		};
+
+		struct statistics
+		{
+			std::size_t hits;
+			std::size_t misses;
+		};
+
+		// strings longer than max_length are truncated. the result is valid until the next call
+		const placed_glyph* layout(const char* text, std::size_t& count, vec2& size);
+		vec2 measure(const char* text);
+
+		const statistics& stats() const;
+	private:
+		struct entry
+		{
+			std::uint64_t hash;
+			std::uint32_t last_used;
+			std::uint8_t length;
+			std::uint8_t glyph_count;
+			char text[max_length];
+			vec2 size;
+			placed_glyph glyphs[max_length];
+		};
+
+		// lays out at most max_length characters, returns the number of glyphs
+		static std::size_t place(const char* text, std::size_t length, placed_glyph* glyphs, vec2& size);
+
+		std::uint32_t _clock;
+		std::array<entry, cache_size> _entries;
+		statistics _stats;
+	};
+}
\ No newline at end of file
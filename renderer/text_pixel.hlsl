@@ -0,0 +1,8 @@
+Texture2D atlas : register(t0);
+SamplerState atlas_sampler : register(s0);
+
+// the atlas only holds coverage, colour comes from the vertex
+float4 main(float4 position : SV_POSITION, float4 colour : COLOUR, float2 uv : TEXCOORD) : SV_TARGET
+{
+	return float4(colour.rgb, colour.a * atlas.Sample(atlas_sampler, uv).r);
+}
\ No newline at end of file
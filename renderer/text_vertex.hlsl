@@ -0,0 +1,27 @@
+cbuffer projection_buffer : register(b0)
+{
+	float4x4 projection;
+};
+
+struct vs_input
+{
+	float2 position : POSITION;
+	float2 uv : TEXCOORD;
+	float4 colour : COLOUR;
+};
+
+struct vs_output
+{
+	float4 position : SV_POSITION;
+	float4 colour : COLOUR;
+	float2 uv : TEXCOORD;
+};
+
+vs_output main(vs_input input)
+{
+	vs_output output;
+	output.position = mul(projection, float4(input.position, 0.f, 1.f));
+	output.colour = input.colour;
+	output.uv = input.uv;
+	return output;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include <emmintrin.h>
+
+namespace rendering
+{
+	// 12 byte vertices with R8G8B8A8_UNORM colour instead of 24 byte float colour
+	constexpr auto use_packed_vertices = true;
+	template<typename T> constexpr T pi = 3.14159265359;
+
+	struct colour
+	{
+		float r, g, b, a;
+	};
+
+	struct vec2
+	{
+		float x, y;
+
+		vec2 operator+(vec2 vec) const
+		{
+			return { x + vec.x, y + vec.y };
+		}
+	};
+
+	struct full_vertex
+	{
+		vec2 pos;
+		rendering::colour colour;
+	};
+
+	struct packed_vertex
+	{
+		vec2 pos;
+		std::uint32_t colour;
+	};
+
+	using vertex = std::conditional_t<use_packed_vertices, packed_vertex, full_vertex>;
+	static_assert(sizeof(packed_vertex) == 12);
+
+	// corner of a glyph or sprite quad, uv is R16G16_UNORM into its atlas
+	struct textured_vertex
+	{
+		vec2 pos;
+		std::uint32_t uv;
+		std::uint32_t colour;
+	};
+	static_assert(sizeof(textured_vertex) == 16);
+
+	// converts to R8G8B8A8_UNORM, r ends up in the lowest byte
+	inline std::uint32_t pack(colour colour)
+	{
+		auto value = _mm_loadu_ps(&colour.r);
+		value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.f));
+		auto integer = _mm_cvtps_epi32(_mm_mul_ps(value, _mm_set1_ps(255.f)));
+		integer = _mm_packs_epi32(integer, integer);
+		integer = _mm_packus_epi16(integer, integer);
+		return static_cast<std::uint32_t>(_mm_cvtsi128_si32(integer));
+	}
+
+	// colour in the form the active vertex format stores it
+	inline auto vertex_colour(colour colour)
+	{
+		if constexpr (use_packed_vertices)
+			return pack(colour);
+		else
+			return colour;
+	}
+}
\ No newline at end of file